@@ -0,0 +1,44 @@
+#include "ChangeJournal.h"
+
+#include <set>
+
+namespace quadtree {
+
+ChangeJournal::ChangeJournal(size_t maxRevisions)
+    : maxRevisions(maxRevisions)
+{
+}
+
+void ChangeJournal::addRevision(unsigned long revision, const std::vector<Chunk*>& chunks)
+{
+    revisions.emplace_back(revision, chunks);
+    while (revisions.size() > maxRevisions) {
+        revisions.pop_front();
+    }
+}
+
+std::pair<bool, std::vector<Chunk*>> ChangeJournal::getChangesSince(
+    unsigned long revision, const Rectangle& area) const
+{
+    // The journal has to contain the tick directly after the known revision, later revisions are unknown, e.g. after a
+    // restart of the producer
+    if (revisions.empty() || revisions.front().first > revision + 1 || revisions.back().first < revision) {
+        return std::pair<bool, std::vector<Chunk*>>(false, std::vector<Chunk*>());
+    }
+
+    std::set<Chunk*> added;
+    std::vector<Chunk*> changes;
+    for (const auto& entry : revisions) {
+        if (entry.first <= revision) {
+            continue;
+        }
+        for (Chunk* chunk : entry.second) {
+            if (area.isPointInRectangle(chunk->pos) && added.insert(chunk).second) {
+                changes.push_back(chunk);
+            }
+        }
+    }
+    return std::pair<bool, std::vector<Chunk*>>(true, changes);
+}
+
+}
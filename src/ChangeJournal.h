@@ -0,0 +1,50 @@
+#ifndef QUADTREESYNCEVALUATION_CHANGEJOURNAL_H
+#define QUADTREESYNCEVALUATION_CHANGEJOURNAL_H
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "QuadTreeStructs.h"
+
+namespace quadtree {
+
+/**
+ * Journal of the chunks a producer changed in its recent publish ticks. Other than the stored changes of a SyncTree,
+ * which only cover the last tick, the journal allows to compute the exact changes for consumers which are several
+ * ticks behind.
+ *
+ * The journal stores pointers to the chunks of the tree, so the changes always contain the current version of a chunk.
+ * It has to be accessed while holding the lock of the tree.
+ */
+class ChangeJournal {
+
+public:
+    /**
+     * @param maxRevisions Number of publish ticks kept in the journal
+     */
+    explicit ChangeJournal(size_t maxRevisions);
+
+    /**
+     * Adds the changes of a publish tick, the oldest tick is dropped if the journal is full
+     * @param revision Revision of the tree after the tick
+     * @param chunks Chunks changed within the tick
+     */
+    void addRevision(unsigned long revision, const std::vector<Chunk*>& chunks);
+
+    /**
+     * Returns the chunks within the area which changed after the given revision, each chunk only once
+     * @param revision Revision of the tree known by the consumer
+     * @param area Area of the requested subtree
+     * @return False if the journal does not reach back to the revision or does not know it yet, and the changed chunks
+     */
+    std::pair<bool, std::vector<Chunk*>> getChangesSince(unsigned long revision, const Rectangle& area) const;
+
+protected:
+    size_t maxRevisions;
+    std::deque<std::pair<unsigned long, std::vector<Chunk*>>> revisions;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_CHANGEJOURNAL_H
@@ -0,0 +1,27 @@
+#include "CongestionWindow.h"
+
+#include <algorithm>
+
+namespace quadtree {
+
+CongestionWindow::CongestionWindow(double initialWindow, double minWindow, double maxWindow)
+    : minWindow(std::max(1.0, minWindow))
+    , maxWindow(maxWindow)
+    , window(initialWindow)
+{
+}
+
+void CongestionWindow::increase() { window = std::min(maxWindow, window + 1 / window); }
+
+bool CongestionWindow::decrease(double rtt)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastDecrease < std::chrono::milliseconds((long)rtt)) {
+        return false; // Same congestion event
+    }
+    lastDecrease = now;
+    window = std::max(minWindow, window * DECREASE_FACTOR);
+    return true;
+}
+
+}
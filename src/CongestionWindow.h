@@ -0,0 +1,53 @@
+#ifndef QUADTREESYNCEVALUATION_CONGESTIONWINDOW_H
+#define QUADTREESYNCEVALUATION_CONGESTIONWINDOW_H
+
+#include <chrono>
+
+namespace quadtree {
+
+/**
+ * AIMD congestion window limiting the number of outstanding Interests towards a producer. The window grows by one
+ * Interest per window of received Data packets and is halved on congestion signals, at most once per round trip time
+ * since the signals of a single congestion event arrive in bursts.
+ */
+class CongestionWindow {
+
+public:
+    /**
+     * @param initialWindow Window before the first congestion signal
+     * @param minWindow Lower bound of the window, at least one Interest is always allowed
+     * @param maxWindow Upper bound of the window
+     */
+    CongestionWindow(double initialWindow, double minWindow, double maxWindow);
+
+    /**
+     * Additive increase after a received Data packet
+     */
+    void increase();
+
+    /**
+     * Multiplicative decrease after a congestion Nack or a timeout
+     * @param rtt Smoothed round trip time in milliseconds, decreases within this time after the last one are ignored
+     * @return True if the window was decreased
+     */
+    bool decrease(double rtt);
+
+    /**
+     * Returns true if another Interest may be sent with the given number of outstanding Interests
+     */
+    bool allows(size_t outstanding) const { return outstanding < (size_t)window; }
+
+    double getWindow() const { return window; }
+
+protected:
+    static constexpr double DECREASE_FACTOR = 0.5;
+
+    double minWindow;
+    double maxWindow;
+    double window;
+    std::chrono::steady_clock::time_point lastDecrease;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_CONGESTIONWINDOW_H
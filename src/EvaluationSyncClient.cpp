@@ -15,7 +15,8 @@ using namespace std::literals;
 namespace po = boost::program_options;
 
 void storeParameters(std::string logDir, std::string responsibilityArea, int treeSize, int requestLevel,
-    std::string traceFile, std::string prefix, int chunkThreshold, int levelDifference, int syncRequestInterval)
+    std::string traceFile, std::string prefix, int chunkThreshold, int levelDifference, int syncRequestInterval,
+    const quadtree::SyncClientOptions& options)
 {
     std::ofstream logfile = std::ofstream(logDir + "/" + responsibilityArea + "_settings.txt");
     logfile << "[Parameters]" << std::endl;
@@ -28,6 +29,7 @@ void storeParameters(std::string logDir, std::string responsibilityArea, int tre
     logfile << "chunkThreshold:\t" << chunkThreshold << std::endl;
     logfile << "levelDifference:\t" << levelDifference << std::endl;
     logfile << "syncRequestInterval:\t" << syncRequestInterval << std::endl;
+    logfile << options;
     logfile.flush();
     logfile.close();
 }
@@ -51,6 +53,7 @@ int main(int argc, char* argv[])
         ("chunkThreshold", po::value<int>(&opt)->default_value(200), "The maximum amount of chunks included in a sync response")
         ("syncRequestInterval", po::value<int>(&opt)->default_value(500), "Interval in which sync requests are sent");
     /* clang-format on */
+    quadtree::addSyncClientOptions(desc);
 
     po::variables_map vm;
     po::store(po::parse_command_line(argc, argv, desc), vm);
@@ -86,8 +89,10 @@ int main(int argc, char* argv[])
     int levelDifference = vm["levelDifference"].as<int>();
     int syncRequestInterval = vm["syncRequestInterval"].as<int>();
 
+    quadtree::SyncClientOptions options = quadtree::SyncClientOptions::fromVariablesMap(vm);
+
     storeParameters(logDir, responsibilityAreaString, treeSize, initialRequestLevel, traceFile, prefix, chunkThreshold,
-        levelDifference, syncRequestInterval);
+        levelDifference, syncRequestInterval, options);
 
     // Parse CSV File
     auto changesOverTime = ChunkFileReader::readChangesOverTime(traceFile, treeSize);
@@ -98,7 +103,7 @@ int main(int argc, char* argv[])
         quadtree::Point(std::stoi(coordinates[2]), std::stoi(coordinates[3])));
 
     quadtree::ServerModeSyncClient client(prefix, world, responsibility, initialRequestLevel, changesOverTime,
-        logDir + "/", responsibilityAreaString, levelDifference, chunkThreshold, syncRequestInterval);
+        logDir + "/", responsibilityAreaString, levelDifference, chunkThreshold, syncRequestInterval, options);
 
     // Start Sync Client
     try {
@@ -23,6 +23,9 @@ void quadtree::P2PModeSyncClient::startSynchronization()
         }
     }
 
+    startResponsePrecomputation();
+    collectRemoteRegions();
+
     // This thread applies changes from CSV file, NOT the producer
     this->publisherThread = std::thread(&P2PModeSyncClient::applyChangesOverTime, this);
 
@@ -41,16 +44,10 @@ void quadtree::P2PModeSyncClient::startSynchronization()
     } while (currentRegion->getLevel() > 1);
 
     // Start process which requests changes from remote servers
-    for (SyncTree* remoteRegion : this->remoteSyncTrees) {
-        std::thread consumerThread = std::thread(&P2PModeSyncClient::synchronizeRemoteRegion, this, remoteRegion);
-        this->consumerthreads.push_back(std::move(consumerThread));
-    }
+    startRemoteRegionSynchronization();
 
-    // This method should be blocking -- calling Face.processEvents
-    while (this->isRunning) {
-        this->face.processEvents();
-        usleep(1000);
-    }
+    // This method should be blocking -- all consumer timers run on the face's io_service until it is shut down
+    this->face.processEvents(ndn::time::milliseconds::zero(), true);
 }
 
 void quadtree::P2PModeSyncClient::storeLogValues()
@@ -63,7 +60,8 @@ void quadtree::P2PModeSyncClient::storeLogValues()
     logfile.close();
 }
 
-void storeParameters(std::string logDir, std::string responsibilityArea, int treeSize, std::string traceFile)
+void storeParameters(std::string logDir, std::string responsibilityArea, int treeSize, std::string traceFile,
+    const quadtree::SyncClientOptions& options)
 {
     std::ofstream logfile = std::ofstream(logDir + "/" + responsibilityArea + "_settings.txt");
     logfile << "[Parameters]" << std::endl;
@@ -71,6 +69,7 @@ void storeParameters(std::string logDir, std::string responsibilityArea, int tre
     logfile << "responsiblityArea:\t" << responsibilityArea << std::endl;
     logfile << "treeSize:\t" << treeSize << std::endl;
     logfile << "traceFile:\t" << traceFile << std::endl;
+    logfile << options;
     logfile.flush();
     logfile.close();
 }
@@ -92,6 +91,7 @@ int main(int argc, char* argv[])
         ("levelDifference", po::value<int>(&opt)->default_value(2), "How many levels to go deeper for respones with high number of chunk changes")
         ("chunkThreshold", po::value<int>(&opt)->default_value(200), "The maximum amount of chunks included in a sync response");
     /* clang-format on */
+    quadtree::addSyncClientOptions(desc);
 
     po::variables_map vm;
     po::store(po::parse_command_line(argc, argv, desc), vm);
@@ -125,7 +125,9 @@ int main(int argc, char* argv[])
     int chunkThreshold = vm["chunkThreshold"].as<int>();
     int levelDifference = vm["levelDifference"].as<int>();
 
-    storeParameters(logDir, responsibilityAreaString, treeSize, traceFile);
+    quadtree::SyncClientOptions options = quadtree::SyncClientOptions::fromVariablesMap(vm);
+
+    storeParameters(logDir, responsibilityAreaString, treeSize, traceFile, options);
 
     // Parse CSV File
     auto changesOverTime = ChunkFileReader::readChangesOverTime(traceFile, treeSize);
@@ -136,6 +138,6 @@ int main(int argc, char* argv[])
         quadtree::Point(std::stoi(coordinates[2]), std::stoi(coordinates[3])));
 
     quadtree::P2PModeSyncClient client("/world", world, responsibility, 3, changesOverTime, logDir,
-        responsibilityAreaString, levelDifference, chunkThreshold);
+        responsibilityAreaString, levelDifference, chunkThreshold, options);
     client.startSynchronization();
 }
\ No newline at end of file
@@ -38,9 +38,10 @@ class P2PModeSyncClient : public ServerModeSyncClient {
 public:
     P2PModeSyncClient(std::string worldPrefix, Rectangle area, Rectangle responsibleArea, unsigned initialRequestLevel,
         std::vector<std::pair<unsigned, std::vector<quadtree::Chunk>>> changesOverTime, const std::string& logFolder,
-        const std::string& logFilePrefix, unsigned lowerLevels = 2, unsigned chunkThreshold = 200)
+        const std::string& logFilePrefix, unsigned lowerLevels = 2, unsigned chunkThreshold = 200,
+        SyncClientOptions options = SyncClientOptions())
         : ServerModeSyncClient(worldPrefix, area, responsibleArea, initialRequestLevel,
-            changesOverTime, logFolder, logFilePrefix, lowerLevels, chunkThreshold)
+            changesOverTime, logFolder, logFilePrefix, lowerLevels, chunkThreshold, 500, options)
     {
     }
 
@@ -0,0 +1,31 @@
+#include "PeerActivity.h"
+
+namespace quadtree {
+
+PeerActivity::PeerActivity(std::chrono::milliseconds heartbeatTimeout, std::chrono::milliseconds peerStateTimeout,
+    std::chrono::steady_clock::time_point created)
+    : heartbeatTimeout(heartbeatTimeout)
+    , peerStateTimeout(peerStateTimeout)
+    , lastPeerState(created)
+{
+}
+
+void PeerActivity::addHeartbeat(std::chrono::steady_clock::time_point now)
+{
+    heartbeatReceived = true;
+    lastHeartbeat = now;
+}
+
+void PeerActivity::addPeerState(std::chrono::steady_clock::time_point now) { lastPeerState = now; }
+
+bool PeerActivity::hasRecentHeartbeat(std::chrono::steady_clock::time_point now) const
+{
+    return heartbeatReceived && now - lastHeartbeat < heartbeatTimeout;
+}
+
+bool PeerActivity::isPolledByPeer(std::chrono::steady_clock::time_point now) const
+{
+    return passive && now - lastPeerState < peerStateTimeout;
+}
+
+}
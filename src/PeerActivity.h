@@ -0,0 +1,61 @@
+#ifndef QUADTREESYNCEVALUATION_PEERACTIVITY_H
+#define QUADTREESYNCEVALUATION_PEERACTIVITY_H
+
+#include <chrono>
+
+#include <ndn-cxx/name.hpp>
+
+namespace quadtree {
+
+/**
+ * Consumer side record of the signs of life of a remote region's producer, which make polling the region unnecessary
+ * for a while: its digest heartbeats and, if the region is passive, the state it sends along with its own polls.
+ */
+class PeerActivity {
+
+public:
+    /**
+     * @param heartbeatTimeout Time after the last heartbeat until the region is polled again
+     * @param peerStateTimeout Time after the last state of a passive region's producer until the region is polled
+     * again
+     * @param created Creation time, passive regions are not polled before their producer had the chance to poll
+     */
+    PeerActivity(std::chrono::milliseconds heartbeatTimeout, std::chrono::milliseconds peerStateTimeout,
+        std::chrono::steady_clock::time_point created = std::chrono::steady_clock::now());
+
+    /**
+     * Of each pair of regions, the producer of the region with the smaller name polls the other one and sends its
+     * state along. Returns true if the remote region is passive, i.e. its producer polls the own region.
+     */
+    static bool isPassiveRegion(const ndn::Name& region, const ndn::Name& ownRegion) { return region < ownRegion; }
+
+    void setPassive(bool passive) { this->passive = passive; }
+
+    bool isPassive() const { return passive; }
+
+    void addHeartbeat(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    void addPeerState(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    /**
+     * Returns true if a heartbeat arrived within the heartbeat timeout
+     */
+    bool hasRecentHeartbeat(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now()) const;
+
+    /**
+     * Returns true if the region is passive and its producer sent its state within the peer state timeout
+     */
+    bool isPolledByPeer(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now()) const;
+
+protected:
+    std::chrono::milliseconds heartbeatTimeout;
+    std::chrono::milliseconds peerStateTimeout;
+    bool passive = false;
+    bool heartbeatReceived = false;
+    std::chrono::steady_clock::time_point lastHeartbeat;
+    std::chrono::steady_clock::time_point lastPeerState;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_PEERACTIVITY_H
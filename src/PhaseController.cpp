@@ -0,0 +1,60 @@
+#include "PhaseController.h"
+
+#include <cmath>
+
+namespace quadtree {
+
+PhaseController::PhaseController(long nominalPeriod)
+    : period(nominalPeriod)
+{
+}
+
+void PhaseController::addPublishEvent(long publishEvent)
+{
+    if (publishEvent <= lastPublishEvent) {
+        return; // Same or older event
+    }
+    if (lastPublishEvent != 0) {
+        // Events in between may not have been observed
+        long distance = publishEvent - lastPublishEvent;
+        long periods = std::lround(distance / period);
+        if (periods >= 1) {
+            period = 0.875 * period + 0.125 * ((double)distance / periods);
+        }
+    }
+    lastPublishEvent = publishEvent;
+}
+
+void PhaseController::addRttSample(long rtt)
+{
+    if (!hasRtt) {
+        smoothedRtt = rtt;
+        hasRtt = true;
+    } else {
+        smoothedRtt = 0.875 * smoothedRtt + 0.125 * rtt;
+    }
+}
+
+PhaseController::TimePoint PhaseController::alignSendTime(TimePoint planned) const
+{
+    if (lastPublishEvent == 0) {
+        return planned;
+    }
+
+    // The Interest should arrive GUARD_TIME_MS after the publish event closest to its planned arrival
+    const double oneWayDelay = smoothedRtt / 2;
+    const double plannedArrival
+        = std::chrono::duration_cast<std::chrono::milliseconds>(planned.time_since_epoch()).count() + oneWayDelay;
+    const double periods = std::round((plannedArrival - GUARD_TIME_MS - lastPublishEvent) / period);
+    double sendTime = lastPublishEvent + periods * period + GUARD_TIME_MS - oneWayDelay;
+
+    const double now
+        = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+              .count();
+    while (sendTime < now) {
+        sendTime += period;
+    }
+    return TimePoint(std::chrono::milliseconds((long)sendTime));
+}
+
+}
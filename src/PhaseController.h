@@ -0,0 +1,61 @@
+#ifndef QUADTREESYNCEVALUATION_PHASECONTROLLER_H
+#define QUADTREESYNCEVALUATION_PHASECONTROLLER_H
+
+#include <chrono>
+
+namespace quadtree {
+
+/**
+ * Estimates the publish phase of a remote producer and schedules sync requests to arrive right after the producer's
+ * next rehash.
+ *
+ * Every sync response carries the time of the producer's last publish event. Publish events are a multiple of the
+ * producer's publish period apart, so the period is estimated from the distance of consecutive events. Together with
+ * the measured round trip time, the time an Interest has to be sent to arrive just after a publish event is derived.
+ * Producer and consumer clocks are assumed to be synchronized, as for the latency measurements.
+ */
+class PhaseController {
+
+public:
+    typedef std::chrono::system_clock::time_point TimePoint;
+
+    /**
+     * @param nominalPeriod Publish period assumed until events of the producer were observed, in milliseconds
+     */
+    explicit PhaseController(long nominalPeriod);
+
+    /**
+     * Adds the publish event timestamp of a received response (milliseconds since epoch)
+     */
+    void addPublishEvent(long publishEvent);
+
+    /**
+     * Adds a round trip time sample in milliseconds
+     */
+    void addRttSample(long rtt);
+
+    /**
+     * Aligns the planned send time of the next sync request to the producer's publish phase. The aligned time differs
+     * from the planned one by at most half a publish period and does not lie in the past.
+     * @param planned Send time according to the sync request interval
+     * @return Send time at which the Interest arrives at the producer right after a publish event
+     */
+    TimePoint alignSendTime(TimePoint planned) const;
+
+    double getPeriod() const { return period; }
+
+    double getSmoothedRtt() const { return smoothedRtt; }
+
+protected:
+    // Time between the producer's rehash and the arrival of the Interest, so the response contains the new state
+    static const long GUARD_TIME_MS = 10;
+
+    double period;
+    double smoothedRtt = 0;
+    bool hasRtt = false;
+    long lastPublishEvent = 0;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_PHASECONTROLLER_H
@@ -6,6 +6,7 @@
 #define QUADTREESYNCEVALUATION_QUADTREESTRUCTS_H
 
 #include <boost/functional/hash.hpp>
+#include <cstdint>
 #include <ostream>
 
 namespace quadtree {
@@ -38,6 +39,45 @@ struct Point {
 
     static bool equalPointCoords(Point p1, Point p2) { return p1.x == p2.x && p1.y == p2.y; }
 
+    /**
+     * Returns the Morton code (Z-order) of the point, which interleaves the bits of x (even bits) and y (odd bits).
+     * Sorted by their Morton codes, points are listed subtree by subtree in the order of the SyncTree's child indices.
+     */
+    uint64_t toMorton() const { return spreadBits((uint32_t)x) | (spreadBits((uint32_t)y) << 1); }
+
+    /**
+     * Returns the point of the given Morton code, see toMorton()
+     */
+    static Point fromMorton(uint64_t code) { return Point((int)compactBits(code), (int)compactBits(code >> 1)); }
+
+    /**
+     * Moves the bits of the value to the even bits of the result
+     */
+    static uint64_t spreadBits(uint32_t value)
+    {
+        uint64_t bits = value;
+        bits = (bits | (bits << 16)) & 0x0000FFFF0000FFFFULL;
+        bits = (bits | (bits << 8)) & 0x00FF00FF00FF00FFULL;
+        bits = (bits | (bits << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        bits = (bits | (bits << 2)) & 0x3333333333333333ULL;
+        bits = (bits | (bits << 1)) & 0x5555555555555555ULL;
+        return bits;
+    }
+
+    /**
+     * Inverse of spreadBits(..), collects the even bits of the value
+     */
+    static uint32_t compactBits(uint64_t value)
+    {
+        uint64_t bits = value & 0x5555555555555555ULL;
+        bits = (bits | (bits >> 1)) & 0x3333333333333333ULL;
+        bits = (bits | (bits >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+        bits = (bits | (bits >> 4)) & 0x00FF00FF00FF00FFULL;
+        bits = (bits | (bits >> 8)) & 0x0000FFFF0000FFFFULL;
+        bits = (bits | (bits >> 16)) & 0x00000000FFFFFFFFULL;
+        return (uint32_t)bits;
+    }
+
     bool operator==(const Point& rhs) const { return x == rhs.x && y == rhs.y; }
     bool operator!=(const Point& rhs) const { return !(rhs == *this); }
     bool operator<(const Point& rhs) const
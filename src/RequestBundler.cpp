@@ -0,0 +1,52 @@
+#include "RequestBundler.h"
+
+#include <algorithm>
+
+namespace quadtree {
+
+RequestBundler::ResponseBudget::ResponseBudget(size_t maxSize)
+    : maxSize(maxSize)
+{
+}
+
+size_t RequestBundler::ResponseBudget::getRemaining() const
+{
+    return maxSize - std::min(size + OVERHEAD, maxSize);
+}
+
+bool RequestBundler::ResponseBudget::add(size_t responseSize)
+{
+    if (size + responseSize + OVERHEAD > maxSize) {
+        return false;
+    }
+    size += responseSize + OVERHEAD;
+    return true;
+}
+
+RequestBundler::RequestBundler(size_t maxSubtrees)
+    : maxSubtrees(maxSubtrees)
+{
+}
+
+std::vector<SyncTree*> RequestBundler::takeBundle(
+    std::deque<SyncTree*>& queued, const std::set<SyncTree*>& unaggregated, size_t capacity) const
+{
+    std::vector<SyncTree*> bundle;
+    const size_t limit = std::min(maxSubtrees, capacity);
+    for (auto it = queued.begin(); it != queued.end() && bundle.size() < limit; ++it) {
+        if (unaggregated.count(*it) == 0) {
+            bundle.push_back(*it);
+        }
+    }
+    if (bundle.size() < 2) {
+        return std::vector<SyncTree*>();
+    }
+    queued.erase(std::remove_if(queued.begin(), queued.end(),
+                     [&bundle](SyncTree* subtree) {
+                         return std::find(bundle.begin(), bundle.end(), subtree) != bundle.end();
+                     }),
+        queued.end());
+    return bundle;
+}
+
+}
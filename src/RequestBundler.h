@@ -0,0 +1,77 @@
+#ifndef QUADTREESYNCEVALUATION_REQUESTBUNDLER_H
+#define QUADTREESYNCEVALUATION_REQUESTBUNDLER_H
+
+#include <cstddef>
+#include <deque>
+#include <set>
+#include <vector>
+
+namespace quadtree {
+
+class SyncTree;
+
+/**
+ * Bundling of queued subtree requests of a remote region into aggregated requests. The consumer takes the bundles
+ * from its request queue, the producer fills the aggregated response while the subtree responses fit into a single
+ * packet and lists the others as omitted, which the consumer requests again with plain Interests.
+ */
+class RequestBundler {
+
+public:
+    /**
+     * Space bookkeeping of an aggregated response
+     */
+    class ResponseBudget {
+
+    public:
+        /**
+         * @param maxSize Maximum size of the aggregated response
+         */
+        explicit ResponseBudget(size_t maxSize);
+
+        /**
+         * Returns the number of bytes left for the next subtree response
+         */
+        size_t getRemaining() const;
+
+        /**
+         * Adds a subtree response to the aggregated response
+         * @param responseSize Size of the subtree response
+         * @return False if the response does not fit and has to be omitted
+         */
+        bool add(size_t responseSize);
+
+        size_t getSize() const { return size; }
+
+        // Size of the subtree name and the embedding of a response within an aggregated response
+        static const size_t OVERHEAD = 32;
+
+    protected:
+        size_t maxSize;
+        size_t size = 0;
+    };
+
+    /**
+     * @param maxSubtrees Maximum number of subtrees per aggregated request
+     */
+    explicit RequestBundler(size_t maxSubtrees);
+
+    /**
+     * Takes the queued subtrees of the next aggregated request in queue order, skipping the subtrees which have to be
+     * requested with plain Interests. Nothing is taken if fewer than two subtrees can be bundled, a single subtree is
+     * requested with a plain Interest.
+     * @param queued Queued subtrees, the bundled ones are removed
+     * @param unaggregated Queued subtrees which must not be bundled
+     * @param capacity Number of requests the region may issue at the moment
+     * @return The bundled subtrees, empty if no aggregated request should be sent
+     */
+    std::vector<SyncTree*> takeBundle(
+        std::deque<SyncTree*>& queued, const std::set<SyncTree*>& unaggregated, size_t capacity) const;
+
+protected:
+    size_t maxSubtrees;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_REQUESTBUNDLER_H
@@ -0,0 +1,98 @@
+#include "ResponseCache.h"
+
+namespace quadtree {
+
+bool ResponseCache::fetchOrJoin(const Key& key, const ResponseCallback& onResponse)
+{
+    Segments cached;
+    {
+        std::unique_lock<std::mutex> lck(this->cacheMutex);
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            // Nobody computes the response yet, the caller has to do it
+            misses++;
+            entries[key].waiting.push_back(onResponse);
+            return true;
+        }
+        if (it->second.segments.empty()) {
+            // Response is currently computed, wait for it
+            joinedRequests++;
+            it->second.waiting.push_back(onResponse);
+            return false;
+        }
+        hits++;
+        cached = it->second.segments;
+    }
+
+    // Invoke callback outside of the lock
+    onResponse(cached);
+    return false;
+}
+
+bool ResponseCache::join(const Key& key, const ResponseCallback& onResponse)
+{
+    Segments cached;
+    {
+        std::unique_lock<std::mutex> lck(this->cacheMutex);
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            return false;
+        }
+        if (it->second.segments.empty()) {
+            // Response is currently computed, wait for it
+            joinedRequests++;
+            it->second.waiting.push_back(onResponse);
+            return true;
+        }
+        hits++;
+        cached = it->second.segments;
+    }
+
+    // Invoke callback outside of the lock
+    onResponse(cached);
+    return true;
+}
+
+void ResponseCache::complete(const Key& key, const Segments& segments)
+{
+    std::vector<ResponseCallback> waiting;
+    {
+        std::unique_lock<std::mutex> lck(this->cacheMutex);
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            return;
+        }
+        waiting = std::move(it->second.waiting);
+
+        if (segments.empty() || !isStored(key.revision)) {
+            entries.erase(it);
+        } else {
+            it->second.segments = segments;
+            it->second.waiting.clear();
+        }
+    }
+
+    if (segments.empty()) {
+        return;
+    }
+    for (const auto& callback : waiting) {
+        callback(segments);
+    }
+}
+
+void ResponseCache::invalidate(unsigned long revision)
+{
+    std::unique_lock<std::mutex> lck(this->cacheMutex);
+    currentRevision = revision;
+
+    for (auto it = entries.begin(); it != entries.end();) {
+        // Keep responses which are still computed, they are dropped in complete(..)
+        if (!isStored(it->first.revision) && !it->second.segments.empty()) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+}
@@ -0,0 +1,126 @@
+#ifndef QUADTREESYNCEVALUATION_RESPONSECACHE_H
+#define QUADTREESYNCEVALUATION_RESPONSECACHE_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <ndn-cxx/face.hpp>
+
+namespace quadtree {
+
+/**
+ * Cache for finished sync responses on the producer side. A response only depends on the requested subtree, the
+ * hash value the requester already knows and the state of the producer's tree. Since all consumers in sync ask for
+ * the same (subtree, since-hash) pair within a tick, the serialized, compressed and signed Data packet can be reused
+ * for all of them.
+ *
+ * The cache collapses identical requests into a single computation: the first requester computes the response, all
+ * other requesters are queued and served as soon as the computation finished.
+ *
+ * A response consists of one or more segments. Responses of the previous revision are kept, so the remaining segments
+ * of a response can still be fetched after the next publish tick.
+ */
+class ResponseCache {
+
+public:
+    struct Key {
+        ndn::Name subtreeName;
+        size_t since;
+        unsigned long revision;
+
+        Key(ndn::Name subtreeName, size_t since, unsigned long revision)
+            : subtreeName(std::move(subtreeName))
+            , since(since)
+            , revision(revision)
+        {
+        }
+
+        bool operator<(const Key& rhs) const
+        {
+            if (revision != rhs.revision) {
+                return revision < rhs.revision;
+            }
+            if (since != rhs.since) {
+                return since < rhs.since;
+            }
+            return subtreeName < rhs.subtreeName;
+        }
+    };
+
+    typedef std::vector<std::shared_ptr<const ndn::Data>> Segments;
+    typedef std::function<void(const Segments&)> ResponseCallback;
+
+public:
+    /**
+     * Looks up the response for the given key. If the response is cached, the callback is invoked immediately. If the
+     * response is currently computed, the callback is invoked as soon as the computation finished.
+     *
+     * If neither is the case, the caller is responsible for computing the response and has to hand it over by calling
+     * complete(..). The callback of the caller is invoked by complete(..) as well.
+     *
+     * @param key Identifies the response
+     * @param onResponse Callback invoked with the segments of the finished response
+     * @return True if the caller has to compute the response
+     */
+    bool fetchOrJoin(const Key& key, const ResponseCallback& onResponse);
+
+    /**
+     * Looks up the response for the given key like fetchOrJoin(..), but never asks the caller to compute it. Used for
+     * requests of further segments of a response, which cannot be recomputed for an older revision.
+     *
+     * @param key Identifies the response
+     * @param onResponse Callback invoked with the segments of the finished response
+     * @return False if the response is neither cached nor computed
+     */
+    bool join(const Key& key, const ResponseCallback& onResponse);
+
+    /**
+     * Hands over a computed response and invokes the callbacks of all requesters waiting for it. Responses of an
+     * outdated revision are delivered to the waiting requesters, but are not stored.
+     *
+     * @param key Identifies the response
+     * @param segments The finished Data packets. If empty, the computation failed and the waiting requesters are
+     * dropped.
+     */
+    void complete(const Key& key, const Segments& segments);
+
+    /**
+     * Removes all responses which were computed for a revision older than the previous one. Has to be called whenever
+     * the producer's tree is rehashed.
+     *
+     * @param revision The current revision of the producer's tree
+     */
+    void invalidate(unsigned long revision);
+
+    unsigned long getHits() const { return hits; }
+
+    unsigned long getMisses() const { return misses; }
+
+    unsigned long getJoinedRequests() const { return joinedRequests; }
+
+protected:
+    struct Entry {
+        Segments segments;
+        std::vector<ResponseCallback> waiting;
+    };
+
+    /**
+     * Returns true if responses of the given revision are still stored
+     */
+    bool isStored(unsigned long revision) const { return revision + 1 >= currentRevision; }
+
+    std::mutex cacheMutex;
+    std::map<Key, Entry> entries;
+    unsigned long currentRevision = 0;
+
+    unsigned long hits = 0;
+    unsigned long misses = 0;
+    unsigned long joinedRequests = 0;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_RESPONSECACHE_H
@@ -0,0 +1,146 @@
+#include "ResponseTuner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace quadtree {
+
+constexpr double ResponseTuner::ALPHA;
+constexpr double ResponseTuner::HYSTERESIS;
+constexpr double ResponseTuner::PACKET_OVERHEAD;
+
+ResponseTuner::ResponseTuner(Parameters defaults)
+    : defaults(defaults)
+{
+}
+
+void ResponseTuner::addSubtree(const SyncTree* subtree, unsigned remainingLevels)
+{
+    std::unique_lock<std::mutex> lck(this->tunerMutex);
+    SubtreeState state;
+    state.remainingLevels = remainingLevels;
+    state.parameters = defaults;
+    subtrees[subtree] = state;
+}
+
+void ResponseTuner::addTickChanges(const SyncTree* subtree, size_t changes)
+{
+    std::unique_lock<std::mutex> lck(this->tunerMutex);
+    auto it = subtrees.find(subtree);
+    if (it != subtrees.end()) {
+        it->second.changesPerTick = (1 - ALPHA) * it->second.changesPerTick + ALPHA * changes;
+    }
+}
+
+void ResponseTuner::addResponse(const SyncTree* subtree, bool chunkData, size_t items, size_t bytes)
+{
+    if (items == 0) {
+        return;
+    }
+    std::unique_lock<std::mutex> lck(this->tunerMutex);
+    auto it = subtrees.find(subtree);
+    if (it == subtrees.end()) {
+        return;
+    }
+    // Compression makes the size per item depend on the content, it is learned from the sent responses
+    const double bytesPerItem = (double)bytes / items;
+    if (chunkData) {
+        it->second.bytesPerChunk = (1 - ALPHA) * it->second.bytesPerChunk + ALPHA * bytesPerItem;
+    } else {
+        it->second.bytesPerHash = (1 - ALPHA) * it->second.bytesPerHash + ALPHA * bytesPerItem;
+    }
+}
+
+void ResponseTuner::addDescent(const SyncTree* subtree, unsigned depth)
+{
+    std::unique_lock<std::mutex> lck(this->tunerMutex);
+    auto it = subtrees.find(subtree);
+    if (it != subtrees.end()) {
+        it->second.descentDepth = (1 - ALPHA) * it->second.descentDepth + ALPHA * depth;
+        it->second.descents++;
+    }
+}
+
+unsigned ResponseTuner::retune(double ticksPerRequest)
+{
+    static const std::vector<unsigned> thresholds = { 25, 50, 100, 200, 400, 800, 1600 };
+
+    std::unique_lock<std::mutex> lck(this->tunerMutex);
+    unsigned changed = 0;
+    for (auto& entry : subtrees) {
+        SubtreeState& state = entry.second;
+        const double changes = state.changesPerTick * std::max(1.0, ticksPerRequest);
+
+        double bytes, roundTrips;
+        estimate(state, changes, state.remainingLevels, state.parameters, bytes, roundTrips);
+        double bestCost = bytes * roundTrips * HYSTERESIS;
+        Parameters best = state.parameters;
+
+        for (unsigned lowerLevels = 2; lowerLevels <= MAX_LOWER_LEVELS; lowerLevels++) {
+            for (unsigned threshold : thresholds) {
+                Parameters candidate { lowerLevels, threshold };
+                estimate(state, changes, state.remainingLevels, candidate, bytes, roundTrips);
+                if (bytes * roundTrips < bestCost) {
+                    bestCost = bytes * roundTrips;
+                    best = candidate;
+                }
+            }
+        }
+
+        if (best.lowerLevels != state.parameters.lowerLevels
+            || best.chunkThreshold != state.parameters.chunkThreshold) {
+            state.parameters = best;
+            changed++;
+        }
+    }
+    return changed;
+}
+
+ResponseTuner::Parameters ResponseTuner::getParameters(const SyncTree* subtree) const
+{
+    std::unique_lock<std::mutex> lck(this->tunerMutex);
+    auto it = subtrees.find(subtree);
+    return it != subtrees.end() ? it->second.parameters : defaults;
+}
+
+double ResponseTuner::getAverageDescentDepth() const
+{
+    std::unique_lock<std::mutex> lck(this->tunerMutex);
+    double depth = 0;
+    unsigned long descents = 0;
+    for (const auto& entry : subtrees) {
+        depth += entry.second.descentDepth * entry.second.descents;
+        descents += entry.second.descents;
+    }
+    return descents > 0 ? depth / descents : 0;
+}
+
+void ResponseTuner::estimate(const SubtreeState& state, double changes, unsigned remainingLevels,
+    const Parameters& parameters, double& bytes, double& roundTrips) const
+{
+    bytes = PACKET_OVERHEAD;
+    roundTrips = 1;
+    if (changes <= 0) {
+        return;
+    }
+
+    // Same decision as SyncTree::syncRequest(..)
+    if (remainingLevels == 0 || parameters.lowerLevels <= 1 || changes <= parameters.chunkThreshold) {
+        bytes += changes * state.bytesPerChunk;
+        return;
+    }
+
+    // Hash values of the level lowerLevels - 1 below the subtree, the changed children are requested afterwards
+    const unsigned step = std::min(parameters.lowerLevels - 1, remainingLevels);
+    const double children = std::pow(4, step);
+    // Expected number of children containing at least one of the uniformly distributed changes
+    const double changedChildren = children * (1 - std::pow(1 - 1 / children, changes));
+
+    double childBytes, childRoundTrips;
+    estimate(state, changes / changedChildren, remainingLevels - step, parameters, childBytes, childRoundTrips);
+    bytes += children * state.bytesPerHash + changedChildren * childBytes;
+    roundTrips += childRoundTrips;
+}
+
+}
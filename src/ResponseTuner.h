@@ -0,0 +1,107 @@
+#ifndef QUADTREESYNCEVALUATION_RESPONSETUNER_H
+#define QUADTREESYNCEVALUATION_RESPONSETUNER_H
+
+#include <map>
+#include <mutex>
+
+namespace quadtree {
+
+class SyncTree;
+
+/**
+ * Online tuning of the response parameters (lowerLevels and chunkThreshold) of the producer, separately for each own
+ * subtree on the request level.
+ *
+ * The tuner observes the number of changes per publish tick, the sizes of the sent responses and the depth of the
+ * subtree requests of consumers descending the tree. After every tick, it estimates the bytes and round trips a
+ * consumer needs to synchronize each subtree with every candidate parameter set and picks the one minimizing
+ * bytes x round trips. Hot subtrees end up with few large chunk responses, cold ones with compact hash responses.
+ */
+class ResponseTuner {
+
+public:
+    struct Parameters {
+        unsigned lowerLevels;
+        unsigned chunkThreshold;
+    };
+
+    /**
+     * @param defaults Parameters of subtrees without observations
+     */
+    explicit ResponseTuner(Parameters defaults);
+
+    /**
+     * Adds a subtree to tune the parameters for
+     * @param remainingLevels Number of tree levels below the subtree
+     */
+    void addSubtree(const SyncTree* subtree, unsigned remainingLevels);
+
+    /**
+     * Adds the number of changed chunks of the subtree in the last publish tick
+     */
+    void addTickChanges(const SyncTree* subtree, size_t changes);
+
+    /**
+     * Adds a sent response of the subtree or one of its descendants, which updates the bytes per chunk and hash value
+     * estimated for the subtree
+     * @param chunkData True if the response contains chunks, false if it contains hash values
+     * @param items Number of chunks or hash values
+     * @param bytes Size of the response content on the wire
+     */
+    void addResponse(const SyncTree* subtree, bool chunkData, size_t items, size_t bytes);
+
+    /**
+     * Adds a request for a descendant of the subtree
+     * @param depth Number of levels between the subtree and the requested one
+     */
+    void addDescent(const SyncTree* subtree, unsigned depth);
+
+    /**
+     * Picks the parameters of all subtrees according to the observations so far
+     * @param ticksPerRequest Average number of publish ticks between two requests of a consumer
+     * @return Number of subtrees whose parameters changed
+     */
+    unsigned retune(double ticksPerRequest);
+
+    /**
+     * Returns the parameters for responses of the subtree or of its descendants
+     */
+    Parameters getParameters(const SyncTree* subtree) const;
+
+    double getAverageDescentDepth() const;
+
+    // Name, signature and other fields of a Data packet
+    static constexpr double PACKET_OVERHEAD = 300;
+
+protected:
+    struct SubtreeState {
+        unsigned remainingLevels;
+        Parameters parameters;
+        double changesPerTick = 0;
+        double descentDepth = 0;
+        unsigned long descents = 0;
+        // Compressed size of a chunk and a hash value in responses of the subtree
+        double bytesPerChunk = 20;
+        double bytesPerHash = 9;
+    };
+
+    /**
+     * Estimates the bytes and round trips needed to synchronize a subtree with the given number of changes
+     */
+    void estimate(const SubtreeState& state, double changes, unsigned remainingLevels, const Parameters& parameters,
+        double& bytes, double& roundTrips) const;
+
+    // Weight of new observations
+    static constexpr double ALPHA = 0.25;
+    // New parameters are only picked if they are estimated to be cheaper by this factor
+    static constexpr double HYSTERESIS = 0.9;
+    static const unsigned MAX_LOWER_LEVELS = 4;
+
+    mutable std::mutex tunerMutex;
+    Parameters defaults;
+    std::map<const SyncTree*, SubtreeState> subtrees;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_RESPONSETUNER_H
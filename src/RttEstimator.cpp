@@ -0,0 +1,35 @@
+#include "RttEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace quadtree {
+
+constexpr double RttEstimator::ALPHA;
+constexpr double RttEstimator::BETA;
+constexpr double RttEstimator::K;
+constexpr double RttEstimator::G;
+
+RttEstimator::RttEstimator(double initialRto, double minRto, double maxRto)
+    : minRto(minRto)
+    , maxRto(maxRto)
+    , rto(initialRto)
+{
+}
+
+void RttEstimator::addMeasurement(double rtt)
+{
+    if (!hasSample) {
+        smoothedRtt = rtt;
+        rttVariation = rtt / 2;
+        hasSample = true;
+    } else {
+        rttVariation = (1 - BETA) * rttVariation + BETA * std::abs(smoothedRtt - rtt);
+        smoothedRtt = (1 - ALPHA) * smoothedRtt + ALPHA * rtt;
+    }
+    rto = std::min(maxRto, std::max(minRto, smoothedRtt + std::max(G, K * rttVariation)));
+}
+
+void RttEstimator::backoffRto() { rto = std::min(maxRto, rto * 2); }
+
+}
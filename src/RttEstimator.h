@@ -0,0 +1,53 @@
+#ifndef QUADTREESYNCEVALUATION_RTTESTIMATOR_H
+#define QUADTREESYNCEVALUATION_RTTESTIMATOR_H
+
+namespace quadtree {
+
+/**
+ * Round trip time and retransmission timeout estimation according to RFC 6298. Samples must only be taken from
+ * Interests which were not retransmitted (Karn's algorithm).
+ */
+class RttEstimator {
+
+public:
+    /**
+     * @param initialRto Retransmission timeout until the first sample was taken, in milliseconds
+     * @param minRto Lower bound of the retransmission timeout in milliseconds
+     * @param maxRto Upper bound of the retransmission timeout in milliseconds
+     */
+    RttEstimator(double initialRto, double minRto, double maxRto);
+
+    /**
+     * Adds a round trip time sample in milliseconds and resets the backoff
+     */
+    void addMeasurement(double rtt);
+
+    /**
+     * Doubles the retransmission timeout after a timeout
+     */
+    void backoffRto();
+
+    double getRto() const { return rto; }
+
+    double getSmoothedRtt() const { return smoothedRtt; }
+
+    double getRttVariation() const { return rttVariation; }
+
+protected:
+    static constexpr double ALPHA = 0.125;
+    static constexpr double BETA = 0.25;
+    static constexpr double K = 4;
+    // Clock granularity in milliseconds
+    static constexpr double G = 1;
+
+    double minRto;
+    double maxRto;
+    double rto;
+    double smoothedRtt = 0;
+    double rttVariation = 0;
+    bool hasSample = false;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_RTTESTIMATOR_H
@@ -0,0 +1,28 @@
+#include "SegmentWindow.h"
+
+#include <algorithm>
+
+namespace quadtree {
+
+SegmentWindow::SegmentWindow(uint64_t finalSegment, size_t windowSize, unsigned maxRetries)
+    : finalSegment(finalSegment)
+    , windowSize(std::max((size_t)1, windowSize))
+    , maxRetries(maxRetries)
+{
+}
+
+bool SegmentWindow::receive(uint64_t segment) { return pending.erase(segment) > 0; }
+
+std::vector<uint64_t> SegmentWindow::takeNextSegments()
+{
+    std::vector<uint64_t> segments;
+    while (pending.size() < windowSize && nextSegment <= finalSegment) {
+        segments.push_back(nextSegment);
+        pending.insert(nextSegment++);
+    }
+    return segments;
+}
+
+bool SegmentWindow::retry(uint64_t segment) { return ++retries[segment] <= maxRetries; }
+
+}
@@ -0,0 +1,60 @@
+#ifndef QUADTREESYNCEVALUATION_SEGMENTWINDOW_H
+#define QUADTREESYNCEVALUATION_SEGMENTWINDOW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace quadtree {
+
+/**
+ * Consumer side state of fetching the segments of a segmented response. The first segment is received as answer to
+ * the sync request, the others are requested with a window of Interests in flight. Timed out segments are requested
+ * again a limited number of times.
+ */
+class SegmentWindow {
+
+public:
+    /**
+     * @param finalSegment Number of the last segment of the response
+     * @param windowSize Maximum number of segment Interests in flight, at least one segment is always requested
+     * @param maxRetries Maximum number of retransmissions per segment
+     */
+    SegmentWindow(uint64_t finalSegment, size_t windowSize, unsigned maxRetries);
+
+    /**
+     * Marks a requested segment as received
+     * @return False if the segment was not requested or already received
+     */
+    bool receive(uint64_t segment);
+
+    /**
+     * Returns the segments to request next to fill the window, they are pending afterwards
+     */
+    std::vector<uint64_t> takeNextSegments();
+
+    /**
+     * Records a timeout of a segment
+     * @return True if the segment should be requested again, false if the fetch has to be aborted
+     */
+    bool retry(uint64_t segment);
+
+    /**
+     * Returns true if all segments were received
+     */
+    bool isComplete() const { return pending.empty() && nextSegment > finalSegment; }
+
+protected:
+    uint64_t finalSegment;
+    size_t windowSize;
+    unsigned maxRetries;
+    uint64_t nextSegment = 1;
+    std::set<uint64_t> pending;
+    std::map<uint64_t, unsigned> retries;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_SEGMENTWINDOW_H
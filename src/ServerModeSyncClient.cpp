@@ -3,11 +3,13 @@
 //
 
 #include "ServerModeSyncClient.h"
+#include "proto/SyncRequest.pb.h"
 
-void quadtree::ServerModeSyncClient::submitChange(const quadtree::Point& changedPoint, unsigned numChanges)
+quadtree::Chunk* quadtree::ServerModeSyncClient::submitChange(const quadtree::Point& changedPoint, unsigned numChanges)
 {
-    const Chunk& chunk(*world.change(changedPoint.x, changedPoint.y));
-    logger.logChunkUpdateProduced(chunk, numChanges);
+    Chunk* chunk = world.change(changedPoint.x, changedPoint.y);
+    logger.logChunkUpdateProduced(*chunk, numChanges);
+    return chunk;
 }
 
 void quadtree::ServerModeSyncClient::startSynchronization()
@@ -27,6 +29,9 @@ void quadtree::ServerModeSyncClient::startSynchronization()
         }
     }
 
+    startResponsePrecomputation();
+    collectRemoteRegions();
+
     // This thread applies changes from CSV file, NOT the producer
     this->publisherThread = std::thread(&ServerModeSyncClient::applyChangesOverTime, this);
 
@@ -39,19 +44,14 @@ void quadtree::ServerModeSyncClient::startSynchronization()
         ndn::RegisterPrefixSuccessCallback(), std::bind(&ServerModeSyncClient::onRegisterFailed, this, _1, _2));
 
     // Start process which requests changes from remote servers
-    for (SyncTree* remoteRegion : this->remoteSyncTrees) {
-        std::thread consumerThread = std::thread(&ServerModeSyncClient::synchronizeRemoteRegion, this, remoteRegion);
-        this->consumerthreads.push_back(std::move(consumerThread));
-    }
+    startRemoteRegionSynchronization();
 
     spdlog::info("ServerModeSyncClient Started -- Zone:" + ownRegionName.toUri());
 
-    // This method should be blocking -- calling Face.processEvents
-    while (this->isRunning) {
-        this->face.processEvents();
-        usleep(1000);
-    }
+    // This method should be blocking -- all consumer timers run on the face's io_service until it is shut down
+    this->face.processEvents(ndn::time::milliseconds::zero(), true);
 }
+
 void quadtree::ServerModeSyncClient::applyChangesOverTime()
 {
 
@@ -68,120 +68,621 @@ void quadtree::ServerModeSyncClient::applyChangesOverTime()
                 ownChunks.push_back(chunk);
             }
         }
+        std::vector<size_t> previousHashes;
         {
             std::unique_lock<std::mutex> lck(this->treeAccessMutex);
 
+            std::vector<Chunk*> changedChunks;
             for (const auto& chunk : ownChunks) {
-                this->submitChange(chunk.pos, ownChunks.size());
+                changedChunks.push_back(this->submitChange(chunk.pos, ownChunks.size()));
+            }
+            for (SyncTree* subtree : this->ownRequestLevelSubtrees) {
+                previousHashes.push_back(subtree->getHash());
+            }
+            this->publishRevision++;
+            this->world.reHash(false, this->publishRevision);
+            if (this->options.manifestSigning) {
+                // No responses are computed for the previous revision anymore
+                manifestStore.seal(this->publishRevision - 1);
+            }
+            if (this->options.sessions || this->options.revisionRequests) {
+                changeJournal.addRevision(this->publishRevision, changedChunks);
             }
-            this->world.reHash();
 
             // Log the time when the tree was rehashed
             auto now = std::chrono::system_clock::now();
             auto duration = now.time_since_epoch();
             this->last_publish_timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
         }
+        if (this->options.autoTune) {
+            tuneResponseParameters(ownChunks);
+        }
+        // Responses of the previous revision are outdated
+        this->responseCache.invalidate(this->publishRevision);
+        if (this->options.manifestSigning) {
+            signManifest(this->publishRevision - 1);
+        }
+        if (this->options.longPolling) {
+            this->face.getIoService().post([this] { answerPendingInterests(); });
+        }
+        if (this->options.digestHeartbeat) {
+            this->face.getIoService().post([this] { sendDigestHeartbeat(); });
+        }
+        if (this->options.precomputeResponses) {
+            schedulePrecomputation(previousHashes);
+        }
 
         std::this_thread::sleep_until(nextChangePublication);
         nextChangePublication += std::chrono::milliseconds(ServerModeSyncClient::SLEEP_TIME_MS);
     }
     spdlog::info("All changes applied, killing application");
 
+    // The precomputation thread stops before its counters are logged
+    {
+        std::unique_lock<std::mutex> lck(this->precomputationMutex);
+        this->isRunning = false;
+    }
+    this->precomputationCondition.notify_one();
+    if (this->precomputationThread.joinable()) {
+        this->precomputationThread.join();
+    }
+
     storeLogValues();
 
     // Close application when trace ended
-    this->isRunning = false;
     usleep(1000);
     this->face.shutdown();
     exit(0);
 }
 
-void quadtree::ServerModeSyncClient::synchronizeRemoteRegion(quadtree::SyncTree* subtree)
+void quadtree::ServerModeSyncClient::startResponsePrecomputation()
+{
+    for (SyncTree* subtree : world.enumerateLowerLevel(initialRequestLevel)) {
+        if (subtree != nullptr && responsibleArea.isOverlapping(subtree->getArea())
+            && subtree->getLevel() >= ownSubtree->getLevel()) {
+            ownRequestLevelSubtrees.push_back(subtree);
+        }
+    }
+    if (ownRequestLevelSubtrees.empty()) {
+        // The own region lies below the request level
+        ownRequestLevelSubtrees.push_back(ownSubtree);
+    }
+    if (this->options.autoTune) {
+        for (SyncTree* subtree : ownRequestLevelSubtrees) {
+            responseTuner.addSubtree(subtree, subtree->getMaxLevel() - subtree->getLevel());
+        }
+    }
+
+    if (this->options.precomputeResponses) {
+        spdlog::info("Precompute responses for " + std::to_string(ownRequestLevelSubtrees.size()) + " subtrees");
+        this->precomputationThread = std::thread(&ServerModeSyncClient::precomputeResponses, this);
+    }
+}
+
+void quadtree::ServerModeSyncClient::tuneResponseParameters(const std::vector<Chunk>& ownChunks)
+{
+    for (SyncTree* subtree : ownRequestLevelSubtrees) {
+        size_t changes = 0;
+        for (const auto& chunk : ownChunks) {
+            if (subtree->getArea().isPointInRectangle(chunk.pos)) {
+                changes++;
+            }
+        }
+        responseTuner.addTickChanges(subtree, changes);
+    }
+
+    // Consumers request the changes of several ticks at once if they poll less frequently
+    const double ticksPerRequest = (double)this->syncRequestInterval / ServerModeSyncClient::SLEEP_TIME_MS;
+    unsigned changed = responseTuner.retune(ticksPerRequest);
+    if (changed > 0) {
+        tuned_parameter_changes += changed;
+        spdlog::debug("Changed response parameters of " + std::to_string(changed) + " subtrees");
+    }
+}
+
+quadtree::SyncTree* quadtree::ServerModeSyncClient::findTuningSubtree(SyncTree* subtree) const
+{
+    for (SyncTree* current = subtree; current != nullptr; current = current->getParent()) {
+        if (std::find(ownRequestLevelSubtrees.begin(), ownRequestLevelSubtrees.end(), current)
+            != ownRequestLevelSubtrees.end()) {
+            return current;
+        }
+    }
+    return nullptr;
+}
+
+quadtree::ResponseTuner::Parameters quadtree::ServerModeSyncClient::getResponseParameters(SyncTree* subtree) const
 {
+    if (!this->options.autoTune) {
+        return { this->lowerLevels, this->chunkThreshold };
+    }
+    return responseTuner.getParameters(findTuningSubtree(subtree));
+}
+
+void quadtree::ServerModeSyncClient::schedulePrecomputation(const std::vector<size_t>& previousHashes)
+{
+    {
+        std::unique_lock<std::mutex> lck(this->precomputationMutex);
+        // Jobs of the previous tick which are not done yet are outdated
+        this->precomputationJobs.clear();
+
+        std::unique_lock<std::mutex> treeLck(this->treeAccessMutex);
+        for (unsigned i = 0; i < ownRequestLevelSubtrees.size(); i++) {
+            SyncTree* subtree = ownRequestLevelSubtrees[i];
+            if (subtree->getHash() != previousHashes[i]) {
+                this->precomputationJobs.push_back({ subtree, previousHashes[i], this->publishRevision });
+            }
+        }
+    }
+    this->precomputationCondition.notify_one();
+}
 
-    auto nextRequest = std::chrono::system_clock::now() + std::chrono::milliseconds(this->syncRequestInterval);
+void quadtree::ServerModeSyncClient::precomputeResponses()
+{
     while (this->isRunning) {
+        PrecomputationJob job {};
+        {
+            std::unique_lock<std::mutex> lck(this->precomputationMutex);
+            this->precomputationCondition.wait(
+                lck, [this] { return !this->precomputationJobs.empty() || !this->isRunning; });
+            if (!this->isRunning) {
+                return;
+            }
+            job = this->precomputationJobs.front();
+            this->precomputationJobs.pop_front();
+        }
+        if (job.revision != this->publishRevision) {
+            continue; // A newer tick was published in the meantime
+        }
 
-        // Construct name and issue Interest
-        ndn::Name subtreeName;
-        std::string subtreeNameNoHash;
+        ndn::Name subtreeName(worldPrefix);
         {
             std::unique_lock<std::mutex> lck(this->treeAccessMutex);
-            subtreeName = subtree->subtreeToName(true);
-            subtreeNameNoHash = worldPrefix + subtree->subtreeToName(false).toUri();
+            subtreeName.append(job.subtree->subtreeToName());
         }
-        ndn::Name subtreeRequestName(worldPrefix);
-        subtreeRequestName.append(subtreeName);
+        ndn::Name dataName(subtreeName);
+        dataName.append("h").appendNumber(job.since);
 
-        ndn::Interest subtreeRequest(subtreeRequestName);
-        subtreeRequest.setMustBeFresh(true);
-        //        subtreeRequest.setCanBePrefix(false);
-        subtreeRequest.setInterestLifetime(boost::chrono::milliseconds(this->syncRequestInterval));
+        // Nobody is waiting for the response yet, it is only stored in the cache
+        ResponseCache::Key key(subtreeName, job.since, job.revision);
+        if (responseCache.fetchOrJoin(key, [](const ResponseCache::Segments&) {})) {
+            if (!createSyncResponseData(job.subtree, dataName, job.since, job.revision,
+                    [this, key](const ResponseCache::Segments& segments) {
+                        this->responseCache.complete(key, segments);
+                    })) {
+                // A newer tick was published after the check above, drop the job
+                responseCache.complete(key, {});
+                continue;
+            }
+            this->precomputed_responses++;
+            spdlog::trace("Precomputed response " + dataName.toUri());
+        }
+    }
+}
+
+void quadtree::ServerModeSyncClient::startRemoteRegionSynchronization()
+{
+    if (this->options.sessions) {
+        // Distinguishes the sessions of consumers after a restart as well, 0 stands for no session
+        std::random_device device;
+        std::mt19937_64 engine(((uint64_t)device() << 32) | device());
+        do {
+            sessionId = engine();
+        } while (sessionId == 0);
+    }
+    if (this->options.digestHeartbeat) {
+        this->face.setInterestFilter(ndn::Name(worldPrefix).append(DIGEST_HEARTBEAT_COMPONENT),
+            std::bind(&ServerModeSyncClient::onDigestHeartbeatReceived, this, _1, _2),
+            ndn::RegisterPrefixSuccessCallback(), std::bind(&ServerModeSyncClient::onRegisterFailed, this, _1, _2));
+    }
 
-        spdlog::debug("Express Interest for " + subtreeRequestName.toUri());
-        this->face.expressInterest(subtreeRequest,
-            std::bind(&ServerModeSyncClient::onSubtreeSyncResponseReceived, this, _1, _2),
-            std::bind(&ServerModeSyncClient::onNack, this, _1, _2),
-            std::bind(&ServerModeSyncClient::onTimeout, this, _1));
+    auto now = std::chrono::system_clock::now();
+    for (auto& entry : remoteRegions) {
+        RemoteRegion& region = entry.second;
+        if (this->options.snapshotBootstrap) {
+            requestSnapshot(region);
+        } else {
+            startRegionSynchronization(region, now);
+        }
+    }
+}
 
-        long sleep_time = this->syncRequestInterval;
-        // Calculate how long the response to the last interest took
-        {
-            std::unique_lock<std::mutex> lck(this->runtimeMemoryMutex);
-            if (received_data_runtimes.find(subtreeNameNoHash) != received_data_runtimes.end()) {
-                long duration = received_data_runtimes[subtreeNameNoHash];
-                spdlog::trace("Received sync data " + std::to_string(duration) + "ms after publishing");
-                // We expect the interest taking about 100ms, if it takes significantly longer, try correcting the time
-                // when next interest is sent
-                if (SLEEP_TIME_MS == this->syncRequestInterval) {
-                    if (duration > 200 && duration < 500) {
-                        spdlog::trace("Received sync response in " + std::to_string(duration)
-                            + "ms -- Adapting Interest issuing time");
-                        sleep_time = 200; // Just a hack
-                    } else if (duration > 100) {
-                        spdlog::trace("Received sync response in " + std::to_string(duration)
-                            + "ms -- Adapting Interest issuing time");
-                        sleep_time = 400;
-                    }
-                }
-                received_data_runtimes.erase(subtreeNameNoHash);
+void quadtree::ServerModeSyncClient::startRegionSynchronization(
+    RemoteRegion& region, std::chrono::system_clock::time_point firstRequest)
+{
+    if (this->options.longPolling) {
+        expressLongPollInterest(region);
+    } else if (firstRequest > std::chrono::system_clock::now()) {
+        region.nextRequest = firstRequest;
+        scheduleSyncRequest(region);
+    } else {
+        region.nextRequest = firstRequest;
+        sendSyncRequest(region);
+    }
+}
+
+void quadtree::ServerModeSyncClient::requestSnapshot(RemoteRegion& region)
+{
+    ndn::Name snapshotName(worldPrefix);
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        snapshotName.append(region.subtree->subtreeToName());
+    }
+    snapshotName.append(SNAPSHOT_COMPONENT);
+    ndn::Interest snapshotRequest(snapshotName);
+    snapshotRequest.setMustBeFresh(true);
+    snapshotRequest.setCanBePrefix(true);
+
+    spdlog::debug("Express Interest for snapshot " + snapshotName.toUri());
+    RemoteRegion* regionPtr = &region;
+    this->face.expressInterest(snapshotRequest,
+        [this, regionPtr](const ndn::Interest& interest, const ndn::Data& data) {
+            received_snapshots++;
+            // The remaining segments are fetched before the next poll is due
+            startRegionSynchronization(
+                *regionPtr, std::chrono::system_clock::now() + std::chrono::milliseconds(this->syncRequestInterval));
+            onSubtreeSyncResponseReceived(interest, data);
+        },
+        [this, regionPtr](const ndn::Interest& interest, const ndn::lp::Nack&) {
+            failed_snapshots++;
+            startRegionSynchronization(*regionPtr, std::chrono::system_clock::now());
+        },
+        [this, regionPtr](const ndn::Interest& interest) {
+            spdlog::debug("Snapshot request " + interest.getName().toUri() + " timed out, descend level by level");
+            failed_snapshots++;
+            startRegionSynchronization(*regionPtr, std::chrono::system_clock::now());
+        });
+}
+
+void quadtree::ServerModeSyncClient::sendSyncRequest(RemoteRegion& region)
+{
+    if (region.activity.isPolledByPeer()) {
+        // The producer of the region polls this client and sends its state along
+        skipped_passive_polls++;
+    } else if (this->options.digestHeartbeat && region.activity.hasRecentHeartbeat()) {
+        // Changes of the region are announced by the heartbeats of its producer
+        skipped_heartbeat_polls++;
+    } else if (this->options.congestionControl && !region.congestionWindow.allows(getOutstandingInterests(region))) {
+        // The next poll covers the changes as well
+        spdlog::debug("Congestion window of " + region.name.toUri() + " is full, skipping poll");
+        deferred_polls++;
+    } else {
+        expressPollInterest(region);
+    }
+
+    // The next Interest should arrive right after the producer published the changes of the next interval
+    region.nextRequest
+        = region.phase.alignSendTime(region.nextRequest + std::chrono::milliseconds(getPollInterval(region)));
+    scheduleSyncRequest(region);
+}
+
+void quadtree::ServerModeSyncClient::expressPollInterest(RemoteRegion& region)
+{
+    // Construct name and issue Interest
+    ndn::Name subtreeRequestName(worldPrefix);
+    PeerState peerState;
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        appendSubtreeState(region.subtree, subtreeRequestName);
+        appendSessionComponents(region, region.subtree, subtreeRequestName);
+        if (this->options.bidirectionalSync) {
+            subtreeRequestName.append(PEER_EXCHANGE_COMPONENT);
+            peerState.set_region(ndn::Name(worldPrefix).append(ownSubtree->subtreeToName()).toUri());
+            peerState.set_hash(ownSubtree->getHash());
+        }
+    }
+
+    ndn::Interest subtreeRequest(subtreeRequestName);
+    if (peerState.has_region()) {
+        // The producer learns whether it has to request this client's region
+        std::string parameters = peerState.SerializeAsString();
+        subtreeRequest.setApplicationParameters(reinterpret_cast<const uint8_t*>(parameters.data()), parameters.size());
+    }
+    subtreeRequest.setMustBeFresh(true);
+    // The response is named by its revision and segment number
+    subtreeRequest.setCanBePrefix(true);
+    subtreeRequest.setInterestLifetime(boost::chrono::milliseconds(this->syncRequestInterval));
+
+    spdlog::debug("Express Interest for " + subtreeRequestName.toUri());
+    RemoteRegion* regionPtr = &region;
+    auto sent = std::chrono::steady_clock::now();
+    region.pollOutstanding = true;
+    this->face.expressInterest(subtreeRequest,
+        [this, regionPtr, sent](const ndn::Interest& interest, const ndn::Data& data) {
+            auto elapsed = std::chrono::steady_clock::now() - sent;
+            auto rtt = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+            regionPtr->phase.addRttSample(rtt);
+            regionPtr->rtt.addMeasurement(rtt);
+            regionPtr->pollOutstanding = false;
+            regionPtr->congestionWindow.increase();
+            onSubtreeSyncResponseReceived(interest, data);
+        },
+        [this, regionPtr](const ndn::Interest& interest, const ndn::lp::Nack& nack) {
+            regionPtr->pollOutstanding = false;
+            onNack(interest, nack);
+            if (nack.getReason() == ndn::lp::NackReason::CONGESTION) {
+                onCongestionSignal(*regionPtr);
+            } else if (nack.getReason() == UNCHANGED_NACK_REASON && this->options.adaptivePolling
+                && getPollInterval(*regionPtr) < this->options.maxPollInterval) {
+                // The producer confirmed that the region is unchanged
+                regionPtr->idlePolls++;
             }
+            pumpRequestPipeline(*regionPtr);
+        },
+        [this, regionPtr](const ndn::Interest& interest) {
+            regionPtr->pollOutstanding = false;
+            // The poll may have been lost, so the poll interval is kept. The producer does not answer while the
+            // region is unchanged, so this is no sign of congestion either.
+            onTimeout(interest);
+            pumpRequestPipeline(*regionPtr);
+        });
+    if (region.idlePolls > 0) {
+        backed_off_polls++;
+    }
+}
+
+void quadtree::ServerModeSyncClient::appendSubtreeState(SyncTree* subtree, ndn::Name& name)
+{
+    // All requesters in sync ask for the same revision, so the response can be served from in-network caches
+    if (this->options.revisionRequests && subtree->getRemoteRevision() > 0) {
+        name.append(subtree->subtreeToName()).append(REVISION_COMPONENT).appendNumber(subtree->getRemoteRevision());
+        revision_requests++;
+    } else {
+        name.append(subtree->subtreeToName(true));
+    }
+}
+
+void quadtree::ServerModeSyncClient::appendSessionComponents(
+    const RemoteRegion& region, SyncTree* subtree, ndn::Name& name) const
+{
+    if (!this->options.sessions) {
+        return;
+    }
+    auto acknowledged = region.acknowledgedRevisions.find(subtree);
+    name.append(SESSION_COMPONENT)
+        .appendNumber(sessionId)
+        .appendNumber(acknowledged != region.acknowledgedRevisions.end() ? acknowledged->second : 0);
+}
+
+void quadtree::ServerModeSyncClient::onDigestHeartbeatReceived(
+    const ndn::InterestFilter&, const ndn::Interest& interest)
+{
+    DigestHeartbeat heartbeat;
+    if (!interest.hasApplicationParameters()
+        || !heartbeat.ParseFromArray(
+            interest.getApplicationParameters().value(), interest.getApplicationParameters().value_size())) {
+        spdlog::error("Invalid digest heartbeat " + interest.getName().toUri());
+        return;
+    }
+    received_heartbeats++;
+
+    for (const auto& regionState : heartbeat.regions()) {
+        RemoteRegion* region = findRemoteRegion(ndn::Name(regionState.region()));
+        if (region == nullptr) {
+            continue; // Own region or not synchronized by this client
+        }
+        region->activity.addHeartbeat();
+
+        size_t hash;
+        {
+            std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+            hash = region->subtree->getHash();
+        }
+        if (hash != regionState.hash()) {
+            heartbeat_requests++;
+            requestSubtree(region->subtree);
+        }
+    }
+}
+
+size_t quadtree::ServerModeSyncClient::getOutstandingInterests(const RemoteRegion& region) const
+{
+    return region.pipeline.inFlight.size() + (region.pollOutstanding ? 1 : 0);
+}
+
+void quadtree::ServerModeSyncClient::onCongestionSignal(RemoteRegion& region)
+{
+    if (!this->options.congestionControl) {
+        return;
+    }
+    if (region.congestionWindow.decrease(region.rtt.getSmoothedRtt())) {
+        congestion_window_decreases++;
+        spdlog::debug("Congestion window of " + region.name.toUri() + " decreased to "
+            + std::to_string(region.congestionWindow.getWindow()));
+    }
+}
+
+void quadtree::ServerModeSyncClient::scheduleSyncRequest(RemoteRegion& region)
+{
+    auto delay = std::max(std::chrono::milliseconds::zero(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(region.nextRequest - std::chrono::system_clock::now()));
+    spdlog::trace("Next request for " + region.name.toUri() + " in " + std::to_string(delay.count())
+        + "ms, estimated publish period " + std::to_string(region.phase.getPeriod()) + "ms");
+    RemoteRegion* regionPtr = &region;
+    region.requestTimer = scheduler.schedule(
+        ndn::time::milliseconds(delay.count()), [this, regionPtr] { sendSyncRequest(*regionPtr); });
+}
+
+long quadtree::ServerModeSyncClient::getPollInterval(const RemoteRegion& region) const
+{
+    // Doubles with every poll which did not bring a change
+    long interval = this->syncRequestInterval;
+    for (unsigned i = 0; i < region.idlePolls && interval < (long)this->options.maxPollInterval; i++) {
+        interval *= 2;
+    }
+    return std::min(interval, std::max(this->syncRequestInterval, (long)this->options.maxPollInterval));
+}
+
+void quadtree::ServerModeSyncClient::markRegionActive(RemoteRegion& region)
+{
+    if (!this->options.adaptivePolling || this->options.longPolling) {
+        return;
+    }
+
+    // Activity often spreads to adjacent regions, they return to the full rate as well
+    std::vector<RemoteRegion*> activeRegions = region.neighbours;
+    activeRegions.push_back(&region);
+    auto fullRateRequest = std::chrono::system_clock::now() + std::chrono::milliseconds(this->syncRequestInterval);
+    for (RemoteRegion* activeRegion : activeRegions) {
+        if (activeRegion->idlePolls == 0) {
+            continue;
         }
+        activeRegion->idlePolls = 0;
+        region_reactivations++;
+        if (activeRegion->nextRequest > fullRateRequest) {
+            activeRegion->nextRequest = activeRegion->phase.alignSendTime(fullRateRequest);
+            scheduleSyncRequest(*activeRegion);
+        }
+    }
+}
 
-        nextRequest += std::chrono::milliseconds(sleep_time);
+void quadtree::ServerModeSyncClient::expressLongPollInterest(RemoteRegion& region)
+{
+    if (region.longPollOutstanding) {
+        return;
+    }
 
-        std::this_thread::sleep_until(nextRequest);
+    ndn::Name subtreeRequestName(worldPrefix);
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        appendSubtreeState(region.subtree, subtreeRequestName);
     }
+    // The producer holds the Interest until the region changes
+    ndn::Interest subtreeRequest(subtreeRequestName);
+    subtreeRequest.setMustBeFresh(true);
+    subtreeRequest.setCanBePrefix(true);
+    subtreeRequest.setInterestLifetime(boost::chrono::milliseconds(this->options.longPollLifetime));
+
+    // If the response does not bring the region in sync, the region is requested again after the sync request
+    // interval, when the out of sync subtrees are fetched
+    RemoteRegion* regionPtr = &region;
+    auto retryLater = [this, regionPtr] {
+        regionPtr->requestTimer = scheduler.schedule(ndn::time::milliseconds(this->syncRequestInterval),
+            [this, regionPtr] { expressLongPollInterest(*regionPtr); });
+    };
+
+    spdlog::debug("Express long-lived Interest for " + subtreeRequestName.toUri());
+    region.longPollOutstanding = true;
+    this->face.expressInterest(subtreeRequest,
+        [this, regionPtr, retryLater](const ndn::Interest& interest, const ndn::Data& data) {
+            regionPtr->longPollOutstanding = false;
+            retryLater();
+            onSubtreeSyncResponseReceived(interest, data);
+        },
+        [this, regionPtr, retryLater](const ndn::Interest& interest, const ndn::lp::Nack& nack) {
+            regionPtr->longPollOutstanding = false;
+            retryLater();
+            onNack(interest, nack);
+        },
+        [this, regionPtr](const ndn::Interest& interest) {
+            regionPtr->longPollOutstanding = false;
+            onTimeout(interest);
+            expressLongPollInterest(*regionPtr);
+        });
 }
 
 void quadtree::ServerModeSyncClient::onSubtreeSyncResponseReceived(const ndn::Interest& interest, const ndn::Data& data)
 {
 
     spdlog::debug("Received sync update: " + interest.getName().toUri());
-    // Todo: Verify signature
+    if (!this->options.verifySignatures) {
+        onVerifiedSyncResponse(interest, data);
+        return;
+    }
+
+    // Responses of a region are verified in parallel, but applied in the order they were received
+    verificationPool.verify(remoteRegionStream(data.getName()), data, [this, interest, data](bool valid) {
+        if (!valid) {
+            spdlog::error("Invalid signature of sync response " + data.getName().toUri());
+            invalid_signature_responses++;
+            return;
+        }
+        onVerifiedSyncResponse(interest, data);
+    });
+}
+
+void quadtree::ServerModeSyncClient::onVerifiedSyncResponse(const ndn::Interest& interest, const ndn::Data& data)
+{
+    // Fetch the remaining segments before the received one is applied
+    continueSegmentFetch(data);
 
     // Todo: Decrypt packet
 
     // Log time of received data
-    std::string nameWithoutHash = interest.getName().getSubName(0, interest.getName().size() - 2).toUri();
-
     auto now = std::chrono::system_clock::now();
     auto duration = now.time_since_epoch();
     long millis = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
-    // received_data_runtimes[nameWithoutHash] = millis;
 
     // unzip und unserialize data
     char* rawData = (char*)data.getContent().value();
     std::string receivedData = std::string(rawData, data.getContent().value_size());
     std::string decompressed = GZip::decompress(receivedData);
+
+    RemoteRegion* region = findRemoteRegion(data.getName());
+    if (region != nullptr && isAggregatedRequest(data.getName(), region->name)) {
+        AggregatedSyncResponse aggregatedResponse;
+        aggregatedResponse.ParseFromString(decompressed);
+        processAggregatedSyncResponse(interest, data, aggregatedResponse, millis);
+        return;
+    }
+
     quadtree::SyncResponse response;
     response.ParseFromString(decompressed);
 
-    // Calculate difference between generation of data and time the first response was received
-    long difference = millis - response.lastpublishevent();
-    {
-        std::unique_lock<std::mutex> lck(this->runtimeMemoryMutex);
-        received_data_runtimes[nameWithoutHash] = difference;
+    // Responses signed by a manifest are only applied when their digest is listed in the verified manifest. Answers to
+    // bidirectional polls are copies signed individually.
+    if (response.has_manifest() && !isPeerExchange(data.getName()) && !isListedInManifest(data, response.manifest())) {
+        ndn::Name manifestName(response.manifest());
+        bool fetchRunning = responsesAwaitingManifest.find(manifestName) != responsesAwaitingManifest.end();
+        responsesAwaitingManifest[manifestName].push_back({ interest, data, response, millis });
+        if (!fetchRunning) {
+            fetchManifest(manifestName);
+        }
+        return;
+    }
+
+    processSyncResponse(data.getFullName(), interest, data, response, millis);
+}
+
+void quadtree::ServerModeSyncClient::processAggregatedSyncResponse(
+    const ndn::Interest& interest, const ndn::Data& data, const AggregatedSyncResponse& response, long millis)
+{
+    received_aggregated_responses++;
+    for (const auto& subtreeResponse : response.responses()) {
+        ndn::Name subtreeName(worldPrefix);
+        subtreeName.append(ndn::Name(subtreeResponse.subtree()));
+        processSyncResponse(subtreeName, interest, data, subtreeResponse.response(), millis);
+    }
+
+    // Responses which did not fit into the aggregated packet are requested with separate, segmentable Interests
+    for (const auto& omitted : response.omitted()) {
+        SyncTree* subtree;
+        {
+            std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+            try {
+                subtree = world.getSubtreeFromName(ndn::Name(omitted));
+            } catch (const std::exception& ex) {
+                spdlog::error("Omitted subtree not initialized: {}", ex.what());
+                continue;
+            }
+        }
+        RemoteRegion* region = findRemoteRegion(ndn::Name(worldPrefix).append(ndn::Name(omitted)));
+        if (region != nullptr) {
+            region->pipeline.unaggregated.insert(subtree);
+            requestSubtree(subtree);
+        }
+    }
+}
+
+void quadtree::ServerModeSyncClient::processSyncResponse(const ndn::Name& subtreeName, const ndn::Interest& interest,
+    const ndn::Data& data, const SyncResponse& response, long millis)
+{
+    // Every response tells the phase of the producer's publish events
+    RemoteRegion* region = findRemoteRegion(subtreeName);
+    if (region != nullptr) {
+        region->phase.addPublishEvent(response.lastpublishevent());
+        // Producers only answer if the region changed
+        markRegionActive(*region);
     }
 
     if (response.chunkdata()) {
@@ -205,122 +706,1271 @@ void quadtree::ServerModeSyncClient::onSubtreeSyncResponseReceived(const ndn::In
 
     // Apply the sync response to the local sync tree
     std::pair<bool, std::vector<SyncTree*>> applyResult;
+    SyncTree* subtree = nullptr;
     {
         std::unique_lock<std::mutex> lck(this->treeAccessMutex);
-        SyncTree* subtree = nullptr;
         try {
-            subtree = world.getSubtreeFromName(data.getFullName());
+            subtree = world.getSubtreeFromName(subtreeName);
         } catch (std::exception ex) {
             spdlog::error("Subtree for data packet not initialized: {}", ex.what());
             return;
         }
         applyResult = subtree->applySyncResponse(response);
     }
+    // Segments arrive in any order, the subtree is only complete once all segments of the version are applied
+    bool allSegmentsApplied = true;
+    if (data.getFinalBlock() && data.getFinalBlock()->toSegment() > 0) {
+        allSegmentsApplied = addAppliedSegment(data);
+    }
+    if (region != nullptr && applyResult.first && response.has_revision()) {
+        // The producer sends exactly the changes since this revision with the next request of the subtree
+        unsigned long& acknowledged = region->acknowledgedRevisions[subtree];
+        acknowledged = std::max(acknowledged, (unsigned long)response.revision());
+    }
+
+    // A chunk response contains all changes below the subtree, pending requests for lower subtrees are outdated
+    if (response.chunkdata()) {
+        cancelCoveredRequests(subtree);
+    }
 
     // If subtrees need to be fetched, issue Interests for Subtrees
     if (!applyResult.second.empty()) {
 
         spdlog::trace(std::to_string(applyResult.second.size()) + " subtreerequests required");
-        for (SyncTree* subtree : applyResult.second) {
-            ndn::Name subtreeRequestName = ndn::Name(worldPrefix);
-            {
-                std::unique_lock<std::mutex> lck(this->treeAccessMutex);
-                ndn::Name subtreeName(subtree->subtreeToName(true));
-                subtreeRequestName.append(subtreeName);
-            }
-            ndn::Interest subtreeRequest(subtreeRequestName);
-            subtreeRequest.setMustBeFresh(true);
-            //        subtreeRequest.setCanBePrefix(false);
-            subtreeRequest.setInterestLifetime(boost::chrono::milliseconds(ServerModeSyncClient::SLEEP_TIME_MS));
-
-            spdlog::trace("Express Interest for Subtreerequest " + subtreeRequestName.toUri());
-            this->face.expressInterest(subtreeRequest,
-                std::bind(&ServerModeSyncClient::onSubtreeSyncResponseReceived, this, _1, _2),
-                std::bind(&ServerModeSyncClient::onNack, this, _1, _2),
-                std::bind(&ServerModeSyncClient::onTimeout, this, _1));
+        for (SyncTree* subtreeToRequest : applyResult.second) {
+            requestSubtree(subtreeToRequest);
         }
 
     } else if (applyResult.first) { // Else, the tree is in sync
         spdlog::trace("Subtree " + interest.getName().toUri() + " is in sync");
+        // A region in sync waits for the next change right away
+        if (this->options.longPolling && region != nullptr && region->subtree == subtree) {
+            expressLongPollInterest(*region);
+        }
+    } else if (!allSegmentsApplied) {
+        spdlog::trace("Subtree " + interest.getName().toUri() + " waits for the remaining segments");
+    } else if (response.hashbits() > 0) {
+        // All truncated hash values matched, but the subtree differs: a collision hides the differing subtrees
+        spdlog::debug("Hash collision in " + interest.getName().toUri() + ", request full hash values");
+        requestSubtree(subtree, true);
     } else {
         spdlog::error("Subtree " + interest.getName().toUri() + " is not in sync after chunkUpdate");
     }
 }
 
-void quadtree::ServerModeSyncClient::onNack(const ndn::Interest& interest, const ndn::lp::Nack& nack)
+void quadtree::ServerModeSyncClient::requestSubtree(SyncTree* subtree, bool fullHashes)
 {
-    // Todo: How to handle NACKs?
+    ndn::Name subtreeName(worldPrefix);
+    size_t hash;
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        subtreeName.append(subtree->subtreeToName());
+        hash = subtree->getHash();
+    }
+    RemoteRegion* region = findRemoteRegion(subtreeName);
+    if (region == nullptr) {
+        spdlog::error("Subtree " + subtreeName.toUri() + " is not part of a remote region");
+        return;
+    }
+    RequestPipeline& pipeline = region->pipeline;
+    if (fullHashes) {
+        // Full hash values are only requested with plain Interests
+        pipeline.fullHashes.insert(subtree);
+        pipeline.unaggregated.insert(subtree);
+        full_hash_requests++;
+    }
 
-    std::string nackReason;
-    switch (nack.getReason()) {
-    case ndn::lp::NackReason::CONGESTION:
-        nackReason = "CONGESTION";
-        break;
-    case ndn::lp::NackReason::NONE:
-        nackReason = "NONE";
-        break;
-    case ndn::lp::NackReason::DUPLICATE:
-        nackReason = "DUPLICATE";
-        break;
-    case ndn::lp::NackReason::NO_ROUTE:
-        nackReason = "NO_ROUTE";
-        break;
+    auto inFlight = pipeline.inFlight.find(subtree);
+    if (inFlight != pipeline.inFlight.end()) {
+        if (inFlight->second.hash == hash) {
+            deduplicated_requests++;
+            return;
+        }
+        // The subtree changed locally since the request was issued, its response would be based on an old hash
+        inFlight->second.handle.cancel();
+        pipeline.inFlight.erase(inFlight);
+        cancelled_requests++;
+    }
+    if (std::find(pipeline.queued.begin(), pipeline.queued.end(), subtree) != pipeline.queued.end()) {
+        // Queued requests read the hash when they are issued
+        deduplicated_requests++;
+        return;
     }
 
-    spdlog::debug("Received Nack for " + interest.getName().toUri() + " with reason " + nackReason);
+    pipeline.queued.push_back(subtree);
+    pumpRequestPipeline(*region);
 }
 
-void quadtree::ServerModeSyncClient::onTimeout(const ndn::Interest& interest)
+void quadtree::ServerModeSyncClient::pumpRequestPipeline(RemoteRegion& region)
 {
-    // Todo: How to handle Timeouts?
+    RequestPipeline& pipeline = region.pipeline;
+    while (canIssueRequest(region, 0) && !pipeline.queued.empty()) {
+        if (this->options.aggregateRequests && expressAggregatedRequest(region)) {
+            continue;
+        }
+        SyncTree* subtree = pipeline.queued.front();
+        pipeline.queued.pop_front();
+        pipeline.unaggregated.erase(subtree);
+        const bool fullHashes = pipeline.fullHashes.erase(subtree) > 0;
 
-    spdlog::debug("Timeout for " + interest.getName().toUri());
+        ndn::Name subtreeRequestName = ndn::Name(worldPrefix);
+        size_t hash;
+        SubtreeDigests digests;
+        {
+            std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+            appendSubtreeState(subtree, subtreeRequestName);
+            hash = subtree->getHash();
+            if (fullHashes) {
+                subtreeRequestName.append(FULL_HASHES_COMPONENT);
+            }
+            appendSessionComponents(region, subtree, subtreeRequestName);
+
+            // The producer compares the lower level hash values itself, which saves a round trip per level
+            const unsigned depth = std::min({ this->options.digestDepth, (unsigned)MAX_DIGEST_DEPTH,
+                subtree->getMaxLevel() - subtree->getLevel() });
+            if (this->options.digestRequests && depth > 0) {
+                digests.set_depth(depth);
+                for (const auto& digest : subtree->getLowerLevelDigests(depth)) {
+                    digests.add_indices(digest.first);
+                    digests.add_hashes(digest.second);
+                }
+            }
+        }
+        ndn::Interest subtreeRequest(subtreeRequestName);
+        if (digests.has_depth()) {
+            std::string parameters = digests.SerializeAsString();
+            subtreeRequest.setApplicationParameters(
+                reinterpret_cast<const uint8_t*>(parameters.data()), parameters.size());
+            digest_requests++;
+        }
+        subtreeRequest.setMustBeFresh(true);
+        subtreeRequest.setCanBePrefix(true);
+        unsigned retries = takeRetransmissionCount(pipeline, subtree);
+        const auto lifetime = getRequestLifetime(region);
+        const double rto = region.rtt.getRto();
+        subtreeRequest.setInterestLifetime(lifetime);
+
+        spdlog::trace("Express Interest for Subtreerequest " + subtreeRequestName.toUri());
+        RemoteRegion* regionPtr = &region;
+        auto sent = std::chrono::steady_clock::now();
+        auto handle = this->face.expressInterest(subtreeRequest,
+            [this, regionPtr, subtree, hash, retries, sent](const ndn::Interest& interest, const ndn::Data& data) {
+                // Karn's algorithm: the response to a retransmission may belong to any of the transmissions
+                if (retries == 0) {
+                    regionPtr->rtt.addMeasurement(
+                        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - sent)
+                            .count());
+                }
+                regionPtr->congestionWindow.increase();
+                completeRequest(*regionPtr, subtree, hash);
+                onSubtreeSyncResponseReceived(interest, data);
+            },
+            [this, regionPtr, subtree, hash, retries](const ndn::Interest& interest, const ndn::lp::Nack& nack) {
+                if (nack.getReason() == ndn::lp::NackReason::CONGESTION) {
+                    onCongestionSignal(*regionPtr);
+                }
+                completeRequest(*regionPtr, subtree, hash);
+                onNack(interest, nack);
+                if (this->options.maxRetransmissions > 0 && nack.getReason() != UNCHANGED_NACK_REASON) {
+                    // The producer is reachable, but the request failed on the way. Retry after the timeout.
+                    scheduler.schedule(ndn::time::milliseconds((long)regionPtr->rtt.getRto()),
+                        [this, regionPtr, subtree, retries] { retransmitRequest(*regionPtr, subtree, retries); });
+                }
+            },
+            [this, regionPtr, subtree, hash, retries, lifetime, rto](const ndn::Interest& interest) {
+                // Producers always answer subtree requests, a timeout indicates loss if the producer had enough time
+                if (isLossTimeout(lifetime, rto)) {
+                    onCongestionSignal(*regionPtr);
+                }
+                completeRequest(*regionPtr, subtree, hash);
+                onTimeout(interest);
+                request_timeouts++;
+                if (this->options.maxRetransmissions > 0) {
+                    regionPtr->rtt.backoffRto();
+                    retransmitRequest(*regionPtr, subtree, retries);
+                }
+            });
+        pipeline.inFlight[subtree] = { hash, handle, retries };
+        max_inflight_requests = std::max(max_inflight_requests, (unsigned long)pipeline.inFlight.size());
+    }
 }
 
-void quadtree::ServerModeSyncClient::onSubtreeSyncRequestReceived(
-    const ndn::InterestFilter&, const ndn::Interest& interest)
+bool quadtree::ServerModeSyncClient::canIssueRequest(const RemoteRegion& region, size_t additional) const
 {
-    spdlog::debug("Received Interest " + interest.getName().toUri());
-    const ndn::Name& subtreeName(interest.getName());
-    SyncTree* syncTree = nullptr;
-    try {
-        syncTree = world.getSubtreeFromName(subtreeName);
-    } catch (std::exception ex) {
-        spdlog::error("Subtree for interest not initialized: {}", ex.what());
-        return;
-    }
+    const size_t inFlight = region.pipeline.inFlight.size() + additional;
+    return (this->options.requestWindow == 0 || inFlight < this->options.requestWindow)
+        && (!this->options.congestionControl
+            || region.congestionWindow.allows(getOutstandingInterests(region) + additional));
+}
 
-    size_t hash = 0;
-    if (subtreeName.get(subtreeName.size() - 2).toUri() == "h") {
-        hash = subtreeName.get(subtreeName.size() - 1).toNumber();
+unsigned quadtree::ServerModeSyncClient::takeRetransmissionCount(RequestPipeline& pipeline, SyncTree* subtree)
+{
+    unsigned retries = 0;
+    auto retransmission = pipeline.retransmissions.find(subtree);
+    if (retransmission != pipeline.retransmissions.end()) {
+        retries = retransmission->second;
+        pipeline.retransmissions.erase(retransmission);
     }
+    return retries;
+}
 
-    if (hash == syncTree->getHash()) {
-        spdlog::debug("Hash unchanged, do not answer interest.");
-        // Do not send packet when nothing is new
-        return;
+boost::chrono::milliseconds quadtree::ServerModeSyncClient::getRequestLifetime(const RemoteRegion& region) const
+{
+    if (this->options.maxRetransmissions > 0 || this->options.congestionControl) {
+        return boost::chrono::milliseconds((long)region.rtt.getRto() + ServerModeSyncClient::SLEEP_TIME_MS);
     }
+    return boost::chrono::milliseconds(ServerModeSyncClient::SLEEP_TIME_MS);
+}
 
-    SyncResponse syncResponse = syncTree->prepareSyncResponse(hash, this->lowerLevels, this->chunkThreshold);
-    syncResponse.set_lastpublishevent(this->last_publish_timestamp);
-    std::string plain = syncResponse.SerializeAsString();
-    std::string compressed = GZip::compress(plain);
-
-    // Todo: Encrypt response
+bool quadtree::ServerModeSyncClient::isLossTimeout(boost::chrono::milliseconds lifetime, double rto) const
+{
+    return lifetime.count() >= (long)rto + ServerModeSyncClient::SLEEP_TIME_MS;
+}
 
-    // Create Data packet
-    //    auto data = std::make_shared<ndn::Data>(interest.getName());
-    ndn::Data data = ndn::Data();
-    data.setName(subtreeName);
-    data.setFreshnessPeriod(boost::chrono::milliseconds(ServerModeSyncClient::SLEEP_TIME_MS));
-    data.setContent(reinterpret_cast<const uint8_t*>(compressed.data()), compressed.size());
+bool quadtree::ServerModeSyncClient::expressAggregatedRequest(RemoteRegion& region)
+{
+    RequestPipeline& pipeline = region.pipeline;
+    size_t capacity = 0;
+    while (capacity < this->options.maxAggregatedSubtrees && canIssueRequest(region, capacity)) {
+        capacity++;
+    }
+    std::vector<SyncTree*> batch = requestBundler.takeBundle(pipeline.queued, pipeline.unaggregated, capacity);
+    if (batch.empty()) {
+        return false; // A single subtree is requested with a plain Interest
+    }
 
-    // Todo: Sign response with proper cert
+    // All subtrees of a region belong to the same producer
+    SyncRequest request;
+    auto hashes = std::make_shared<std::vector<size_t>>();
+    auto retries = std::make_shared<std::vector<unsigned>>();
     {
-        std::unique_lock<std::mutex> lck(this->keyChainMutex);
-        this->keyChain.sign(data);
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        for (SyncTree* subtree : batch) {
+            SubtreeRequest* subtreeRequest = request.add_subtrees();
+            subtreeRequest->set_subtree(subtree->subtreeToName().toUri());
+            subtreeRequest->set_hash(subtree->getHash());
+            hashes->push_back(subtree->getHash());
+        }
+    }
+    for (SyncTree* subtree : batch) {
+        retries->push_back(takeRetransmissionCount(pipeline, subtree));
+    }
+    const bool retransmitted = std::any_of(retries->begin(), retries->end(), [](unsigned r) { return r > 0; });
+
+    std::string parameters = request.SerializeAsString();
+    ndn::Interest aggregatedRequest(ndn::Name(region.name).append(AGGREGATED_REQUEST_COMPONENT));
+    aggregatedRequest.setApplicationParameters(reinterpret_cast<const uint8_t*>(parameters.data()), parameters.size());
+    aggregatedRequest.setMustBeFresh(true);
+    const auto lifetime = getRequestLifetime(region);
+    const double rto = region.rtt.getRto();
+    aggregatedRequest.setInterestLifetime(lifetime);
+
+    spdlog::trace("Express aggregated Interest for " + std::to_string(batch.size()) + " subtrees of "
+        + region.name.toUri());
+    RemoteRegion* regionPtr = &region;
+    auto subtrees = std::make_shared<std::vector<SyncTree*>>(batch);
+    auto completeAll = [this, regionPtr, subtrees, hashes] {
+        for (size_t i = 0; i < subtrees->size(); i++) {
+            completeRequest(*regionPtr, (*subtrees)[i], (*hashes)[i]);
+        }
+    };
+    auto sent = std::chrono::steady_clock::now();
+    this->face.expressInterest(aggregatedRequest,
+        [this, regionPtr, completeAll, retransmitted, sent](const ndn::Interest& interest, const ndn::Data& data) {
+            if (!retransmitted) {
+                auto elapsed = std::chrono::steady_clock::now() - sent;
+                regionPtr->rtt.addMeasurement(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+            }
+            regionPtr->congestionWindow.increase();
+            completeAll();
+            onSubtreeSyncResponseReceived(interest, data);
+        },
+        [this, regionPtr, completeAll, subtrees, retries](const ndn::Interest& interest, const ndn::lp::Nack& nack) {
+            if (nack.getReason() == ndn::lp::NackReason::CONGESTION) {
+                onCongestionSignal(*regionPtr);
+            }
+            completeAll();
+            onNack(interest, nack);
+            if (this->options.maxRetransmissions > 0) {
+                scheduler.schedule(
+                    ndn::time::milliseconds((long)regionPtr->rtt.getRto()), [this, regionPtr, subtrees, retries] {
+                        for (size_t i = 0; i < subtrees->size(); i++) {
+                            retransmitRequest(*regionPtr, (*subtrees)[i], (*retries)[i]);
+                        }
+                    });
+            }
+        },
+        [this, regionPtr, completeAll, subtrees, retries, lifetime, rto](const ndn::Interest& interest) {
+            if (isLossTimeout(lifetime, rto)) {
+                onCongestionSignal(*regionPtr);
+            }
+            completeAll();
+            onTimeout(interest);
+            request_timeouts++;
+            if (this->options.maxRetransmissions > 0) {
+                regionPtr->rtt.backoffRto();
+                for (size_t i = 0; i < subtrees->size(); i++) {
+                    retransmitRequest(*regionPtr, (*subtrees)[i], (*retries)[i]);
+                }
+            }
+        });
+
+    // Cancelling a single subtree must not cancel the requests of the others, so the handle is not kept
+    for (size_t i = 0; i < batch.size(); i++) {
+        pipeline.inFlight[batch[i]] = { (*hashes)[i], ndn::PendingInterestHandle(), (*retries)[i] };
+    }
+    max_inflight_requests = std::max(max_inflight_requests, (unsigned long)pipeline.inFlight.size());
+    aggregated_requests++;
+    aggregated_subtree_requests += batch.size();
+    return true;
+}
+
+void quadtree::ServerModeSyncClient::completeRequest(RemoteRegion& region, SyncTree* subtree, size_t hash)
+{
+    RequestPipeline& pipeline = region.pipeline;
+    auto inFlight = pipeline.inFlight.find(subtree);
+    if (inFlight != pipeline.inFlight.end() && inFlight->second.hash == hash) {
+        pipeline.inFlight.erase(inFlight);
+    }
+    pumpRequestPipeline(region);
+}
+
+void quadtree::ServerModeSyncClient::retransmitRequest(RemoteRegion& region, SyncTree* subtree, unsigned retries)
+{
+    if (region.pipeline.inFlight.find(subtree) != region.pipeline.inFlight.end()) {
+        return; // The subtree was requested again in the meantime
+    }
+    if (retries >= this->options.maxRetransmissions) {
+        spdlog::debug("Giving up request for subtree after " + std::to_string(retries) + " retransmissions");
+        abandoned_requests++;
+        return;
+    }
+
+    // The request is issued with the current local hash, the subtree might have been updated in the meantime
+    region.pipeline.retransmissions[subtree] = retries + 1;
+    retransmitted_requests++;
+    requestSubtree(subtree);
+}
+
+void quadtree::ServerModeSyncClient::cancelCoveredRequests(SyncTree* subtree)
+{
+    ndn::Name subtreeName(worldPrefix);
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        subtreeName.append(subtree->subtreeToName());
+    }
+    RemoteRegion* region = findRemoteRegion(subtreeName);
+    if (region == nullptr) {
+        return;
+    }
+    RequestPipeline& pipeline = region->pipeline;
+
+    std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+    auto isCovered = [subtree](SyncTree* requested) {
+        for (SyncTree* parent = requested->getParent(); parent != nullptr; parent = parent->getParent()) {
+            if (parent == subtree) {
+                return true;
+            }
+        }
+        return false;
+    };
+    for (auto it = pipeline.inFlight.begin(); it != pipeline.inFlight.end();) {
+        if (isCovered(it->first)) {
+            it->second.handle.cancel();
+            it = pipeline.inFlight.erase(it);
+            cancelled_requests++;
+        } else {
+            ++it;
+        }
+    }
+    auto& queued = pipeline.queued;
+    size_t queuedBefore = queued.size();
+    queued.erase(std::remove_if(queued.begin(), queued.end(), isCovered), queued.end());
+    cancelled_requests += queuedBefore - queued.size();
+}
+
+void quadtree::ServerModeSyncClient::continueSegmentFetch(const ndn::Data& data)
+{
+    const ndn::Name& name = data.getName();
+    if (name.empty() || !name.get(-1).isSegment() || !data.getFinalBlock()) {
+        return;
+    }
+    const uint64_t segment = name.get(-1).toSegment();
+    const uint64_t finalSegment = data.getFinalBlock()->toSegment();
+    if (name.size() > 3 && name.get(-3).isParametersSha256Digest() && !isPeerExchange(name)) {
+        return; // Responses to digest requests fit into a single packet
+    }
+    const ndn::Name responseName = getSegmentedResponseName(name);
+
+    auto fetch = segmentFetches.find(responseName);
+    if (fetch == segmentFetches.end()) {
+        // Only the first segment, received as answer to the sync request, starts fetching the others
+        if (segment != 0 || finalSegment == 0) {
+            return;
+        }
+        received_segments++;
+        SegmentWindow window(finalSegment, this->options.segmentWindow, MAX_SEGMENT_RETRIES);
+        fetch = segmentFetches.emplace(responseName, window).first;
+    } else if (fetch->second.receive(segment)) {
+        received_segments++;
+    }
+
+    for (uint64_t nextSegment : fetch->second.takeNextSegments()) {
+        expressSegmentInterest(responseName, nextSegment);
+    }
+    if (fetch->second.isComplete()) {
+        segmentFetches.erase(fetch);
+    }
+}
+
+void quadtree::ServerModeSyncClient::expressSegmentInterest(const ndn::Name& responseName, uint64_t segment)
+{
+    // Segments of a revision never change, they do not need to be fresh
+    ndn::Interest segmentRequest(ndn::Name(responseName).appendSegment(segment));
+    segmentRequest.setInterestLifetime(boost::chrono::milliseconds(ServerModeSyncClient::SLEEP_TIME_MS));
+
+    spdlog::trace("Express Interest for segment " + segmentRequest.getName().toUri());
+    this->face.expressInterest(segmentRequest,
+        std::bind(&ServerModeSyncClient::onSubtreeSyncResponseReceived, this, _1, _2),
+        [this](const ndn::Interest& interest, const ndn::lp::Nack&) { abortSegmentFetch(interest.getName()); },
+        std::bind(&ServerModeSyncClient::onSegmentTimeout, this, _1));
+}
+
+void quadtree::ServerModeSyncClient::onSegmentTimeout(const ndn::Interest& interest)
+{
+    segment_timeouts++;
+    const ndn::Name responseName = interest.getName().getPrefix(-1);
+    const uint64_t segment = interest.getName().get(-1).toSegment();
+    auto fetch = segmentFetches.find(responseName);
+    if (fetch == segmentFetches.end()) {
+        return;
+    }
+    if (!fetch->second.retry(segment)) {
+        abortSegmentFetch(interest.getName());
+        return;
+    }
+    expressSegmentInterest(responseName, segment);
+}
+
+void quadtree::ServerModeSyncClient::abortSegmentFetch(const ndn::Name& segmentName)
+{
+    // The next sync request fetches the remaining changes
+    spdlog::error("Abort fetching segments of " + segmentName.getPrefix(-1).toUri());
+    if (segmentFetches.erase(segmentName.getPrefix(-1)) > 0) {
+        aborted_segment_fetches++;
+    }
+    appliedSegments.erase(segmentName.getPrefix(-2));
+}
+
+ndn::Name quadtree::ServerModeSyncClient::getSegmentedResponseName(const ndn::Name& segmentName)
+{
+    ndn::Name responseName = segmentName.getPrefix(-1);
+    if (responseName.size() > 2 && responseName.get(-2).isParametersSha256Digest() && isPeerExchange(responseName)) {
+        responseName = responseName.getPrefix(-3).append(responseName.get(-1));
+    }
+    return responseName;
+}
+
+bool quadtree::ServerModeSyncClient::addAppliedSegment(const ndn::Data& data)
+{
+    const ndn::Name responseName = getSegmentedResponseName(data.getName());
+    const uint64_t version = responseName.get(-1).toVersion();
+    AppliedSegments& applied = appliedSegments[responseName.getPrefix(-1)];
+    if (version < applied.version) {
+        return false; // Superseded by the segments of a newer version
+    }
+    if (version > applied.version) {
+        applied.version = version;
+        applied.segments.clear();
+    }
+    applied.segments.insert(data.getName().get(-1).toSegment());
+    if (applied.segments.size() <= data.getFinalBlock()->toSegment()) {
+        return false;
+    }
+    appliedSegments.erase(responseName.getPrefix(-1));
+    return true;
+}
+
+void quadtree::ServerModeSyncClient::collectRemoteRegions()
+{
+    std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+    // Polls of the producers back off like polls of this client
+    const long peerPollInterval
+        = std::max(this->syncRequestInterval, this->options.adaptivePolling ? (long)this->options.maxPollInterval : 0L);
+    for (SyncTree* remoteSyncTree : this->remoteSyncTrees) {
+        ndn::Name remoteRegionName(worldPrefix);
+        remoteRegionName.append(remoteSyncTree->subtreeToName());
+        remoteRegions.emplace(remoteRegionName.toUri(),
+            RemoteRegion(remoteSyncTree, remoteRegionName, SLEEP_TIME_MS, peerPollInterval));
+    }
+
+    if (this->options.bidirectionalSync) {
+        ndn::Name ownRegionName(worldPrefix);
+        ownRegionName.append(ownSubtree->subtreeToName());
+        for (auto& entry : remoteRegions) {
+            entry.second.activity.setPassive(PeerActivity::isPassiveRegion(entry.second.name, ownRegionName));
+        }
+    }
+
+    // Remote regions overlapping the neighbour areas of a region are its neighbours
+    for (auto& entry : remoteRegions) {
+        RemoteRegion& region = entry.second;
+        for (SyncTree* neighbourArea : world.getNeighboursForRectangle(region.subtree->getArea())) {
+            for (auto& other : remoteRegions) {
+                if (&other.second != &region && other.second.subtree->getArea().isOverlapping(neighbourArea->getArea())
+                    && std::find(region.neighbours.begin(), region.neighbours.end(), &other.second)
+                        == region.neighbours.end()) {
+                    region.neighbours.push_back(&other.second);
+                }
+            }
+        }
+    }
+}
+
+quadtree::ServerModeSyncClient::RemoteRegion* quadtree::ServerModeSyncClient::findRemoteRegion(const ndn::Name& name)
+{
+    for (auto& entry : remoteRegions) {
+        if (entry.second.name.isPrefixOf(name)) {
+            return &entry.second;
+        }
+    }
+    return nullptr;
+}
+
+std::string quadtree::ServerModeSyncClient::remoteRegionStream(const ndn::Name& name)
+{
+    RemoteRegion* region = findRemoteRegion(name);
+    return region != nullptr ? region->name.toUri() : name.toUri();
+}
+
+ndn::Name quadtree::ServerModeSyncClient::getOwnRegionName()
+{
+    std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+    ndn::Name ownRegionName(worldPrefix);
+    ownRegionName.append(ownSubtree->subtreeToName());
+    return ownRegionName;
+}
+
+bool quadtree::ServerModeSyncClient::isListedInManifest(const ndn::Data& data, const std::string& manifest)
+{
+    auto it = verifiedManifests.find(ndn::Name(manifest));
+    if (it == verifiedManifests.end()) {
+        return false;
+    }
+    return it->second.count(ManifestStore::digestToString(data.getFullName().get(-1))) > 0;
+}
+
+void quadtree::ServerModeSyncClient::fetchManifest(const ndn::Name& manifestName)
+{
+    ndn::Interest manifestRequest(manifestName);
+    manifestRequest.setCanBePrefix(true);
+    manifestRequest.setMustBeFresh(true);
+    // The producer answers after the publish tick of the revision ended
+    manifestRequest.setInterestLifetime(boost::chrono::milliseconds(2 * ServerModeSyncClient::SLEEP_TIME_MS));
+
+    spdlog::trace("Express Interest for manifest " + manifestName.toUri());
+    manifest_fetches++;
+    auto dropWaitingResponses = [this](const ndn::Interest& interest) {
+        spdlog::error("Could not fetch manifest " + interest.getName().toUri());
+        responsesAwaitingManifest.erase(interest.getName());
+    };
+    this->face.expressInterest(manifestRequest,
+        std::bind(&ServerModeSyncClient::onManifestReceived, this, _1, _2),
+        [dropWaitingResponses](const ndn::Interest& interest, const ndn::lp::Nack&) { dropWaitingResponses(interest); },
+        dropWaitingResponses);
+}
+
+void quadtree::ServerModeSyncClient::onManifestReceived(const ndn::Interest& interest, const ndn::Data& data)
+{
+    if (!this->options.verifySignatures) {
+        onVerifiedManifest(interest, data);
+        return;
+    }
+
+    // The only asymmetric verification per producer and tick
+    verificationPool.verify(remoteRegionStream(data.getName()), data, [this, interest, data](bool valid) {
+        if (!valid) {
+            spdlog::error("Invalid signature of manifest " + data.getName().toUri());
+            manifest_verification_failures++;
+            responsesAwaitingManifest.erase(interest.getName());
+            return;
+        }
+        onVerifiedManifest(interest, data);
+    });
+}
+
+void quadtree::ServerModeSyncClient::onVerifiedManifest(const ndn::Interest& interest, const ndn::Data& data)
+{
+    const ndn::Name& manifestName = interest.getName();
+    auto waiting = std::move(responsesAwaitingManifest[manifestName]);
+    responsesAwaitingManifest.erase(manifestName);
+
+    ResponseManifest manifest;
+    manifest.ParseFromArray(data.getContent().value(), data.getContent().value_size());
+    std::set<std::string>& digests = verifiedManifests[manifestName];
+    digests.clear();
+    digests.insert(manifest.digests().begin(), manifest.digests().end());
+
+    // Keep only the manifests of the current and the previous revision of the producer
+    const ndn::Name regionName = manifestName.getPrefix(-1);
+    const uint64_t revision = manifestName.get(-1).toNumber();
+    for (auto it = verifiedManifests.begin(); it != verifiedManifests.end();) {
+        if (regionName.isPrefixOf(it->first) && it->first.size() == manifestName.size()
+            && it->first.get(-1).toNumber() + 1 < revision) {
+            it = verifiedManifests.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    for (const auto& received : waiting) {
+        if (isListedInManifest(received.data, manifestName.toUri())) {
+            processSyncResponse(
+                received.data.getFullName(), received.interest, received.data, received.response, received.receiveTime);
+        } else {
+            spdlog::error("Response " + received.data.getName().toUri() + " is not listed in manifest");
+            responses_not_in_manifest++;
+        }
+    }
+}
+
+void quadtree::ServerModeSyncClient::onManifestRequestReceived(const ndn::Interest& interest, size_t manifestIndex)
+{
+    const ndn::Name& name = interest.getName();
+    if (name.size() <= manifestIndex + 1) {
+        return;
+    }
+    const ndn::Name manifestPrefix = name.getPrefix(manifestIndex + 2);
+    const unsigned long revision = name.get(manifestIndex + 1).toNumber();
+
+    // Requests for the manifest of the current revision are answered after the next publish tick
+    bool served = manifestStore.fetchSignedManifest(
+        revision, [this](const std::shared_ptr<const ndn::Data>& data) { this->face.put(*data); });
+    if (!served) {
+        spdlog::debug("No responses served for manifest " + manifestPrefix.toUri());
+    }
+}
+
+void quadtree::ServerModeSyncClient::signManifest(unsigned long revision)
+{
+    ResponseManifest manifest;
+    if (!manifestStore.takeManifestToSign(revision, manifest)) {
+        return;
+    }
+
+    std::string content = manifest.SerializeAsString();
+    auto data = std::make_shared<ndn::Data>(ManifestStore::manifestName(getOwnRegionName(), revision));
+    data->setFreshnessPeriod(boost::chrono::milliseconds(ServerModeSyncClient::SLEEP_TIME_MS));
+    data->setContent(reinterpret_cast<const uint8_t*>(content.data()), content.size());
+    signingPool.sign(data, [this, revision](const std::shared_ptr<ndn::Data>& data) {
+        this->manifestStore.setSignedManifest(revision, data);
+    });
+    signed_manifests++;
+}
+
+void quadtree::ServerModeSyncClient::onNack(const ndn::Interest& interest, const ndn::lp::Nack& nack)
+{
+    std::string nackReason;
+    switch (nack.getReason()) {
+    case ndn::lp::NackReason::CONGESTION:
+        nackReason = "CONGESTION";
+        congestion_nacks++;
+        break;
+    case ndn::lp::NackReason::NONE:
+        nackReason = "NONE";
+        break;
+    case ndn::lp::NackReason::DUPLICATE:
+        nackReason = "DUPLICATE";
+        break;
+    case ndn::lp::NackReason::NO_ROUTE:
+        nackReason = "NO_ROUTE";
+        break;
+    }
+
+    spdlog::debug("Received Nack for " + interest.getName().toUri() + " with reason " + nackReason);
+}
+
+void quadtree::ServerModeSyncClient::onTimeout(const ndn::Interest& interest)
+{
+    spdlog::debug("Timeout for " + interest.getName().toUri());
+}
+
+void quadtree::ServerModeSyncClient::onSubtreeSyncRequestReceived(
+    const ndn::InterestFilter&, const ndn::Interest& interest)
+{
+    spdlog::debug("Received Interest " + interest.getName().toUri());
+    // Only once, parked Interests are handled again
+    if (isPeerExchange(interest.getName())) {
+        onPeerStateReceived(interest);
+    }
+    handleSubtreeSyncRequest(interest);
+}
+
+void quadtree::ServerModeSyncClient::handleSubtreeSyncRequest(const ndn::Interest& interest)
+{
+    const ndn::Name& subtreeName(interest.getName());
+
+    // Manifests are named <region>/manifest/<revision>, see ManifestStore::manifestName(..)
+    const ndn::Name ownRegionName = getOwnRegionName();
+    const size_t manifestIndex = ownRegionName.size();
+    if (subtreeName.size() > manifestIndex && subtreeName.get(manifestIndex).toUri() == "manifest") {
+        onManifestRequestReceived(interest, manifestIndex);
+        return;
+    }
+    if (isAggregatedRequest(subtreeName, ownRegionName)) {
+        onAggregatedSyncRequestReceived(interest);
+        return;
+    }
+
+    size_t hash = 0;
+    ndn::Name subtreeNameNoHash(subtreeName);
+    ndn::Name dataName(subtreeName);
+    const size_t hashIndex = findHashComponent(subtreeName);
+    // Index of the first name component after the request, which names the revision of a segment
+    size_t revisionIndex = hashIndex + 2;
+    RequestDetails details;
+    uint64_t session = 0;
+    unsigned long acknowledgedRevision = 0;
+    if (hashIndex + 1 < subtreeName.size()) {
+        // The hash value or, for revision requests, the revision the requester knows
+        hash = subtreeName.get(hashIndex + 1).toNumber();
+        subtreeNameNoHash = subtreeName.getPrefix(hashIndex);
+        if (subtreeName.get(hashIndex).toUri() == REVISION_COMPONENT) {
+            details.revisionRequest = true;
+            subtreeNameNoHash.append(REVISION_COMPONENT);
+        }
+        // Requests with full hash values are answered with a different response
+        if (subtreeName.size() > revisionIndex && subtreeName.get(revisionIndex).toUri() == FULL_HASHES_COMPONENT) {
+            details.fullHashes = true;
+            subtreeNameNoHash.append(FULL_HASHES_COMPONENT);
+            revisionIndex++;
+        }
+        // Responses within a session depend on the revisions the requester holds
+        if (subtreeName.size() > revisionIndex + 2 && subtreeName.get(revisionIndex).toUri() == SESSION_COMPONENT) {
+            session = subtreeName.get(revisionIndex + 1).toNumber();
+            acknowledgedRevision = subtreeName.get(revisionIndex + 2).toNumber();
+            subtreeNameNoHash.append(subtreeName.getSubName(revisionIndex, 3));
+            revisionIndex += 3;
+        }
+        dataName = subtreeName.getPrefix(revisionIndex);
+    } else {
+        // Snapshot requests do not carry any state of the requester
+        for (size_t i = 0; i < subtreeName.size(); i++) {
+            if (subtreeName.get(i).toUri() == SNAPSHOT_COMPONENT) {
+                details.snapshot = true;
+                revisionIndex = i + 1;
+                subtreeNameNoHash = subtreeName.getPrefix(revisionIndex);
+                dataName = subtreeNameNoHash;
+                break;
+            }
+        }
+    }
+    // Bidirectional polls are answered with the response of a plain poll
+    const bool peerExchange = isPeerExchange(subtreeName);
+
+    // Digest requests carry the requester's lower level hash values
+    LowerLevelDigests& digests = details.digests;
+    if (!peerExchange && interest.hasApplicationParameters() && !parseLowerLevelDigests(interest, digests)) {
+        spdlog::error("Invalid digest request " + subtreeName.toUri());
+        return;
+    }
+
+    // Requests for further segments name the revision of the response
+    if (subtreeName.size() > revisionIndex + 1 && subtreeName.get(revisionIndex).isVersion()
+        && subtreeName.get(revisionIndex + 1).isSegment()) {
+        ResponseCache::Key key(subtreeNameNoHash, hash, subtreeName.get(revisionIndex).toVersion());
+        const uint64_t segment = subtreeName.get(revisionIndex + 1).toSegment();
+        bool known = responseCache.join(key, [this, segment](const ResponseCache::Segments& segments) {
+            if (segment < segments.size()) {
+                this->face.put(*segments[segment]);
+            }
+        });
+        if (!known) {
+            spdlog::debug("Segments of " + dataName.toUri() + " are outdated");
+        }
+        return;
+    }
+
+    SyncTree* syncTree = nullptr;
+    unsigned long revision;
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        try {
+            syncTree = world.getSubtreeFromName(subtreeName);
+        } catch (std::exception ex) {
+            spdlog::error("Subtree for interest not initialized: {}", ex.what());
+            return;
+        }
+        if (digests.depth > MAX_DIGEST_DEPTH || syncTree->getLevel() + digests.depth > syncTree->getMaxLevel()) {
+            spdlog::error("Digest request " + subtreeName.toUri() + " exceeds the levels of the subtree");
+            return;
+        }
+        if (session != 0 && this->options.sessions) {
+            session_requests++;
+            details.sessionRevision
+                = sessionTable.acknowledge(session, subtreeName.getPrefix(hashIndex), acknowledgedRevision);
+        }
+
+        if (this->options.autoTune) {
+            SyncTree* tuningSubtree = findTuningSubtree(syncTree);
+            if (tuningSubtree != nullptr) {
+                responseTuner.addDescent(tuningSubtree, syncTree->getLevel() - tuningSubtree->getLevel());
+            }
+        }
+
+        if (details.revisionRequest) {
+            received_revision_requests++;
+        }
+        if (details.snapshot) {
+            sent_snapshots++;
+        } else if (details.revisionRequest ? hash >= syncTree->getRevision() && hash <= this->publishRevision
+                                           : hash == syncTree->getHash()) {
+            // Do not send packet when nothing is new. Requesters knowing the revision of the subtree's last change or
+            // a later one are in sync.
+            if (this->options.longPolling) {
+                spdlog::debug("Hash unchanged, answer interest after the next change.");
+                parkInterest(interest);
+            } else if (this->options.adaptivePolling) {
+                // Consumers only back off if they know that the subtree is unchanged, a timeout may be a lost poll
+                spdlog::debug("Hash unchanged, nack interest.");
+                this->face.put(ndn::lp::Nack(interest).setReason(UNCHANGED_NACK_REASON));
+                sent_unchanged_nacks++;
+            } else {
+                spdlog::debug("Hash unchanged, do not answer interest.");
+            }
+            return;
+        }
+        revision = this->publishRevision;
+    }
+
+    // Requesters in sync send the same lower level hash values, which results in the same name including the
+    // parameters digest. The response has to be named after the Interest.
+    if (digests.depth > 0) {
+        received_digest_requests++;
+        subtreeNameNoHash = subtreeName;
+        dataName = subtreeName;
+    }
+
+    // Identical requests of the same revision are answered with the same Data packet, the first segment answers the
+    // request and announces the number of segments
+    ResponseCache::Key key(subtreeNameNoHash, hash, revision);
+    ResponseCache::ResponseCallback respond = [this](const ResponseCache::Segments& segments) {
+        this->face.put(*segments.front());
+    };
+    if (peerExchange) {
+        respond = [this, subtreeName](const ResponseCache::Segments& segments) {
+            answerPeerExchange(subtreeName, *segments.front());
+        };
+    }
+    bool computeResponse = responseCache.fetchOrJoin(key, respond);
+    if (!computeResponse) {
+        spdlog::trace("Serve response for " + subtreeName.toUri() + " from cache");
+        return;
+    }
+
+    if (!createSyncResponseData(syncTree, dataName, hash, revision,
+            [this, key](const ResponseCache::Segments& segments) { this->responseCache.complete(key, segments); },
+            details)) {
+        // A tick was published after the revision was read, answer the request for the new revision
+        responseCache.complete(key, {});
+        handleSubtreeSyncRequest(interest);
+    }
+}
+
+void quadtree::ServerModeSyncClient::sendDigestHeartbeat()
+{
+    DigestHeartbeat heartbeat;
+    ndn::Name heartbeatName(worldPrefix);
+    heartbeatName.append(DIGEST_HEARTBEAT_COMPONENT);
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        ndn::Name ownRegionName(worldPrefix);
+        ownRegionName.append(ownSubtree->subtreeToName());
+        PeerState* regionState = heartbeat.add_regions();
+        regionState->set_region(ownRegionName.toUri());
+        regionState->set_hash(ownSubtree->getHash());
+        // Heartbeats of different producers and ticks must not be aggregated by the forwarders
+        heartbeatName.append(ownSubtree->subtreeToName()).appendNumber(this->publishRevision);
+    }
+
+    // Like a StateVectorSync notification, the Interest only carries the state and is never answered
+    std::string parameters = heartbeat.SerializeAsString();
+    ndn::Interest heartbeatInterest(heartbeatName);
+    heartbeatInterest.setApplicationParameters(reinterpret_cast<const uint8_t*>(parameters.data()), parameters.size());
+    heartbeatInterest.setInterestLifetime(boost::chrono::milliseconds(ServerModeSyncClient::SLEEP_TIME_MS));
+    this->face.expressInterest(heartbeatInterest, [](const ndn::Interest&, const ndn::Data&) {},
+        [](const ndn::Interest&, const ndn::lp::Nack&) {}, [](const ndn::Interest&) {});
+    sent_heartbeats++;
+}
+
+void quadtree::ServerModeSyncClient::onPeerStateReceived(const ndn::Interest& interest)
+{
+    PeerState peerState;
+    if (!interest.hasApplicationParameters()
+        || !peerState.ParseFromArray(
+            interest.getApplicationParameters().value(), interest.getApplicationParameters().value_size())) {
+        spdlog::error("Bidirectional poll " + interest.getName().toUri() + " without valid state");
+        return;
+    }
+    RemoteRegion* region = findRemoteRegion(ndn::Name(peerState.region()));
+    if (region == nullptr) {
+        spdlog::debug("Region " + peerState.region() + " of the requester is not a remote region");
+        return;
+    }
+    received_peer_states++;
+    region->activity.addPeerState();
+
+    size_t hash;
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        hash = region->subtree->getHash();
+    }
+    if (hash != peerState.hash()) {
+        peer_state_requests++;
+        requestSubtree(region->subtree);
+    }
+}
+
+void quadtree::ServerModeSyncClient::answerPeerExchange(const ndn::Name& interestName, const ndn::Data& segment)
+{
+    // The name of the poll contains the requested hash value and the parameters digest of the sent state
+    ResponseCache::Key key(interestName, 0, segment.getName().get(-2).toVersion());
+    bool signCopy = responseCache.fetchOrJoin(
+        key, [this](const ResponseCache::Segments& segments) { this->face.put(*segments.front()); });
+    if (!signCopy) {
+        return;
+    }
+
+    // Version and segment number of the plain response
+    auto data = std::make_shared<ndn::Data>(
+        ndn::Name(interestName).append(segment.getName().get(-2)).append(segment.getName().get(-1)));
+    data->setFreshnessPeriod(boost::chrono::milliseconds(ServerModeSyncClient::SLEEP_TIME_MS));
+    if (segment.getFinalBlock()) {
+        data->setFinalBlock(*segment.getFinalBlock());
+    }
+    data->setContent(segment.getContent());
+    signingPool.sign(data, [this, key](const std::shared_ptr<ndn::Data>& data) {
+        this->responseCache.complete(key, ResponseCache::Segments({ data }));
+    });
+}
+
+bool quadtree::ServerModeSyncClient::isPeerExchange(const ndn::Name& name)
+{
+    // Requests within a session carry the session components in front of it
+    const size_t hashIndex = findHashComponent(name);
+    for (size_t i = hashIndex + 2; i < name.size(); i++) {
+        if (name.get(i).toUri() == PEER_EXCHANGE_COMPONENT) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool quadtree::ServerModeSyncClient::parseLowerLevelDigests(const ndn::Interest& interest, LowerLevelDigests& digests)
+{
+    const ndn::Block& parameters = interest.getApplicationParameters();
+    SubtreeDigests subtreeDigests;
+    if (!subtreeDigests.ParseFromArray(parameters.value(), parameters.value_size()) || subtreeDigests.depth() == 0
+        || subtreeDigests.indices_size() != subtreeDigests.hashes_size()) {
+        return false;
+    }
+    digests.depth = subtreeDigests.depth();
+    for (int i = 0; i < subtreeDigests.indices_size(); i++) {
+        digests.hashes[subtreeDigests.indices(i)] = subtreeDigests.hashes(i);
+    }
+    return true;
+}
+
+size_t quadtree::ServerModeSyncClient::getPacketBudget() const
+{
+    auto overhead = (size_t)ResponseTuner::PACKET_OVERHEAD;
+    return this->options.maxSegmentSize - std::min(this->options.maxSegmentSize, overhead);
+}
+
+quadtree::SyncResponse quadtree::ServerModeSyncClient::buildSyncResponse(SyncTree* syncTree, size_t hash,
+    size_t byteBudget, const std::string& manifest, const RequestDetails& details)
+{
+    // Fields added by the producer, the budget of the tree's part of the response is reduced by their size
+    SyncResponse producerFields;
+    producerFields.set_lastpublishevent(this->last_publish_timestamp);
+    if (!manifest.empty()) {
+        producerFields.set_manifest(manifest);
+    }
+    if (this->options.sessions) {
+        // Consumers acknowledge the revision of responses which brought the subtree in sync
+        producerFields.set_revision(this->publishRevision);
+    }
+    if (this->options.revisionRequests) {
+        // Consumers request the changes since this revision next time
+        producerFields.set_subtreerevision(this->publishRevision);
+    }
+    const size_t producerFieldsSize = producerFields.ByteSizeLong();
+    const size_t budget = byteBudget - std::min(byteBudget, producerFieldsSize);
+    ResponseTuner::Parameters parameters = getResponseParameters(syncTree);
+
+    // The journal knows the exact changes since the revision the requester holds. Larger deltas are answered like
+    // any other request, so the requester descends instead of receiving all changes at once.
+    if (details.sessionRevision > 0) {
+        std::pair<bool, std::vector<Chunk*>> changes
+            = changeJournal.getChangesSince(details.sessionRevision, syncTree->getArea());
+        if (changes.first && !changes.second.empty()
+            && (this->options.budgetedResponses || changes.second.size() <= parameters.chunkThreshold)) {
+            SyncResponse syncResponse;
+            syncResponse.set_curhash(syncTree->getHash());
+            syncResponse.set_chunkdata(true);
+            syncResponse.set_hashknown(true);
+            for (Chunk* chunk : changes.second) {
+                quadtree::ChunkData* protoChunk = syncResponse.add_chunks();
+                protoChunk->set_data(chunk->data);
+                protoChunk->set_x(chunk->pos.x);
+                protoChunk->set_y(chunk->pos.y);
+            }
+            if (!this->options.budgetedResponses || syncResponse.ByteSizeLong() <= budget) {
+                syncResponse.MergeFrom(producerFields);
+                session_delta_responses++;
+                return syncResponse;
+            }
+        }
+        journal_misses++;
+    }
+
+    const LowerLevelDigests& digests = details.digests;
+    SyncResponse syncResponse;
+    if (details.snapshot) {
+        syncResponse = syncTree->prepareSnapshotResponse(SNAPSHOT_LOWER_LEVELS);
+    } else if (digests.depth > 0) {
+        // Fewer inlined chunks until the response fits, the hash values alone always do
+        unsigned threshold = parameters.chunkThreshold;
+        syncResponse = syncTree->prepareDigestSyncResponse(digests.depth, digests.hashes, threshold);
+        while (syncResponse.ByteSizeLong() > budget && threshold > 0) {
+            threshold /= 2;
+            syncResponse = syncTree->prepareDigestSyncResponse(digests.depth, digests.hashes, threshold);
+        }
+    } else if (details.revisionRequest) {
+        syncResponse = syncTree->prepareRevisionSyncResponse(changeJournal.getChangesSince(hash, syncTree->getArea()),
+            parameters.lowerLevels, parameters.chunkThreshold);
+    } else if (this->options.budgetedResponses) {
+        syncResponse = syncTree->prepareBudgetedSyncResponse(hash, parameters.lowerLevels, budget);
+    } else {
+        syncResponse = syncTree->prepareSyncResponse(
+            hash, parameters.lowerLevels, parameters.chunkThreshold, this->options.inlineThreshold);
+    }
+    if (!details.fullHashes) {
+        // The final state is verified by curHash, which is never truncated
+        SyncTree::truncateHashValues(syncResponse, this->options.hashBits);
+    }
+    syncResponse.MergeFrom(producerFields);
+    return syncResponse;
+}
+
+bool quadtree::ServerModeSyncClient::createSyncResponseData(SyncTree* syncTree, const ndn::Name& dataName,
+    size_t hash, unsigned long revision, const ResponseCreatedCallback& onCreated, const RequestDetails& details)
+{
+    SyncResponse syncResponse;
+    SyncTree* tuningSubtree;
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        // The response is cached and named under the revision, so it has to be built from the tree of that revision
+        if (revision != this->publishRevision) {
+            return false;
+        }
+        std::string manifest;
+        if (this->options.manifestSigning) {
+            ndn::Name regionName(worldPrefix);
+            regionName.append(ownSubtree->subtreeToName());
+            manifest = ManifestStore::manifestName(regionName, revision).toUri();
+            // Announced while holding the lock, so the manifest cannot be sealed before the digests are added. The
+            // number of segments is only known after splitting the response, the remaining ones are announced below.
+            manifestStore.addPendingDigests(revision, 1);
+        }
+        syncResponse = buildSyncResponse(syncTree, hash, getPacketBudget(), manifest, details);
+        tuningSubtree = this->options.autoTune ? findTuningSubtree(syncTree) : nullptr;
+    }
+
+    // Every segment is a self-contained response which fits into a single Data packet
+    std::vector<SyncResponse> segments = SyncTree::splitSyncResponse(syncResponse, getPacketBudget());
+    if (segments.size() > 1) {
+        segmented_responses++;
+    }
+    sent_segments += segments.size();
+    if (this->options.manifestSigning) {
+        manifestStore.addPendingDigests(revision, segments.size() - 1);
+    }
+
+    // The signing callbacks are all invoked on the face thread
+    auto signedSegments = std::make_shared<ResponseCache::Segments>(segments.size());
+    auto pendingSegments = std::make_shared<size_t>(segments.size());
+    const auto finalBlockId = ndn::name::Component::fromSegment(segments.size() - 1);
+    size_t responseBytes = 0;
+    for (size_t i = 0; i < segments.size(); i++) {
+        std::string plain = segments[i].SerializeAsString();
+        std::string compressed = GZip::compress(plain);
+        responseBytes += compressed.size();
+
+        // Todo: Encrypt response
+
+        // Create Data packet
+        auto data = std::make_shared<ndn::Data>(ndn::Name(dataName).appendVersion(revision).appendSegment(i));
+        data->setFreshnessPeriod(boost::chrono::milliseconds(ServerModeSyncClient::SLEEP_TIME_MS));
+        data->setFinalBlock(finalBlockId);
+        data->setContent(reinterpret_cast<const uint8_t*>(compressed.data()), compressed.size());
+
+        auto onSigned = [signedSegments, pendingSegments, i, onCreated](const std::shared_ptr<ndn::Data>& data) {
+            (*signedSegments)[i] = data;
+            if (--(*pendingSegments) == 0) {
+                onCreated(*signedSegments);
+            }
+        };
+
+        if (this->options.manifestSigning) {
+            // Only a digest, the manifest listing the digest carries the signature
+            signingPool.signWithDigest(data, [this, revision, onSigned](const std::shared_ptr<ndn::Data>& data) {
+                this->manifestStore.addDigest(revision, data->getFullName().get(-1));
+                onSigned(data);
+                signManifest(revision);
+            });
+            continue;
+        }
+
+        // Todo: Sign response with proper cert
+        signingPool.sign(data, onSigned);
+    }
+
+    if (tuningSubtree != nullptr) {
+        const int items = syncResponse.chunkdata() ? syncResponse.chunks_size() : syncResponse.hashvalues_size();
+        responseTuner.addResponse(tuningSubtree, syncResponse.chunkdata(), items, responseBytes);
+    }
+    return true;
+}
+
+void quadtree::ServerModeSyncClient::onAggregatedSyncRequestReceived(const ndn::Interest& interest)
+{
+    if (!interest.hasApplicationParameters()) {
+        spdlog::error("Aggregated sync request " + interest.getName().toUri() + " without parameters");
+        return;
+    }
+    const ndn::Block& parameters = interest.getApplicationParameters();
+    auto request = std::make_shared<SyncRequest>();
+    if (!request->ParseFromArray(parameters.value(), parameters.value_size())) {
+        spdlog::error("Invalid aggregated sync request " + interest.getName().toUri());
+        return;
+    }
+    received_aggregated_requests++;
+
+    unsigned long revision;
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        revision = this->publishRevision;
+    }
+
+    // Consumers in sync send the same list of hashes, which results in the same name including the parameters digest
+    ResponseCache::Key key(interest.getName(), 0, revision);
+    bool computeResponse = responseCache.fetchOrJoin(
+        key, [this](const ResponseCache::Segments& segments) { this->face.put(*segments.front()); });
+    if (!computeResponse) {
+        spdlog::trace("Serve aggregated response for " + interest.getName().toUri() + " from cache");
+        return;
+    }
+
+    AggregatedSyncResponse aggregatedResponse;
+    RequestBundler::ResponseBudget responseBudget(getPacketBudget());
+    bool outdated;
+    {
+        std::unique_lock<std::mutex> lck(this->treeAccessMutex);
+        // The response is cached under the revision, so it has to be built from the tree of that revision
+        outdated = revision != this->publishRevision;
+        if (!outdated) {
+            for (const auto& subtreeRequest : request->subtrees()) {
+                SyncTree* syncTree;
+                try {
+                    syncTree = world.getSubtreeFromName(ndn::Name(subtreeRequest.subtree()));
+                } catch (const std::exception& ex) {
+                    spdlog::error("Subtree for aggregated request not initialized: {}", ex.what());
+                    continue;
+                }
+                if (subtreeRequest.hash() == syncTree->getHash()) {
+                    continue; // Nothing new
+                }
+
+                // Budgeted responses fill the space left in the aggregated response
+                SyncResponse syncResponse
+                    = buildSyncResponse(syncTree, subtreeRequest.hash(), responseBudget.getRemaining(), "");
+                if (!responseBudget.add(syncResponse.ByteSizeLong())) {
+                    aggregatedResponse.add_omitted(subtreeRequest.subtree());
+                    omitted_aggregated_subtrees++;
+                    continue;
+                }
+                SubtreeSyncResponse* subtreeResponse = aggregatedResponse.add_responses();
+                subtreeResponse->set_subtree(subtreeRequest.subtree());
+                *subtreeResponse->mutable_response() = syncResponse;
+            }
+        }
+    }
+    if (outdated) {
+        // A tick was published after the revision was read, answer the request for the new revision
+        responseCache.complete(key, {});
+        onAggregatedSyncRequestReceived(interest);
+        return;
+    }
+    if (aggregatedResponse.responses_size() == 0 && aggregatedResponse.omitted_size() == 0) {
+        // Do not send packet when nothing is new
+        spdlog::debug("Hashes of aggregated request unchanged, do not answer interest.");
+        responseCache.complete(key, {});
+        return;
+    }
+
+    // The bundled responses share the compression and a single signature
+    std::string compressed = GZip::compress(aggregatedResponse.SerializeAsString());
+    auto data = std::make_shared<ndn::Data>(interest.getName());
+    data->setFreshnessPeriod(boost::chrono::milliseconds(ServerModeSyncClient::SLEEP_TIME_MS));
+    data->setContent(reinterpret_cast<const uint8_t*>(compressed.data()), compressed.size());
+    signingPool.sign(data, [this, key](const std::shared_ptr<ndn::Data>& data) {
+        this->responseCache.complete(key, ResponseCache::Segments({ data }));
+    });
+}
+
+bool quadtree::ServerModeSyncClient::isAggregatedRequest(const ndn::Name& name, const ndn::Name& regionName)
+{
+    return regionName.isPrefixOf(name) && name.size() > regionName.size()
+        && name.get(regionName.size()).toUri() == AGGREGATED_REQUEST_COMPONENT;
+}
+
+void quadtree::ServerModeSyncClient::parkInterest(const ndn::Interest& interest)
+{
+    auto expiry = std::chrono::steady_clock::now()
+        + std::chrono::milliseconds(
+            boost::chrono::duration_cast<boost::chrono::milliseconds>(interest.getInterestLifetime()).count());
+    std::unique_lock<std::mutex> lck(this->pendingInterestMutex);
+    pendingInterests.push_back({ interest, expiry });
+    parked_interests++;
+}
+
+void quadtree::ServerModeSyncClient::answerPendingInterests()
+{
+    std::vector<PendingInterest> parked;
+    {
+        std::unique_lock<std::mutex> lck(this->pendingInterestMutex);
+        parked.swap(pendingInterests);
+    }
+
+    // Interests whose subtree did not change with the last tick are parked again
+    auto now = std::chrono::steady_clock::now();
+    for (const auto& pending : parked) {
+        if (pending.expiry > now) {
+            handleSubtreeSyncRequest(pending.interest);
+        }
+    }
+    spdlog::trace("Rechecked " + std::to_string(parked.size()) + " pending interests");
+}
+
+size_t quadtree::ServerModeSyncClient::findHashComponent(const ndn::Name& name)
+{
+    for (size_t i = 0; i < name.size(); i++) {
+        if (name.get(i).toUri() == "h" || name.get(i).toUri() == REVISION_COMPONENT) {
+            return i;
+        }
     }
-    face.put(data);
+    return name.size();
 }
 
 void quadtree::ServerModeSyncClient::onRegisterFailed(const ndn::Name& prefix, const std::string& reason)
@@ -334,6 +1984,68 @@ void quadtree::ServerModeSyncClient::storeLogValues()
     logfile << "received_chunk_responses: " << received_chunk_responses << std::endl;
     logfile << "received_subtree_responses: " << received_subtree_responses << std::endl;
     logfile << "received_unknown_hash_responses: " << received_unknown_hash_responses << std::endl;
+    logfile << "response_cache_hits: " << responseCache.getHits() << std::endl;
+    logfile << "response_cache_misses: " << responseCache.getMisses() << std::endl;
+    logfile << "response_cache_joined_requests: " << responseCache.getJoinedRequests() << std::endl;
+    logfile << "precomputed_responses: " << precomputed_responses << std::endl;
+    logfile << "signed_packets: " << signingPool.getSignedPackets() << std::endl;
+    logfile << "sign_latency_avg_us: " << signingPool.getAverageSignLatencyMicros() << std::endl;
+    logfile << "sign_latency_max_us: " << signingPool.getMaxSignLatencyMicros() << std::endl;
+    logfile << "signing_queue_depth_avg: " << signingPool.getAverageQueueDepth() << std::endl;
+    logfile << "signing_queue_depth_max: " << signingPool.getMaxQueueDepth() << std::endl;
+    logfile << "manifest_fetches: " << manifest_fetches << std::endl;
+    logfile << "signed_manifests: " << signed_manifests << std::endl;
+    logfile << "manifest_verification_failures: " << manifest_verification_failures << std::endl;
+    logfile << "responses_not_in_manifest: " << responses_not_in_manifest << std::endl;
+    logfile << "verified_packets: " << verificationPool.getVerifiedPackets() << std::endl;
+    logfile << "invalid_signature_responses: " << invalid_signature_responses << std::endl;
+    logfile << "verify_latency_avg_us: " << verificationPool.getAverageVerifyLatencyMicros() << std::endl;
+    logfile << "verify_latency_max_us: " << verificationPool.getMaxVerifyLatencyMicros() << std::endl;
+    logfile << "verification_reordered_packets: " << verificationPool.getReorderedPackets() << std::endl;
+    logfile << "segmented_responses: " << segmented_responses << std::endl;
+    logfile << "sent_segments: " << sent_segments << std::endl;
+    logfile << "received_segments: " << received_segments << std::endl;
+    logfile << "segment_timeouts: " << segment_timeouts << std::endl;
+    logfile << "aborted_segment_fetches: " << aborted_segment_fetches << std::endl;
+    logfile << "parked_interests: " << parked_interests << std::endl;
+    logfile << "deduplicated_requests: " << deduplicated_requests << std::endl;
+    logfile << "cancelled_requests: " << cancelled_requests << std::endl;
+    logfile << "max_inflight_requests: " << max_inflight_requests << std::endl;
+    logfile << "backed_off_polls: " << backed_off_polls << std::endl;
+    logfile << "sent_unchanged_nacks: " << sent_unchanged_nacks << std::endl;
+    logfile << "region_reactivations: " << region_reactivations << std::endl;
+    logfile << "request_timeouts: " << request_timeouts << std::endl;
+    logfile << "retransmitted_requests: " << retransmitted_requests << std::endl;
+    logfile << "abandoned_requests: " << abandoned_requests << std::endl;
+    logfile << "congestion_nacks: " << congestion_nacks << std::endl;
+    logfile << "congestion_window_decreases: " << congestion_window_decreases << std::endl;
+    logfile << "deferred_polls: " << deferred_polls << std::endl;
+    logfile << "aggregated_requests: " << aggregated_requests << std::endl;
+    logfile << "aggregated_subtree_requests: " << aggregated_subtree_requests << std::endl;
+    logfile << "received_aggregated_responses: " << received_aggregated_responses << std::endl;
+    logfile << "received_aggregated_requests: " << received_aggregated_requests << std::endl;
+    logfile << "omitted_aggregated_subtrees: " << omitted_aggregated_subtrees << std::endl;
+    logfile << "tuned_parameter_changes: " << tuned_parameter_changes << std::endl;
+    logfile << "average_descent_depth: " << responseTuner.getAverageDescentDepth() << std::endl;
+    logfile << "digest_requests: " << digest_requests << std::endl;
+    logfile << "received_digest_requests: " << received_digest_requests << std::endl;
+    logfile << "full_hash_requests: " << full_hash_requests << std::endl;
+    logfile << "received_peer_states: " << received_peer_states << std::endl;
+    logfile << "peer_state_requests: " << peer_state_requests << std::endl;
+    logfile << "skipped_passive_polls: " << skipped_passive_polls << std::endl;
+    logfile << "sent_heartbeats: " << sent_heartbeats << std::endl;
+    logfile << "received_heartbeats: " << received_heartbeats << std::endl;
+    logfile << "heartbeat_requests: " << heartbeat_requests << std::endl;
+    logfile << "skipped_heartbeat_polls: " << skipped_heartbeat_polls << std::endl;
+    logfile << "session_requests: " << session_requests << std::endl;
+    logfile << "session_delta_responses: " << session_delta_responses << std::endl;
+    logfile << "journal_misses: " << journal_misses << std::endl;
+    logfile << "expired_sessions: " << sessionTable.getExpiredSessions() << std::endl;
+    logfile << "revision_requests: " << revision_requests << std::endl;
+    logfile << "received_revision_requests: " << received_revision_requests << std::endl;
+    logfile << "received_snapshots: " << received_snapshots << std::endl;
+    logfile << "failed_snapshots: " << failed_snapshots << std::endl;
+    logfile << "sent_snapshots: " << sent_snapshots << std::endl;
     logfile.flush();
     logfile.close();
 }
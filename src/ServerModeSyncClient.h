@@ -5,17 +5,38 @@
 #ifndef QUADTREESYNCEVALUATION_SERVERMODESYNCCLIENT_H
 #define QUADTREESYNCEVALUATION_SERVERMODESYNCCLIENT_H
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <map>
 #include <mutex>
+#include <random>
+#include <set>
 #include <thread>
 #include <utility>
 
 #include "spdlog/spdlog.h"
 #include <ndn-cxx/face.hpp>
+#include <ndn-cxx/util/scheduler.hpp>
 
+#include "ChangeJournal.h"
+#include "CongestionWindow.h"
+#include "PeerActivity.h"
+#include "PhaseController.h"
+#include "RequestBundler.h"
+#include "ResponseCache.h"
+#include "ResponseTuner.h"
+#include "RttEstimator.h"
+#include "SegmentWindow.h"
+#include "SessionTable.h"
+#include "SyncClientOptions.h"
 #include "SyncTree.h"
+#include "security/ManifestStore.h"
+#include "security/SignatureVerifier.h"
+#include "security/VerificationPool.h"
 #include "src/logging/ChunkLogger.h"
 #include "zip/GZip.h"
 
@@ -34,7 +55,8 @@ public:
     ServerModeSyncClient(std::string worldPrefix, Rectangle area, Rectangle responsibleArea,
         unsigned initialRequestLevel, std::vector<std::pair<unsigned, std::vector<quadtree::Chunk>>> changesOverTime,
         const std::string& logFolder, const std::string& logFilePrefix, unsigned lowerLevels = 2,
-        unsigned chunkThreshold = 200, long syncRequestInterval = 500)
+        unsigned chunkThreshold = 200, long syncRequestInterval = 500,
+        SyncClientOptions options = SyncClientOptions())
         : worldPrefix(std::move(worldPrefix))
         , world(std::move(area))
         , responsibleArea(std::move(responsibleArea))
@@ -42,29 +64,329 @@ public:
         , lowerLevels(lowerLevels)
         , chunkThreshold(chunkThreshold)
         , syncRequestInterval(syncRequestInterval)
+        , options(options)
         , changesOverTime(std::move(changesOverTime))
         , logFolder(logFolder)
         , logFilePrefix(logFilePrefix)
         , logger(logFolder + logFilePrefix + "_chunklog.csv")
+        , signingPool(this->options.signingMode, this->options.hmacKey, this->options.signingThreads,
+              face.getIoService())
+        , signatureVerifier(this->options.hmacKey, this->options.trustAnchors, this->options.certificates)
+        , verificationPool(signatureVerifier, this->options.verificationThreads, face.getIoService())
+        , scheduler(face.getIoService())
+        , requestBundler(this->options.maxAggregatedSubtrees)
+        , responseTuner({ lowerLevels, chunkThreshold })
+        , changeJournal(this->options.journalLength)
+        , sessionTable(this->options.maxSessions, MAX_SESSION_SUBTREES,
+              std::chrono::milliseconds(this->options.sessionExpiry))
     {
-
     }
 
 public:
-    void submitChange(const Point& changedPoint, unsigned numChanges);
+    /**
+     * Changes the chunk at the given point of the own region
+     * @return The changed chunk
+     */
+    Chunk* submitChange(const Point& changedPoint, unsigned numChanges);
 
     void startSynchronization();
 
 protected:
+    struct InFlightRequest {
+        size_t hash;
+        ndn::PendingInterestHandle handle;
+        // Number of retransmissions before this request
+        unsigned retries;
+    };
+
+    /**
+     * Subtree requests of a remote region. Requests wait in the queue while the window is full.
+     */
+    struct RequestPipeline {
+        std::deque<SyncTree*> queued;
+        std::map<SyncTree*, InFlightRequest> inFlight;
+        // Retransmission counts of queued requests for subtrees whose previous request was lost
+        std::map<SyncTree*, unsigned> retransmissions;
+        // Queued subtrees whose responses did not fit into an aggregated response
+        std::set<SyncTree*> unaggregated;
+        // Queued subtrees to request with full hash values after a collision of truncated ones
+        std::set<SyncTree*> fullHashes;
+    };
+
+    /**
+     * Consumer state of a remote region. All timers of a region run on the face's io_service.
+     */
+    struct RemoteRegion {
+        SyncTree* subtree;
+        ndn::Name name;
+        // Planned time of the next sync request
+        std::chrono::system_clock::time_point nextRequest;
+        ndn::scheduler::ScopedEventId requestTimer;
+        PhaseController phase;
+        RttEstimator rtt;
+        CongestionWindow congestionWindow;
+        bool pollOutstanding = false;
+        // Number of consecutive polls without a change, determines the poll interval
+        unsigned idlePolls = 0;
+        std::vector<RemoteRegion*> neighbours;
+        bool longPollOutstanding = false;
+        RequestPipeline pipeline;
+        // With bidirectionalSync, the producer of a passive region polls this client and sends its state along. With
+        // digestHeartbeat, its producer announces its state. The region is only polled if neither arrived for a while.
+        PeerActivity activity;
+        // With sessions, the latest revision of the producer's tree each subtree was in sync with
+        std::map<SyncTree*, unsigned long> acknowledgedRevisions;
+
+        RemoteRegion(SyncTree* subtree, ndn::Name name, long publishPeriod, long peerPollInterval)
+            : subtree(subtree)
+            , name(std::move(name))
+            , phase(publishPeriod)
+            , rtt(publishPeriod, MIN_RTO_MS, MAX_RTO_MS)
+            , congestionWindow(INITIAL_CONGESTION_WINDOW, 1, MAX_CONGESTION_WINDOW)
+            , activity(std::chrono::milliseconds(HEARTBEAT_TIMEOUT_TICKS * publishPeriod),
+                  std::chrono::milliseconds(PEER_STATE_TIMEOUT_POLLS * peerPollInterval))
+        {
+        }
+    };
+
     void applyChangesOverTime();
 
-    void synchronizeRemoteRegion(SyncTree* subtree);
+    /**
+     * Starts requesting changes from all remote regions, either by polling or by long-lived Interests
+     */
+    void startRemoteRegionSynchronization();
+
+    /**
+     * Starts requesting changes from the remote region, the first poll is sent at firstRequest
+     */
+    void startRegionSynchronization(RemoteRegion& region, std::chrono::system_clock::time_point firstRequest);
+
+    /**
+     * Requests a snapshot of the remote region and starts synchronizing it afterwards, also if the snapshot could not
+     * be fetched
+     */
+    void requestSnapshot(RemoteRegion& region);
 
     void storeLogValues();
 
+    /**
+     * Collects the own subtrees on the request level and starts the background stage precomputing their responses,
+     * if enabled.
+     */
+    void startResponsePrecomputation();
+
+    /**
+     * Enqueues the precomputation of the responses for all own subtrees on the request level whose hash changed with
+     * the last publish tick. The previous hash values are the ones most consumers request changes since.
+     * @param previousHashes Hash values of the own request level subtrees before the tick
+     */
+    void schedulePrecomputation(const std::vector<size_t>& previousHashes);
+
+    /**
+     * Passes the changes of the last tick per own request level subtree to the tuner and updates the response
+     * parameters
+     */
+    void tuneResponseParameters(const std::vector<Chunk>& ownChunks);
+
+    /**
+     * Returns the own request level subtree containing the given subtree, or nullptr if there is none
+     */
+    SyncTree* findTuningSubtree(SyncTree* subtree) const;
+
+    /**
+     * Returns lowerLevels and chunkThreshold for responses of the given subtree, the tuned ones if autoTune is enabled
+     */
+    ResponseTuner::Parameters getResponseParameters(SyncTree* subtree) const;
+
+    void precomputeResponses();
+
     // NDN Consumer Methods
+    /**
+     * Expresses a long-lived Interest for the given remote region with the local hash, unless one is outstanding. The
+     * producer answers it as soon as the region changes.
+     */
+    void expressLongPollInterest(RemoteRegion& region);
+
+    /**
+     * Requests the changes of the remote region and schedules the next request
+     */
+    void sendSyncRequest(RemoteRegion& region);
+
+    void expressPollInterest(RemoteRegion& region);
+
+    /**
+     * Appends the session identifier and the revision acknowledged for the subtree to a request name, if sessions are
+     * enabled
+     */
+    void appendSessionComponents(const RemoteRegion& region, SyncTree* subtree, ndn::Name& name) const;
+
+    /**
+     * Appends the name of the subtree and the state known by this client to a request name: the remote revision if
+     * revisionRequests is enabled and the revision is known, the hash value otherwise. Has to be called while holding
+     * the tree lock.
+     */
+    void appendSubtreeState(SyncTree* subtree, ndn::Name& name);
+
+    /**
+     * Compares the hash values of a digest heartbeat to the local ones and requests all regions which differ
+     */
+    void onDigestHeartbeatReceived(const ndn::InterestFilter&, const ndn::Interest& interest);
+
+    /**
+     * Returns the number of polls and subtree requests of the region in flight, which are limited by its congestion
+     * window
+     */
+    size_t getOutstandingInterests(const RemoteRegion& region) const;
+
+    /**
+     * Shrinks the congestion window of the region after a congestion Nack or a lost subtree request
+     */
+    void onCongestionSignal(RemoteRegion& region);
+
+    void scheduleSyncRequest(RemoteRegion& region);
+
+    /**
+     * Returns the current poll interval of the region in milliseconds, which backs off exponentially up to
+     * maxPollInterval while the region does not change
+     */
+    long getPollInterval(const RemoteRegion& region) const;
+
+    /**
+     * Resets the poll interval of the region and its neighbours to the sync request interval after a change
+     */
+    void markRegionActive(RemoteRegion& region);
+
     void onSubtreeSyncResponseReceived(const ndn::Interest&, const ndn::Data& data);
 
+    /**
+     * Decodes a sync response whose signature was verified (or not, if verification is disabled)
+     */
+    void onVerifiedSyncResponse(const ndn::Interest& interest, const ndn::Data& data);
+
+    /**
+     * Applies an authenticated sync response to the local sync tree and issues Interests for out of sync subtrees.
+     * @param millis Time the response was received
+     */
+    void processSyncResponse(const ndn::Name& subtreeName, const ndn::Interest& interest, const ndn::Data& data,
+        const SyncResponse& response, long millis);
+
+    /**
+     * Applies the responses bundled in an aggregated response and requests the omitted subtrees separately
+     */
+    void processAggregatedSyncResponse(
+        const ndn::Interest& interest, const ndn::Data& data, const AggregatedSyncResponse& response, long millis);
+
+    /**
+     * Returns true if the digest of the Data packet is listed in the given, already verified manifest
+     */
+    bool isListedInManifest(const ndn::Data& data, const std::string& manifest);
+
+    void fetchManifest(const ndn::Name& manifestName);
+
+    void onManifestReceived(const ndn::Interest& interest, const ndn::Data& data);
+
+    void onVerifiedManifest(const ndn::Interest& interest, const ndn::Data& data);
+
+    /**
+     * Requests the changes of an out of sync subtree through the pipeline of its region. The request is dropped if
+     * the same subtree is already queued or requested with the current local hash.
+     * @param fullHashes If true, the response contains full lower level hash values instead of truncated ones
+     */
+    void requestSubtree(SyncTree* subtree, bool fullHashes = false);
+
+    /**
+     * Issues queued requests until the window of the pipeline is full
+     */
+    void pumpRequestPipeline(RemoteRegion& region);
+
+    /**
+     * Returns true if the request window and the congestion window of the region allow another subtree request
+     * @param additional Number of requests about to be issued in addition to the ones in flight
+     */
+    bool canIssueRequest(const RemoteRegion& region, size_t additional) const;
+
+    unsigned takeRetransmissionCount(RequestPipeline& pipeline, SyncTree* subtree);
+
+    /**
+     * Returns the lifetime of subtree requests. With retransmissions or congestion control, it covers the
+     * retransmission timeout and the time the producer may hold a request until its next publish tick, so the producer
+     * can answer before the request is considered lost.
+     */
+    boost::chrono::milliseconds getRequestLifetime(const RemoteRegion& region) const;
+
+    /**
+     * Returns true if the timeout of a subtree request indicates loss, which requires that its lifetime covered the
+     * retransmission timeout at the time it was sent plus one publish period
+     */
+    bool isLossTimeout(boost::chrono::milliseconds lifetime, double rto) const;
+
+    /**
+     * Requests up to maxAggregatedSubtrees queued subtrees of the region with a single Interest, which lists the
+     * subtrees and their local hash values in its ApplicationParameters
+     * @return False if less than two subtrees can be requested together
+     */
+    bool expressAggregatedRequest(RemoteRegion& region);
+
+    void completeRequest(RemoteRegion& region, SyncTree* subtree, size_t hash);
+
+    /**
+     * Requests a subtree again with its current local hash after the previous request was lost, unless the maximum
+     * number of retransmissions is reached
+     * @param retries Number of retransmissions of the lost request
+     */
+    void retransmitRequest(RemoteRegion& region, SyncTree* subtree, unsigned retries);
+
+    /**
+     * Cancels all queued and in-flight requests for subtrees below the given one, after a response containing all
+     * changes of the subtree was applied
+     */
+    void cancelCoveredRequests(SyncTree* subtree);
+
+    /**
+     * Starts or continues fetching the segments of a segmented sync response, keeping up to segmentWindow segment
+     * Interests in flight. Segments are applied as they arrive, in any order.
+     * @param data A received segment
+     */
+    void continueSegmentFetch(const ndn::Data& data);
+
+    void expressSegmentInterest(const ndn::Name& responseName, uint64_t segment);
+
+    void onSegmentTimeout(const ndn::Interest& interest);
+
+    void abortSegmentFetch(const ndn::Name& segmentName);
+
+    /**
+     * Returns the name of the response a segment belongs to, including the version. The first segment of a
+     * bidirectional poll's response is named after the poll, the remaining ones like the segments of a plain poll.
+     */
+    static ndn::Name getSegmentedResponseName(const ndn::Name& segmentName);
+
+    /**
+     * Records an applied segment of a segmented response
+     * @return True if all segments of the response's version are applied
+     */
+    bool addAppliedSegment(const ndn::Data& data);
+
+    /**
+     * Creates the state of all remote regions, has to be called after remoteSyncTrees is filled
+     */
+    void collectRemoteRegions();
+
+    /**
+     * Returns the remote region the given name belongs to, or nullptr
+     */
+    RemoteRegion* findRemoteRegion(const ndn::Name& name);
+
+    /**
+     * Returns the verification stream of the given name, which is the name of the remote region it belongs to
+     */
+    std::string remoteRegionStream(const ndn::Name& name);
+
+    /**
+     * Returns the name of the own region including the world prefix, which prefixes all Interests of consumers
+     */
+    ndn::Name getOwnRegionName();
+
     void onNack(const ndn::Interest&, const ndn::lp::Nack& nack);
 
     void onTimeout(const ndn::Interest& interest);
@@ -72,12 +394,190 @@ protected:
     // NDN Producer Methods
     void onSubtreeSyncRequestReceived(const ndn::InterestFilter&, const ndn::Interest& interest);
 
+    void handleSubtreeSyncRequest(const ndn::Interest& interest);
+
+    /**
+     * Notifies all consumers about the current hash value of the own region with an Interest, which is not answered
+     */
+    void sendDigestHeartbeat();
+
+    /**
+     * Processes the state of the requester's region sent along with a bidirectional poll. If the requester's hash
+     * value differs from the local one, the requester's region is requested right away.
+     */
+    void onPeerStateReceived(const ndn::Interest& interest);
+
+    /**
+     * Answers a bidirectional poll with a copy of the first segment of the response to the plain poll, named after
+     * the Interest. Further segments are fetched under the name of the plain response. The signed copy is cached
+     * like the plain response, identical polls of the same revision are answered without signing again.
+     */
+    void answerPeerExchange(const ndn::Name& interestName, const ndn::Data& segment);
+
+    /**
+     * Returns true if the name belongs to a bidirectional poll or its response
+     */
+    static bool isPeerExchange(const ndn::Name& name);
+
+    /**
+     * Answers an aggregated request with the responses of all listed subtrees which changed, bundled in one Data
+     * packet. Responses exceeding the maximum segment size are omitted and have to be requested separately.
+     */
+    void onAggregatedSyncRequestReceived(const ndn::Interest& interest);
+
+    /**
+     * Returns true if the name is an aggregated request (<region>/agg) of the given region, or a response to it
+     */
+    static bool isAggregatedRequest(const ndn::Name& name, const ndn::Name& regionName);
+
+    /**
+     * Stores an Interest for a subtree which did not change since the requested hash, until it expires
+     */
+    void parkInterest(const ndn::Interest& interest);
+
+    /**
+     * Handles all parked Interests again, has to be called after the tree was rehashed. Interests of changed subtrees
+     * are answered, the others are parked again.
+     */
+    void answerPendingInterests();
+
+    typedef std::function<void(const ResponseCache::Segments&)> ResponseCreatedCallback;
+
+    /**
+     * Hash values of the requester's inflated subtrees depth levels below the requested subtree, carried in the
+     * ApplicationParameters of a digest request. A depth of 0 marks a plain request.
+     */
+    struct LowerLevelDigests {
+        unsigned depth;
+        std::map<unsigned, size_t> hashes;
+
+        LowerLevelDigests()
+            : depth(0)
+        {
+        }
+    };
+
+    /**
+     * Decodes the lower level hash values of a digest request
+     * @return False if the parameters are invalid
+     */
+    static bool parseLowerLevelDigests(const ndn::Interest& interest, LowerLevelDigests& digests);
+
+    /**
+     * Properties of a subtree request besides the subtree and the requester's hash value
+     */
+    struct RequestDetails {
+        // Lower level hash values of a digest request
+        LowerLevelDigests digests;
+        // If true, lower level hash values are not truncated
+        bool fullHashes;
+        // Revision of the tree the requester's session holds for the subtree, 0 if unknown
+        unsigned long sessionRevision;
+        // If true, the requester sent the revision of the subtree it knows instead of the hash value
+        bool revisionRequest;
+        // If true, the requester has no state and asks for a snapshot of the subtree
+        bool snapshot;
+
+        RequestDetails()
+            : fullHashes(false)
+            , sessionRevision(0)
+            , revisionRequest(false)
+            , snapshot(false)
+        {
+        }
+    };
+
+    /**
+     * Prepares the sync response for a subtree, either limited by the chunk threshold or, with budgetedResponses, by
+     * the given byte budget. Responses to digest requests are based on the comparison with the requester's lower level
+     * hash values and always fit into the byte budget, since they cannot be fetched in segments. Requesters with a
+     * session revision covered by the change journal receive exactly the changes since. Has to be called while
+     * holding the treeAccessMutex.
+     * @param manifest Name of the manifest listing the response, empty if responses are signed individually
+     * @param details Properties of the request
+     */
+    SyncResponse buildSyncResponse(SyncTree* syncTree, size_t hash, size_t byteBudget, const std::string& manifest,
+        const RequestDetails& details = RequestDetails());
+
+    /**
+     * Returns the content size available to a response in a single Data packet, i.e. maxSegmentSize without the
+     * name, signature and other fields of the packet
+     */
+    size_t getPacketBudget() const;
+
+    /**
+     * Prepares the sync response for the given subtree and hash value and creates the serialized and compressed Data
+     * packets from it. Responses larger than the packet budget are split into segments named
+     * <dataName>/<version=revision>/<segment>. The packets are signed by the signing pool, the callback is invoked on
+     * the face thread as soon as all segments are signed.
+     * @param syncTree Requested subtree
+     * @param dataName Name of the response, ending with the hash value
+     * @param hash Hash value of the subtree known by the requester
+     * @param revision Revision of the tree the response is created for
+     * @param onCreated Callback invoked with the signed segments
+     * @param details Properties of the request
+     * @return False if the tree moved on to a newer revision, in which case no response is created
+     */
+    bool createSyncResponseData(SyncTree* syncTree, const ndn::Name& dataName, size_t hash, unsigned long revision,
+        const ResponseCreatedCallback& onCreated, const RequestDetails& details = RequestDetails());
+
+    /**
+     * Returns the index of the "h" component preceding the hash value or the "r" component preceding the revision in
+     * a sync request name, or the size of the name if there is none
+     */
+    static size_t findHashComponent(const ndn::Name& name);
+
     void onRegisterFailed(const ndn::Name& prefix, const std::string& reason);
 
+    /**
+     * Answers a request for the manifest of a revision, listing the digests of all responses served for it. Requests
+     * for the manifest of the current revision are answered once it was sealed and signed after the next publish tick.
+     * @param manifestIndex Index of the "manifest" component in the Interest name
+     */
+    void onManifestRequestReceived(const ndn::Interest& interest, size_t manifestIndex);
+
+    /**
+     * Signs the manifest of a revision if it is sealed and all responses of the revision are signed
+     */
+    void signManifest(unsigned long revision);
+
 public:
     const unsigned SLEEP_TIME_MS = 500;
 
 protected:
+    // Bounds of the retransmission timeout of subtree requests
+    static const long MIN_RTO_MS = 200;
+    static const long MAX_RTO_MS = 4000;
+    static constexpr double INITIAL_CONGESTION_WINDOW = 4;
+    static constexpr double MAX_CONGESTION_WINDOW = 64;
+    // Name component of aggregated requests, which carry the requested subtrees in their parameters
+    static constexpr const char* AGGREGATED_REQUEST_COMPONENT = "agg";
+    // Maximum depth of the lower level hash values in a digest request, which keeps the responses in a single packet
+    static const unsigned MAX_DIGEST_DEPTH = 3;
+    // Name component after the hash value of requests for responses with full lower level hash values
+    static constexpr const char* FULL_HASHES_COMPONENT = "f";
+    // Name component after the hash value of bidirectional polls, which carry the requester's state in their parameters
+    static constexpr const char* PEER_EXCHANGE_COMPONENT = "x";
+    // Reason of the Nacks producers answer polls for unchanged subtrees with, if adaptivePolling is enabled. Forwarders
+    // only send Nacks with other reasons.
+    static constexpr ndn::lp::NackReason UNCHANGED_NACK_REASON = ndn::lp::NackReason::NONE;
+    // Number of poll intervals without a state of a passive region's producer until the region is polled again
+    static const unsigned PEER_STATE_TIMEOUT_POLLS = 4;
+    // Name component after the world prefix of digest heartbeats, which have to be forwarded to all consumers
+    static constexpr const char* DIGEST_HEARTBEAT_COMPONENT = "digest";
+    // Number of publish ticks without a heartbeat of a region's producer until the region is polled again
+    static const unsigned HEARTBEAT_TIMEOUT_TICKS = 4;
+    // Name component after the hash value of requests within a session, followed by the session identifier and the
+    // revision acknowledged for the subtree
+    static constexpr const char* SESSION_COMPONENT = "s";
+    static const size_t MAX_SESSION_SUBTREES = 256;
+    // Name component preceding the remote revision of a subtree in requests, instead of "h" and the hash value
+    static constexpr const char* REVISION_COMPONENT = "r";
+    // Name component after the subtree of snapshot requests
+    static constexpr const char* SNAPSHOT_COMPONENT = "snapshot";
+    // Levels of the hash values in snapshots, the segments of a snapshot are split at the subtrees of the lowest level
+    static const unsigned SNAPSHOT_LOWER_LEVELS = 4;
+
     std::string worldPrefix;
     SyncTree world;
     Rectangle responsibleArea;
@@ -87,9 +587,9 @@ protected:
     unsigned lowerLevels;
     unsigned chunkThreshold;
     long syncRequestInterval;
+    SyncClientOptions options;
 
     ndn::Face face;
-    ndn::KeyChain keyChain;
 
     std::vector<std::pair<unsigned, std::vector<quadtree::Chunk>>> changesOverTime;
 
@@ -99,18 +599,118 @@ protected:
 
     std::atomic<bool> isRunning { true };
     std::thread publisherThread;
-    std::vector<std::thread> consumerthreads;
     std::atomic<unsigned> currentTick { 0 };
     std::mutex treeAccessMutex;
-    std::mutex keyChainMutex;
 
     long last_publish_timestamp;
-    std::mutex runtimeMemoryMutex;
-    std::unordered_map<std::string, long> received_data_runtimes;
+    // Incremented with every rehash of the tree, identifies the state responses were computed for
+    std::atomic<unsigned long> publishRevision { 0 };
+    ResponseCache responseCache;
+    SigningPool signingPool;
+    ManifestStore manifestStore;
+    SignatureVerifier signatureVerifier;
+    VerificationPool verificationPool;
+    ndn::Scheduler scheduler;
+
+    struct PendingInterest {
+        ndn::Interest interest;
+        std::chrono::steady_clock::time_point expiry;
+    };
+    std::mutex pendingInterestMutex;
+    std::vector<PendingInterest> pendingInterests;
+    // State of the remote regions, by region name. Only accessed on the face thread.
+    std::map<std::string, RemoteRegion> remoteRegions;
+
+    struct ReceivedResponse {
+        ndn::Interest interest;
+        ndn::Data data;
+        SyncResponse response;
+        long receiveTime;
+    };
+    // Digests listed in verified manifests, by manifest name
+    std::map<ndn::Name, std::set<std::string>> verifiedManifests;
+    std::map<ndn::Name, std::vector<ReceivedResponse>> responsesAwaitingManifest;
+
+    static const unsigned MAX_SEGMENT_RETRIES = 2;
+    // Segmented responses currently fetched, by response name including the version
+    std::map<ndn::Name, SegmentWindow> segmentFetches;
+
+    struct AppliedSegments {
+        uint64_t version;
+        std::set<uint64_t> segments;
+    };
+    // Applied segments of the latest version of each segmented response, by response name without the version
+    std::map<ndn::Name, AppliedSegments> appliedSegments;
+
+    struct PrecomputationJob {
+        SyncTree* subtree;
+        size_t since;
+        unsigned long revision;
+    };
+    std::vector<SyncTree*> ownRequestLevelSubtrees;
+    RequestBundler requestBundler;
+    ResponseTuner responseTuner;
+    ChangeJournal changeJournal;
+    SessionTable sessionTable;
+    // Identifies the requests of this consumer towards producers keeping sessions
+    uint64_t sessionId = 0;
+    std::thread precomputationThread;
+    std::mutex precomputationMutex;
+    std::condition_variable precomputationCondition;
+    std::deque<PrecomputationJob> precomputationJobs;
+    std::atomic<unsigned long> precomputed_responses { 0 };
+
 
     unsigned long received_chunk_responses = 0;
     unsigned long received_subtree_responses = 0;
     unsigned long received_unknown_hash_responses = 0;
+    unsigned long manifest_fetches = 0;
+    std::atomic<unsigned long> signed_manifests { 0 };
+    unsigned long manifest_verification_failures = 0;
+    unsigned long responses_not_in_manifest = 0;
+    unsigned long invalid_signature_responses = 0;
+    std::atomic<unsigned long> segmented_responses { 0 };
+    std::atomic<unsigned long> sent_segments { 0 };
+    unsigned long received_segments = 0;
+    unsigned long segment_timeouts = 0;
+    unsigned long aborted_segment_fetches = 0;
+    unsigned long parked_interests = 0;
+    unsigned long deduplicated_requests = 0;
+    unsigned long cancelled_requests = 0;
+    unsigned long max_inflight_requests = 0;
+    unsigned long backed_off_polls = 0;
+    unsigned long sent_unchanged_nacks = 0;
+    unsigned long region_reactivations = 0;
+    unsigned long request_timeouts = 0;
+    unsigned long retransmitted_requests = 0;
+    unsigned long abandoned_requests = 0;
+    unsigned long congestion_nacks = 0;
+    unsigned long congestion_window_decreases = 0;
+    unsigned long deferred_polls = 0;
+    unsigned long aggregated_requests = 0;
+    unsigned long aggregated_subtree_requests = 0;
+    unsigned long received_aggregated_responses = 0;
+    unsigned long received_aggregated_requests = 0;
+    unsigned long omitted_aggregated_subtrees = 0;
+    unsigned long tuned_parameter_changes = 0;
+    unsigned long digest_requests = 0;
+    std::atomic<unsigned long> received_digest_requests { 0 };
+    unsigned long full_hash_requests = 0;
+    unsigned long received_peer_states = 0;
+    unsigned long peer_state_requests = 0;
+    unsigned long skipped_passive_polls = 0;
+    unsigned long sent_heartbeats = 0;
+    unsigned long received_heartbeats = 0;
+    unsigned long heartbeat_requests = 0;
+    unsigned long skipped_heartbeat_polls = 0;
+    unsigned long session_delta_responses = 0;
+    unsigned long journal_misses = 0;
+    unsigned long session_requests = 0;
+    unsigned long revision_requests = 0;
+    unsigned long received_revision_requests = 0;
+    unsigned long received_snapshots = 0;
+    unsigned long failed_snapshots = 0;
+    unsigned long sent_snapshots = 0;
 };
 
 }
@@ -0,0 +1,65 @@
+#include "SessionTable.h"
+
+#include <algorithm>
+
+namespace quadtree {
+
+SessionTable::SessionTable(size_t maxSessions, size_t maxSubtrees, std::chrono::milliseconds expiry)
+    : maxSessions(std::max((size_t)1, maxSessions))
+    , maxSubtrees(std::max((size_t)1, maxSubtrees))
+    , expiry(expiry)
+{
+}
+
+unsigned long SessionTable::acknowledge(uint64_t session, const ndn::Name& subtree, unsigned long revision)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (sessions.find(session) == sessions.end()) {
+        expire(now);
+    }
+    Session& entry = sessions[session];
+    entry.lastRequest = now;
+
+    if (revision > 0) {
+        unsigned long& acknowledged = entry.acknowledged[subtree];
+        acknowledged = std::max(acknowledged, revision);
+        if (entry.acknowledged.size() > maxSubtrees) {
+            auto oldest = std::min_element(entry.acknowledged.begin(), entry.acknowledged.end(),
+                [](const std::pair<const ndn::Name, unsigned long>& a,
+                    const std::pair<const ndn::Name, unsigned long>& b) { return a.second < b.second; });
+            entry.acknowledged.erase(oldest);
+        }
+    }
+
+    // The subtree and all subtrees containing it
+    unsigned long held = 0;
+    for (size_t length = 0; length <= subtree.size(); length++) {
+        auto acknowledged = entry.acknowledged.find(subtree.getPrefix(length));
+        if (acknowledged != entry.acknowledged.end()) {
+            held = std::max(held, acknowledged->second);
+        }
+    }
+    return held;
+}
+
+void SessionTable::expire(std::chrono::steady_clock::time_point now)
+{
+    for (auto it = sessions.begin(); it != sessions.end();) {
+        if (now - it->second.lastRequest > expiry) {
+            it = sessions.erase(it);
+            expiredSessions++;
+        } else {
+            ++it;
+        }
+    }
+    if (sessions.size() >= maxSessions) {
+        auto leastRecent = std::min_element(sessions.begin(), sessions.end(),
+            [](const std::pair<const uint64_t, Session>& a, const std::pair<const uint64_t, Session>& b) {
+                return a.second.lastRequest < b.second.lastRequest;
+            });
+        sessions.erase(leastRecent);
+        expiredSessions++;
+    }
+}
+
+}
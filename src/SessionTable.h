@@ -0,0 +1,65 @@
+#ifndef QUADTREESYNCEVALUATION_SESSIONTABLE_H
+#define QUADTREESYNCEVALUATION_SESSIONTABLE_H
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+
+#include <ndn-cxx/name.hpp>
+
+namespace quadtree {
+
+/**
+ * Producer side record of the consumers' sessions. For every session, it stores the latest revision of the producer's
+ * tree the consumer acknowledged for each subtree. A consumer which acknowledged a subtree holds all changes of the
+ * subtree up to that revision, so the changes of its lower subtrees are known as well.
+ *
+ * Sessions expire when their consumer did not send a request for a while. The number of sessions and the number of
+ * subtrees per session are limited, the least recently used sessions and the oldest acknowledgements are dropped.
+ */
+class SessionTable {
+
+public:
+    /**
+     * @param maxSessions Maximum number of sessions
+     * @param maxSubtrees Maximum number of acknowledged subtrees per session
+     * @param expiry Time after the last request of a session until it is dropped
+     */
+    SessionTable(size_t maxSessions, size_t maxSubtrees, std::chrono::milliseconds expiry);
+
+    /**
+     * Records the revision a consumer acknowledged for a subtree and returns the latest revision the consumer holds
+     * for the subtree, which is the latest acknowledged revision of the subtree or of any subtree containing it.
+     * @param session Session identifier chosen by the consumer
+     * @param subtree Name of the subtree below the world prefix
+     * @param revision Revision acknowledged with the request, 0 if none
+     * @return The latest revision held by the consumer, 0 if unknown
+     */
+    unsigned long acknowledge(uint64_t session, const ndn::Name& subtree, unsigned long revision);
+
+    size_t size() const { return sessions.size(); }
+
+    unsigned long getExpiredSessions() const { return expiredSessions; }
+
+protected:
+    struct Session {
+        std::chrono::steady_clock::time_point lastRequest;
+        std::map<ndn::Name, unsigned long> acknowledged;
+    };
+
+    /**
+     * Drops expired sessions and, if the table is full, the least recently used one
+     */
+    void expire(std::chrono::steady_clock::time_point now);
+
+    size_t maxSessions;
+    size_t maxSubtrees;
+    std::chrono::milliseconds expiry;
+    std::map<uint64_t, Session> sessions;
+
+    unsigned long expiredSessions = 0;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_SESSIONTABLE_H
@@ -0,0 +1,101 @@
+#include "SyncClientOptions.h"
+
+#include <stdexcept>
+
+namespace po = boost::program_options;
+
+namespace quadtree {
+
+void addSyncClientOptions(po::options_description& desc)
+{
+    /* clang-format off */
+    desc.add_options()
+        ("precomputeResponses", po::bool_switch(), "Precompute the most likely responses right after each publish tick")
+        ("signingMode", po::value<std::string>()->default_value("identity"), "Signature of sync responses: identity, sha256 or hmac")
+        ("hmacKey", po::value<std::string>()->default_value(""), "Base64 encoded group key for HMAC signatures")
+        ("signingThreads", po::value<int>()->default_value(0), "Number of threads signing sync responses, 0 signs on the face thread")
+        ("manifestSigning", po::bool_switch(), "Sign one manifest per publish tick instead of every sync response")
+        ("trustAnchor", po::value<std::vector<std::string>>()->default_value(std::vector<std::string>(), ""), "Certificate file of a trusted producer key, can be repeated")
+        ("certificate", po::value<std::vector<std::string>>()->default_value(std::vector<std::string>(), ""), "Certificate file of a producer key issued by a trust anchor, can be repeated")
+        ("verifySignatures", po::bool_switch(), "Verify the signatures of received sync responses")
+        ("verificationThreads", po::value<int>()->default_value(0), "Number of threads verifying signatures, 0 verifies on the face thread")
+        ("maxSegmentSize", po::value<int>()->default_value(7000), "Maximum size of a sync response segment in bytes")
+        ("segmentWindow", po::value<int>()->default_value(4), "Number of segment Interests in flight")
+        ("longPolling", po::bool_switch(), "Keep one long-lived Interest per remote region, answered on change")
+        ("longPollLifetime", po::value<int>()->default_value(4000), "Lifetime of long-lived Interests in ms")
+        ("requestWindow", po::value<int>()->default_value(0), "Subtree requests in flight per remote region, 0 for no limit")
+        ("adaptivePolling", po::bool_switch(), "Back off the poll interval of remote regions without changes")
+        ("maxPollInterval", po::value<int>()->default_value(8000), "Maximum poll interval of idle regions in ms")
+        ("maxRetransmissions", po::value<int>()->default_value(0), "Retransmissions of lost subtree requests")
+        ("congestionControl", po::bool_switch(), "Limit Interests per remote region by an AIMD congestion window")
+        ("aggregateRequests", po::bool_switch(), "Request several subtrees of a remote region with one Interest")
+        ("maxAggregatedSubtrees", po::value<int>()->default_value(16), "Maximum subtrees per aggregated request")
+        ("autoTune", po::bool_switch(), "Tune levelDifference and chunkThreshold per subtree while running")
+        ("budgetedResponses", po::bool_switch(), "Fill responses up to maxSegmentSize instead of using chunkThreshold")
+        ("inlineThreshold", po::value<int>()->default_value(0), "Inline changes of lower subtrees with at most this many changes")
+        ("digestRequests", po::bool_switch(), "Send own lower level hashes with subtree requests")
+        ("digestDepth", po::value<int>()->default_value(1), "Levels below the requested subtree of the sent hashes")
+        ("hashBits", po::value<int>()->default_value(0), "Truncate lower level hashes in responses to 16 or 32 bits")
+        ("bidirectionalSync", po::bool_switch(), "Poll only one direction of each region pair, sending the own state along")
+        ("digestHeartbeat", po::bool_switch(), "Announce the own region hash every tick instead of being polled")
+        ("sessions", po::bool_switch(), "Keep per-consumer sessions and answer with the exact changes since their last ack")
+        ("journalLength", po::value<int>()->default_value(20), "Number of publish ticks kept in the change journal")
+        ("maxSessions", po::value<int>()->default_value(64), "Maximum number of consumer sessions of the producer")
+        ("sessionExpiry", po::value<int>()->default_value(10000), "Milliseconds without request after which a session expires")
+        ("revisionRequests", po::bool_switch(), "Request subtrees by the last known revision instead of the hash")
+        ("snapshotBootstrap", po::bool_switch(), "Fetch a snapshot of every remote region before synchronizing changes");
+    /* clang-format on */
+}
+
+SyncClientOptions SyncClientOptions::fromVariablesMap(const po::variables_map& vm)
+{
+    SyncClientOptions options;
+    options.precomputeResponses = vm["precomputeResponses"].as<bool>();
+    options.signingMode = parseSigningMode(vm["signingMode"].as<std::string>());
+    options.hmacKey = vm["hmacKey"].as<std::string>();
+    options.signingThreads = vm["signingThreads"].as<int>();
+    options.manifestSigning = vm["manifestSigning"].as<bool>();
+    options.trustAnchors = vm["trustAnchor"].as<std::vector<std::string>>();
+    options.certificates = vm["certificate"].as<std::vector<std::string>>();
+    options.verifySignatures = vm["verifySignatures"].as<bool>();
+    options.verificationThreads = vm["verificationThreads"].as<int>();
+    options.maxSegmentSize = vm["maxSegmentSize"].as<int>();
+    options.segmentWindow = vm["segmentWindow"].as<int>();
+    options.longPolling = vm["longPolling"].as<bool>();
+    options.longPollLifetime = vm["longPollLifetime"].as<int>();
+    options.requestWindow = vm["requestWindow"].as<int>();
+    options.adaptivePolling = vm["adaptivePolling"].as<bool>();
+    options.maxPollInterval = vm["maxPollInterval"].as<int>();
+    options.maxRetransmissions = vm["maxRetransmissions"].as<int>();
+    options.congestionControl = vm["congestionControl"].as<bool>();
+    options.aggregateRequests = vm["aggregateRequests"].as<bool>();
+    options.maxAggregatedSubtrees = vm["maxAggregatedSubtrees"].as<int>();
+    options.autoTune = vm["autoTune"].as<bool>();
+    options.budgetedResponses = vm["budgetedResponses"].as<bool>();
+    options.inlineThreshold = vm["inlineThreshold"].as<int>();
+    options.digestRequests = vm["digestRequests"].as<bool>();
+    options.digestDepth = vm["digestDepth"].as<int>();
+    options.hashBits = vm["hashBits"].as<int>();
+    options.bidirectionalSync = vm["bidirectionalSync"].as<bool>();
+    options.digestHeartbeat = vm["digestHeartbeat"].as<bool>();
+    options.sessions = vm["sessions"].as<bool>();
+    options.journalLength = vm["journalLength"].as<int>();
+    options.maxSessions = vm["maxSessions"].as<int>();
+    options.sessionExpiry = vm["sessionExpiry"].as<int>();
+    options.revisionRequests = vm["revisionRequests"].as<bool>();
+    options.snapshotBootstrap = vm["snapshotBootstrap"].as<bool>();
+
+    // Consumers could not verify any manifest, so no response would ever be applied
+    if (options.manifestSigning && options.verifySignatures && options.signingMode == SigningMode::IDENTITY
+        && options.trustAnchors.empty()) {
+        throw std::invalid_argument("manifestSigning with identity signatures requires a trustAnchor");
+    }
+    // Aggregated requests only carry the hash value of each subtree
+    if (options.aggregateRequests && (options.sessions || options.revisionRequests || options.digestRequests)) {
+        throw std::invalid_argument(
+            "aggregateRequests cannot be combined with sessions, revisionRequests or digestRequests");
+    }
+    return options;
+}
+
+}
@@ -0,0 +1,269 @@
+#ifndef QUADTREESYNCEVALUATION_SYNCCLIENTOPTIONS_H
+#define QUADTREESYNCEVALUATION_SYNCCLIENTOPTIONS_H
+
+#include <boost/program_options.hpp>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "security/SigningPool.h"
+
+namespace quadtree {
+
+/**
+ * Optional features of the ServerModeSyncClient and P2PModeSyncClient. The defaults reproduce the behaviour of the
+ * plain protocol.
+ */
+struct SyncClientOptions {
+    /**
+     * If true, the responses to the most likely requests (one per own subtree on the request level, since the previous
+     * hash) are computed, compressed and signed in the background right after every publish tick.
+     */
+    bool precomputeResponses = false;
+
+    /**
+     * Signature type of the produced Data packets
+     */
+    SigningMode signingMode = SigningMode::IDENTITY;
+
+    /**
+     * Base64 encoded key shared within the group of servers, required for SigningMode::HMAC
+     */
+    std::string hmacKey;
+
+    /**
+     * Number of worker threads signing Data packets. With 0, packets are signed on the thread creating them.
+     */
+    unsigned signingThreads = 0;
+
+    /**
+     * If true, sync responses only carry a DigestSha256 signature. Their digests are listed in a manifest per publish
+     * tick, which is signed according to signingMode. Consumers verify the manifest once and check the digests.
+     */
+    bool manifestSigning = false;
+
+    /**
+     * Certificate files of keys that are trusted for asymmetric signatures
+     */
+    std::vector<std::string> trustAnchors;
+
+    /**
+     * Certificate files of producer keys. They are accepted when issued by a trust anchor.
+     */
+    std::vector<std::string> certificates;
+
+    /**
+     * If true, the signatures of all received sync responses are verified before they are applied
+     */
+    bool verifySignatures = false;
+
+    /**
+     * Number of worker threads verifying signatures. With 0, packets are verified on the face thread.
+     */
+    unsigned verificationThreads = 0;
+
+    /**
+     * Maximum size of a Data packet carrying a sync response, including its name and signature, within the NDN packet
+     * size limit. Larger responses are split into segments.
+     */
+    size_t maxSegmentSize = 7000;
+
+    /**
+     * Maximum number of segment Interests in flight while fetching a segmented response
+     */
+    unsigned segmentWindow = 4;
+
+    /**
+     * If true, producers hold Interests for unchanged subtrees and answer them right after the next publish tick
+     * changed the subtree. Consumers keep one of these Interests outstanding per remote region instead of polling.
+     */
+    bool longPolling = false;
+
+    /**
+     * Lifetime of the long-lived Interests in milliseconds
+     */
+    unsigned longPollLifetime = 4000;
+
+    /**
+     * Maximum number of subtree requests in flight per remote region, 0 for no limit
+     */
+    unsigned requestWindow = 0;
+
+    /**
+     * If true, the poll interval of a remote region doubles with every poll that brought no change, up to
+     * maxPollInterval. It returns to the sync request interval on the first change of the region or a neighbour.
+     * Producers answer polls for unchanged subtrees with a Nack, polls which time out keep the interval.
+     */
+    bool adaptivePolling = false;
+
+    /**
+     * Maximum poll interval of an idle remote region in milliseconds
+     */
+    unsigned maxPollInterval = 8000;
+
+    /**
+     * Maximum number of retransmissions of a lost subtree request. If greater than 0, the lifetime of subtree requests
+     * is the retransmission timeout estimated from the round trip times to the producer plus one publish period.
+     */
+    unsigned maxRetransmissions = 0;
+
+    /**
+     * If true, polls and subtree requests towards a remote region are limited by an AIMD congestion window, which is
+     * halved on congestion Nacks and lost subtree requests. Subtree requests are kept alive like with
+     * maxRetransmissions, so that only requests the producer had time to answer count as lost.
+     */
+    bool congestionControl = false;
+
+    /**
+     * If true, queued subtree requests of a remote region are bundled into a single Interest listing the subtrees and
+     * their hash values. The producer answers with one Data packet containing all responses. Not combined with
+     * sessions, revisionRequests or digestRequests, subtrees requested with full hash values use plain Interests.
+     */
+    bool aggregateRequests = false;
+
+    /**
+     * Maximum number of subtrees requested with one aggregated Interest
+     */
+    unsigned maxAggregatedSubtrees = 16;
+
+    /**
+     * If true, the producer tunes lowerLevels and chunkThreshold for each own subtree on the request level according
+     * to the observed changes, response sizes and descents. The configured values are used as starting point.
+     */
+    bool autoTune = false;
+
+    /**
+     * If true, the size of a response decides instead of the chunk threshold: Changes are sent as chunks as long as
+     * the serialized response and the packet overhead fit into maxSegmentSize. Larger responses contain lower level
+     * hash values and the changes of as many lower level subtrees as fit, so every response fits into a single packet.
+     */
+    bool budgetedResponses = false;
+
+    /**
+     * If greater than 0, responses with lower level hash values additionally contain the changes of all lower level
+     * subtrees with at most inlineThreshold changes, which saves the round trip for requesting them
+     */
+    unsigned inlineThreshold = 0;
+
+    /**
+     * If true, subtree requests carry the requester's hash values of the subtrees digestDepth levels below. The
+     * producer compares them and answers with the changes of the differing subtrees or the hash values one level below
+     * them, instead of the requester descending level by level.
+     */
+    bool digestRequests = false;
+
+    /**
+     * Number of levels below a requested subtree whose hash values are sent with digest requests, at most 3
+     */
+    unsigned digestDepth = 1;
+
+    /**
+     * If 16 or 32, lower level hash values in responses are truncated to this number of bits. The hash value of the
+     * requested subtree is always sent in full. If it still differs after all truncated hash values matched, the
+     * consumer requests the subtree again with full hash values. 0 for full hash values.
+     */
+    unsigned hashBits = 0;
+
+    /**
+     * If true, only one producer of each pair of regions polls the other one and sends the hash value of its own
+     * region along. The polled producer requests the poller's region if it differs, instead of polling it as well. A
+     * region whose producer stopped polling is polled again. Not combined with longPolling.
+     */
+    bool bidirectionalSync = false;
+
+    /**
+     * If true, every producer sends a notification Interest with the hash value of its region to
+     * <worldPrefix>/digest after each publish tick, which has to be forwarded to all consumers by a multicast
+     * strategy. Consumers only request regions whose hash value differs and stop polling regions with recent
+     * heartbeats.
+     */
+    bool digestHeartbeat = false;
+
+    /**
+     * If true, consumers identify their requests with a session and acknowledge the revision of the producer's tree
+     * which brought a subtree in sync. The producer keeps the changes of the last journalLength publish ticks and
+     * answers with exactly the changes since the acknowledged revision, instead of deriving them from hash values.
+     */
+    bool sessions = false;
+
+    /**
+     * Number of publish ticks whose changes are kept for sessions and revision requests
+     */
+    unsigned journalLength = 20;
+
+    /**
+     * Maximum number of sessions kept by a producer. The least recently used session is dropped first.
+     */
+    unsigned maxSessions = 64;
+
+    /**
+     * Time in milliseconds without a request after which a session is dropped
+     */
+    unsigned sessionExpiry = 10000;
+
+    /**
+     * If true, responses carry the producer's publish revision. Consumers request the changes since the last revision
+     * they were in sync with (<subtree>/r/<revision>) instead of sending their hash value, which producers answer from
+     * the change journal filtered by the area of the subtree (see journalLength). Requests of all consumers in sync
+     * share the same name.
+     */
+    bool revisionRequests = false;
+
+    /**
+     * If true, a server starts the synchronization of every remote region by fetching a snapshot of it
+     * (<subtree>/snapshot), which contains all chunks of the region in a single segmented response. Afterwards, the
+     * region is synchronized by its changes as usual.
+     */
+    bool snapshotBootstrap = false;
+
+    /**
+     * Reads the options added by addSyncClientOptions(..) from the parsed command line
+     */
+    static SyncClientOptions fromVariablesMap(const boost::program_options::variables_map& vm);
+
+    friend std::ostream& operator<<(std::ostream& os, const SyncClientOptions& options)
+    {
+        os << "precomputeResponses:\t" << options.precomputeResponses << std::endl;
+        os << "signingMode:\t" << signingModeToString(options.signingMode) << std::endl;
+        os << "signingThreads:\t" << options.signingThreads << std::endl;
+        os << "manifestSigning:\t" << options.manifestSigning << std::endl;
+        os << "verifySignatures:\t" << options.verifySignatures << std::endl;
+        os << "verificationThreads:\t" << options.verificationThreads << std::endl;
+        os << "maxSegmentSize:\t" << options.maxSegmentSize << std::endl;
+        os << "segmentWindow:\t" << options.segmentWindow << std::endl;
+        os << "longPolling:\t" << options.longPolling << std::endl;
+        os << "longPollLifetime:\t" << options.longPollLifetime << std::endl;
+        os << "requestWindow:\t" << options.requestWindow << std::endl;
+        os << "adaptivePolling:\t" << options.adaptivePolling << std::endl;
+        os << "maxPollInterval:\t" << options.maxPollInterval << std::endl;
+        os << "maxRetransmissions:\t" << options.maxRetransmissions << std::endl;
+        os << "congestionControl:\t" << options.congestionControl << std::endl;
+        os << "aggregateRequests:\t" << options.aggregateRequests << std::endl;
+        os << "maxAggregatedSubtrees:\t" << options.maxAggregatedSubtrees << std::endl;
+        os << "autoTune:\t" << options.autoTune << std::endl;
+        os << "budgetedResponses:\t" << options.budgetedResponses << std::endl;
+        os << "inlineThreshold:\t" << options.inlineThreshold << std::endl;
+        os << "digestRequests:\t" << options.digestRequests << std::endl;
+        os << "digestDepth:\t" << options.digestDepth << std::endl;
+        os << "hashBits:\t" << options.hashBits << std::endl;
+        os << "bidirectionalSync:\t" << options.bidirectionalSync << std::endl;
+        os << "digestHeartbeat:\t" << options.digestHeartbeat << std::endl;
+        os << "sessions:\t" << options.sessions << std::endl;
+        os << "journalLength:\t" << options.journalLength << std::endl;
+        os << "maxSessions:\t" << options.maxSessions << std::endl;
+        os << "sessionExpiry:\t" << options.sessionExpiry << std::endl;
+        os << "revisionRequests:\t" << options.revisionRequests << std::endl;
+        os << "snapshotBootstrap:\t" << options.snapshotBootstrap << std::endl;
+        return os;
+    }
+};
+
+/**
+ * Adds the command line options of all fields of SyncClientOptions
+ */
+void addSyncClientOptions(boost::program_options::options_description& desc);
+
+}
+
+#endif // QUADTREESYNCEVALUATION_SYNCCLIENTOPTIONS_H
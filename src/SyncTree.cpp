@@ -4,6 +4,8 @@
 
 #include "SyncTree.h"
 
+#include <google/protobuf/io/coded_stream.h>
+
 namespace quadtree {
 
 unsigned SyncTree::countInflatedNodes()
@@ -112,24 +114,15 @@ Chunk* SyncTree::inflateChunk(unsigned x, unsigned y, bool rememberChanged)
     unsigned yHalf = area.topleft.y + ((area.bottomRight.y - area.topleft.y) / 2);
 
     unsigned index;
-    bool firstXHalf = true, firstYHalf = true;
 
     if (x < xHalf && y < yHalf) { // topleft
         index = 0;
-        firstXHalf = true;
-        firstYHalf = true;
     } else if (x >= xHalf && y < yHalf) { // topright
         index = 1;
-        firstXHalf = false;
-        firstYHalf = true;
     } else if (x < xHalf && y >= yHalf) {
         index = 2;
-        firstXHalf = true;
-        firstYHalf = false;
     } else {
         index = 3;
-        firstXHalf = false;
-        firstYHalf = false;
     }
 
     if (finalLevel()) {
@@ -146,16 +139,7 @@ Chunk* SyncTree::inflateChunk(unsigned x, unsigned y, bool rememberChanged)
         return pChunk;
 
     } else {
-        if (childs.at(index) == nullptr) {
-
-            Point p1(firstXHalf ? area.topleft.x : xHalf, firstYHalf ? area.topleft.y : yHalf);
-            Point p2(
-                p1.x + (area.bottomRight.x - area.topleft.x) / 2, p1.y + (area.bottomRight.y - area.topleft.y) / 2);
-            SyncTree* child = new SyncTree(Rectangle(p1, p2), this, this->level + 1, this->numChilds);
-
-            childs.at(index) = child;
-        }
-        Chunk* pChunk = childs.at(index)->inflateChunk(x, y, rememberChanged);
+        Chunk* pChunk = inflateChild(index)->inflateChunk(x, y, rememberChanged);
 
         // Remember changed chunk
         if (rememberChanged && std::find(changedChunks.begin(), changedChunks.end(), pChunk) == changedChunks.end()) {
@@ -166,35 +150,118 @@ Chunk* SyncTree::inflateChunk(unsigned x, unsigned y, bool rememberChanged)
     }
 }
 
-std::size_t SyncTree::getHash() const { return currentHash; }
+SyncTree* SyncTree::inflateChild(unsigned index)
+{
+    if (childs.at(index) == nullptr) {
+        const unsigned xHalf = area.topleft.x + ((area.bottomRight.x - area.topleft.x) / 2);
+        const unsigned yHalf = area.topleft.y + ((area.bottomRight.y - area.topleft.y) / 2);
+        // Index 0 is topleft, 1 topright, 2 bottomleft and 3 bottomright
+        Point p1(index % 2 == 0 ? area.topleft.x : xHalf, index < 2 ? area.topleft.y : yHalf);
+        Point p2(p1.x + (area.bottomRight.x - area.topleft.x) / 2, p1.y + (area.bottomRight.y - area.topleft.y) / 2);
+        childs.at(index) = new SyncTree(Rectangle(p1, p2), this, this->level + 1, this->numChilds);
+    }
+    return childs.at(index);
+}
 
-void SyncTree::reHash(bool force)
+void SyncTree::bulkLoad(const std::vector<Chunk>& chunks)
 {
-    if (force || !changedChunks.empty()) {
-        std::size_t hash_value = 0;
-        boost::hash_combine(hash_value, area.topleft.x);
-        boost::hash_combine(hash_value, area.topleft.y);
-        boost::hash_combine(hash_value, area.bottomRight.x);
-        boost::hash_combine(hash_value, area.bottomRight.y);
+    MortonChunks sortedChunks;
+    sortedChunks.reserve(chunks.size());
+    for (const Chunk& chunk : chunks) {
+        if (area.isPointInRectangle(chunk.pos)) {
+            const Point offset(chunk.pos.x - area.topleft.x, chunk.pos.y - area.topleft.y);
+            sortedChunks.emplace_back(offset.toMorton(), chunk);
+        }
+    }
+    // Stable, so the later version of a chunk listed twice is loaded last
+    auto compare = [](const std::pair<uint64_t, Chunk>& a, const std::pair<uint64_t, Chunk>& b) {
+        return a.first < b.first;
+    };
+    if (!std::is_sorted(sortedChunks.begin(), sortedChunks.end(), compare)) {
+        std::stable_sort(sortedChunks.begin(), sortedChunks.end(), compare);
+    }
 
-        for (SyncTree* child : childs) {
-            if (child != nullptr) {
-                child->reHash(force);
-                boost::hash_combine(hash_value, child->getHash());
+    loadChunks(sortedChunks.begin(), sortedChunks.end());
+    for (SyncTree* ancestor = parent; ancestor != nullptr; ancestor = ancestor->parent) {
+        ancestor->updateLoadedHash();
+    }
+}
+
+void SyncTree::loadChunks(MortonChunks::const_iterator first, MortonChunks::const_iterator last)
+{
+    // The two bits of the Morton codes below the ones of the childs' width are the index of the child
+    const unsigned shift = 2 * ((unsigned)log2(area.bottomRight.x - area.topleft.x) - 1);
+    while (first != last) {
+        const unsigned index = (first->first >> shift) & 3;
+        auto end = std::find_if(first, last,
+            [shift, index](const std::pair<uint64_t, Chunk>& chunk) { return ((chunk.first >> shift) & 3) != index; });
+        if (finalLevel()) {
+            for (; first != end; ++first) {
+                if (data.at(index) == nullptr) {
+                    data.at(index) = new Chunk(first->second.pos, first->second.data);
+                } else {
+                    data.at(index)->data = first->second.data;
+                }
             }
+        } else {
+            inflateChild(index)->loadChunks(first, end);
+            first = end;
+        }
+    }
+    updateLoadedHash();
+}
+
+void SyncTree::updateLoadedHash()
+{
+    const std::size_t hash_value = computeHash();
+    if (this->currentHash != hash_value) {
+        // The changes leading to the loaded state are unknown
+        this->storedChanges = std::pair<std::size_t, std::vector<Chunk*>>(hash_value, std::vector<Chunk*>());
+        this->currentHash = hash_value;
+    }
+}
+
+std::size_t SyncTree::getHash() const { return currentHash; }
+
+std::size_t SyncTree::computeHash() const
+{
+    std::size_t hash_value = 0;
+    boost::hash_combine(hash_value, area.topleft.x);
+    boost::hash_combine(hash_value, area.topleft.y);
+    boost::hash_combine(hash_value, area.bottomRight.x);
+    boost::hash_combine(hash_value, area.bottomRight.y);
+
+    for (SyncTree* child : childs) {
+        if (child != nullptr) {
+            boost::hash_combine(hash_value, child->getHash());
         }
+    }
 
-        for (Chunk* chunk : data) {
-            if (chunk != nullptr) {
-                boost::hash_combine(hash_value, chunk->hashChunk());
+    for (Chunk* chunk : data) {
+        if (chunk != nullptr) {
+            boost::hash_combine(hash_value, chunk->hashChunk());
+        }
+    }
+    return hash_value;
+}
+
+void SyncTree::reHash(bool force, unsigned long revision)
+{
+    if (force || !changedChunks.empty()) {
+        for (SyncTree* child : childs) {
+            if (child != nullptr) {
+                child->reHash(force, revision);
             }
         }
+        const std::size_t hash_value = computeHash();
 
         // Only store "new revision" if something in the tree changed
         if (this->currentHash != hash_value) {
 
             this->storedChanges = std::pair<std::size_t, std::vector<Chunk*>>(this->currentHash, changedChunks);
 
+            this->revision = revision;
+
             this->currentHash = hash_value;
             this->changedChunks = std::vector<Chunk*>();
         }
@@ -476,33 +543,39 @@ SyncRequestResponse SyncTree::syncRequest(size_t since, unsigned nextNLevels, un
         }
 
     } else { // If the given hash is unknown, all chunks need to be enumerated
+        syncRequestResponse = unknownStateResponse(nextNLevels, threshold);
+    }
 
-        unsigned remainingLevels = getMaxLevel() - (getLevel() - 1);
-        unsigned allChunks = pow(pow(2, remainingLevels), 2);
-        //        unsigned allChunks = this->countInflatedChunks();
+    return syncRequestResponse;
+}
 
-        if (allChunks > threshold * 4) { // If there are more chunks than the threshold, return lower level hashes
-            NextNLevelsResponseType nextNLevelResponse = hashValuesOfNextNLevels(nextNLevels * 2, since);
-            syncRequestResponse.containsChanges = false;
-            syncRequestResponse.nextNLevelsResponse = nextNLevelResponse;
-        } else {
-            std::vector<SyncTree*> finalLevels = this->enumerateLowerLevel(remainingLevels - 1);
-            std::vector<Chunk*> chunks;
-            for (SyncTree* treeNode : finalLevels) {
-                if (treeNode != nullptr) {
-                    for (Chunk* chunk : treeNode->data) {
-                        if (chunk != nullptr) {
-                            chunks.push_back(chunk);
-                        }
+SyncRequestResponse SyncTree::unknownStateResponse(unsigned nextNLevels, unsigned threshold)
+{
+    SyncRequestResponse syncRequestResponse = SyncRequestResponse();
+
+    unsigned remainingLevels = getMaxLevel() - (getLevel() - 1);
+    unsigned allChunks = pow(pow(2, remainingLevels), 2);
+    //        unsigned allChunks = this->countInflatedChunks();
+
+    if (allChunks > threshold * 4) { // If there are more chunks than the threshold, return lower level hashes
+        syncRequestResponse.containsChanges = false;
+        syncRequestResponse.nextNLevelsResponse = NextNLevelsResponseType(hashValuesOfNextNLevels(nextNLevels * 2), -1);
+    } else {
+        std::vector<SyncTree*> finalLevels = this->enumerateLowerLevel(remainingLevels - 1);
+        std::vector<Chunk*> chunks;
+        for (SyncTree* treeNode : finalLevels) {
+            if (treeNode != nullptr) {
+                for (Chunk* chunk : treeNode->data) {
+                    if (chunk != nullptr) {
+                        chunks.push_back(chunk);
                     }
                 }
             }
-            std::pair<bool, std::vector<Chunk*>> chunkResponse(false, chunks);
-            syncRequestResponse.changeReponse = chunkResponse;
-            syncRequestResponse.containsChanges = true;
         }
+        std::pair<bool, std::vector<Chunk*>> chunkResponse(false, chunks);
+        syncRequestResponse.changeReponse = chunkResponse;
+        syncRequestResponse.containsChanges = true;
     }
-
     return syncRequestResponse;
 }
 std::pair<bool, std::vector<SyncTree*>> SyncTree::applySyncResponse(const SyncResponse& syncResponse)
@@ -510,40 +583,193 @@ std::pair<bool, std::vector<SyncTree*>> SyncTree::applySyncResponse(const SyncRe
 
     if (syncResponse.chunkdata()) { // Apply chunk changes
 
-        // Apply changes on the root
-        SyncTree* root = this;
-        while (root->parent != nullptr) {
-            root = root->parent;
-        }
-
-        for (const auto& chunk : syncResponse.chunks()) {
-            root->change(chunk.x(), chunk.y(), chunk.data());
-        }
-        root->reHash();
+        applyChunks(syncResponse);
         const auto messageHash = (size_t)syncResponse.curhash();
+        if (messageHash == this->getHash() && syncResponse.has_subtreerevision()) {
+            this->remoteRevision = syncResponse.subtreerevision();
+        }
         return std::pair<bool, std::vector<SyncTree*>>(messageHash == this->getHash(), std::vector<SyncTree*>());
 
     } else { // Compare subtree hashes
 
+        // Subtrees whose changes are inlined are in sync afterwards
+        if (syncResponse.chunks_size() > 0) {
+            applyChunks(syncResponse);
+        }
+        if (syncResponse.has_snapshot()) {
+            applySnapshot(syncResponse.snapshot());
+        }
+
         std::vector<SyncTree*> treesToCompare;
         auto treeNodes = enumerateLowerLevel(syncResponse.treelevel() - getLevel());
+        // A segment of a split response only contains the hash values starting at hashOffset
+        const unsigned offset = syncResponse.hashoffset();
+        const unsigned hashBits = syncResponse.hashbits();
         for (unsigned i = 0; i < (unsigned)syncResponse.hashvalues_size(); i++) {
+            const unsigned node = offset + i;
 
-            if ((treeNodes.at(i) == nullptr && syncResponse.hashvalues(i) != 0)
-                || (treeNodes.at(i) != nullptr && syncResponse.hashvalues(i) != treeNodes.at(i)->getHash())) {
-                if (treeNodes.at(i) == nullptr) {
-                    treeNodes.at(i) = inflateSubtree(syncResponse.treelevel(), i);
+            if ((treeNodes.at(node) == nullptr && syncResponse.hashvalues(i) != 0)
+                || (treeNodes.at(node) != nullptr
+                    && syncResponse.hashvalues(i) != truncateHash(treeNodes.at(node)->getHash(), hashBits))) {
+                if (treeNodes.at(node) == nullptr) {
+                    treeNodes.at(node) = inflateSubtree(syncResponse.treelevel(), node);
                 }
-                treesToCompare.push_back(treeNodes.at(i));
+                treesToCompare.push_back(treeNodes.at(node));
             }
         }
 
         const auto messageHash = (size_t)syncResponse.curhash();
+        if (messageHash == this->getHash() && syncResponse.has_subtreerevision()) {
+            this->remoteRevision = syncResponse.subtreerevision();
+        }
         return std::pair<bool, std::vector<SyncTree*>>(messageHash == this->getHash(), treesToCompare);
     }
 }
 
-SyncResponse SyncTree::prepareSyncResponse(size_t hashValue, unsigned lowerLevels, unsigned chunkThreshold)
+void SyncTree::applyChunks(const SyncResponse& syncResponse)
+{
+    // Apply changes on the root
+    SyncTree* root = this;
+    while (root->parent != nullptr) {
+        root = root->parent;
+    }
+
+    for (const auto& chunk : syncResponse.chunks()) {
+        root->change(chunk.x(), chunk.y(), chunk.data());
+    }
+    root->reHash();
+}
+
+void SyncTree::applySnapshot(const RegionSnapshot& snapshot)
+{
+    std::vector<Chunk> chunks;
+    chunks.reserve(snapshot.versions_size());
+    uint64_t code = 0;
+    for (int i = 0; i < snapshot.mortondeltas_size() && i < snapshot.versions_size(); i++) {
+        code += snapshot.mortondeltas(i);
+        const Point offset = Point::fromMorton(code);
+        chunks.emplace_back(Point(area.topleft.x + offset.x, area.topleft.y + offset.y), snapshot.versions(i));
+    }
+    // Already sorted by Morton code, the chunks are loaded in a single pass
+    bulkLoad(chunks);
+}
+
+void SyncTree::collectChunks(std::vector<Chunk*>& chunks) const
+{
+    for (SyncTree* child : childs) {
+        if (child != nullptr) {
+            child->collectChunks(chunks);
+        }
+    }
+    for (Chunk* chunk : data) {
+        if (chunk != nullptr) {
+            chunks.push_back(chunk);
+        }
+    }
+}
+
+SyncResponse SyncTree::prepareBudgetedSyncResponse(size_t hashValue, unsigned lowerLevels, size_t byteBudget)
+{
+    using google::protobuf::io::CodedOutputStream;
+    // Tag, length prefix and the embedded message
+    auto fieldSize = [](size_t messageSize) { return 1 + CodedOutputStream::VarintSize64(messageSize) + messageSize; };
+
+    const bool hashKnown = storedChanges.first == hashValue;
+    SyncResponse syncResponse;
+    syncResponse.set_curhash(getHash());
+    syncResponse.set_chunkdata(true);
+    syncResponse.set_hashknown(hashKnown);
+
+    // If the hash is unknown, all chunks of the subtree have to be sent
+    std::vector<Chunk*> changes;
+    if (hashKnown) {
+        changes = storedChanges.second;
+    } else {
+        collectChunks(changes);
+    }
+    std::vector<quadtree::ChunkData> protoChunks(changes.size());
+    size_t chunkBytes = 0;
+    for (size_t i = 0; i < changes.size(); i++) {
+        protoChunks[i].set_data(changes[i]->data);
+        protoChunks[i].set_x(changes[i]->pos.x);
+        protoChunks[i].set_y(changes[i]->pos.y);
+        chunkBytes += fieldSize(protoChunks[i].ByteSizeLong());
+    }
+
+    if (getLevel() + 1 > getMaxLevel() || lowerLevels <= 1
+        || syncResponse.ByteSizeLong() + chunkBytes <= byteBudget) {
+        for (const auto& chunk : protoChunks) {
+            syncResponse.add_chunks()->CopyFrom(chunk);
+        }
+        return syncResponse;
+    }
+
+    // Hash values of the lower levels, as deep as they fit into the budget
+    syncResponse.set_chunkdata(false);
+    unsigned levels = hashKnown ? lowerLevels : lowerLevels * 2;
+    std::map<unsigned, std::vector<size_t>> hashValues;
+    size_t responseSize;
+    for (;; levels--) {
+        hashValues = hashValuesOfNextNLevels(levels, hashValue).first;
+        SyncResponse hashResponse(syncResponse);
+        hashResponse.set_treelevel(hashValues.rbegin()->first);
+        for (const auto& value : hashValues.rbegin()->second) {
+            hashResponse.add_hashvalues(value);
+        }
+        responseSize = hashResponse.ByteSizeLong();
+        if (responseSize <= byteBudget || levels <= 2) {
+            syncResponse = hashResponse;
+            break;
+        }
+    }
+
+    // Group the changed chunks by the subtree on the response level they belong to
+    std::map<unsigned, std::vector<size_t>> chunksPerSubtree
+        = groupChunksBySubtree(changes, syncResponse.treelevel() - getLevel());
+    std::map<unsigned, size_t> bytesPerSubtree;
+    for (const auto& entry : chunksPerSubtree) {
+        for (size_t i : entry.second) {
+            bytesPerSubtree[entry.first] += fieldSize(protoChunks[i].ByteSizeLong());
+        }
+    }
+
+    // Inline the changes of the subtrees with the fewest changes first, to save as many requests as possible
+    std::vector<unsigned> subtrees;
+    for (const auto& entry : chunksPerSubtree) {
+        subtrees.push_back(entry.first);
+    }
+    std::stable_sort(subtrees.begin(), subtrees.end(),
+        [&bytesPerSubtree](unsigned a, unsigned b) { return bytesPerSubtree[a] < bytesPerSubtree[b]; });
+    for (unsigned subtree : subtrees) {
+        if (responseSize + bytesPerSubtree[subtree] > byteBudget) {
+            break;
+        }
+        for (size_t i : chunksPerSubtree[subtree]) {
+            syncResponse.add_chunks()->CopyFrom(protoChunks[i]);
+        }
+        responseSize += bytesPerSubtree[subtree];
+    }
+    return syncResponse;
+}
+
+std::map<unsigned, std::vector<size_t>> SyncTree::groupChunksBySubtree(
+    const std::vector<Chunk*>& chunks, unsigned depth)
+{
+    std::map<unsigned, std::vector<size_t>> chunksPerSubtree;
+    for (size_t i = 0; i < chunks.size(); i++) {
+        std::vector<unsigned char> path = getChunkPath(chunks[i]->pos.x, chunks[i]->pos.y);
+        // Same order as enumerateLowerLevel(depth)
+        unsigned index = 0;
+        for (unsigned j = 0; j < depth; j++) {
+            index = index * 4 + path[j];
+        }
+        chunksPerSubtree[index].push_back(i);
+    }
+    return chunksPerSubtree;
+}
+
+SyncResponse SyncTree::prepareSyncResponse(
+    size_t hashValue, unsigned lowerLevels, unsigned chunkThreshold, unsigned inlineThreshold)
 {
     SyncRequestResponse response = syncRequest(hashValue, lowerLevels, chunkThreshold);
 
@@ -568,9 +794,323 @@ SyncResponse SyncTree::prepareSyncResponse(size_t hashValue, unsigned lowerLevel
         for (const auto& value : hashValues) {
             syncResponse.add_hashvalues(value);
         }
+
+        // Inline the changes of subtrees with few changes, they do not need to be requested separately
+        if (inlineThreshold > 0 && syncResponse.hashknown()) {
+            const std::vector<Chunk*>& changes = storedChanges.second;
+            unsigned inlined = 0;
+            for (const auto& entry : groupChunksBySubtree(changes, responseLevel - getLevel())) {
+                if (entry.second.size() > inlineThreshold || inlined + entry.second.size() > chunkThreshold) {
+                    continue;
+                }
+                for (size_t i : entry.second) {
+                    quadtree::ChunkData* protoChunk = syncResponse.add_chunks();
+                    protoChunk->set_data(changes[i]->data);
+                    protoChunk->set_x(changes[i]->pos.x);
+                    protoChunk->set_y(changes[i]->pos.y);
+                }
+                inlined += entry.second.size();
+            }
+        }
+    }
+    return syncResponse;
+}
+
+SyncResponse SyncTree::prepareRevisionSyncResponse(
+    const std::pair<bool, std::vector<Chunk*>>& changes, unsigned lowerLevels, unsigned chunkThreshold)
+{
+    SyncRequestResponse response;
+    if (!changes.first) {
+        // The requester's state is unknown, it is answered like a request with an unknown hash value
+        response = unknownStateResponse(lowerLevels, chunkThreshold);
+    } else if (getLevel() + 1 > getMaxLevel() || lowerLevels <= 1 || changes.second.size() <= chunkThreshold) {
+        response.containsChanges = true;
+        response.changeReponse = changes;
+    } else {
+        response.containsChanges = false;
+        const unsigned levels = std::min(lowerLevels, getMaxLevel() + 1 - getLevel());
+        response.nextNLevelsResponse = NextNLevelsResponseType(hashValuesOfNextNLevels(levels), changes.second.size());
+    }
+
+    SyncResponse syncResponse;
+    syncResponse.set_curhash(getHash());
+    syncResponse.set_hashknown(changes.first);
+    syncResponse.set_chunkdata(response.containsChanges);
+
+    if (response.containsChanges) {
+        for (const auto& chunk : response.changeReponse.second) {
+            quadtree::ChunkData* protoChunk = syncResponse.add_chunks();
+            protoChunk->set_data(chunk->data);
+            protoChunk->set_x(chunk->pos.x);
+            protoChunk->set_y(chunk->pos.y);
+        }
+    } else {
+        syncResponse.set_treelevel(response.nextNLevelsResponse.first.rbegin()->first);
+        for (const auto& value : response.nextNLevelsResponse.first.rbegin()->second) {
+            syncResponse.add_hashvalues(value);
+        }
+    }
+    return syncResponse;
+}
+
+SyncResponse SyncTree::prepareSnapshotResponse(unsigned lowerLevels)
+{
+    SyncResponse syncResponse;
+    syncResponse.set_curhash(getHash());
+    syncResponse.set_chunkdata(false);
+    syncResponse.set_hashknown(false);
+
+    const unsigned levels = std::max(1u, std::min(lowerLevels, getMaxLevel() + 1 - getLevel()));
+    std::map<unsigned, std::vector<size_t>> hashValues
+        = hashValuesOfNextNLevels(levels, std::map<unsigned, std::vector<size_t>>());
+    syncResponse.set_treelevel(hashValues.rbegin()->first);
+    for (const auto& value : hashValues.rbegin()->second) {
+        syncResponse.add_hashvalues(value);
+    }
+
+    std::vector<Chunk*> chunks;
+    collectChunks(chunks);
+    std::vector<std::pair<uint64_t, Chunk*>> sortedChunks;
+    sortedChunks.reserve(chunks.size());
+    for (Chunk* chunk : chunks) {
+        const Point offset(chunk->pos.x - area.topleft.x, chunk->pos.y - area.topleft.y);
+        sortedChunks.emplace_back(offset.toMorton(), chunk);
+    }
+    std::sort(sortedChunks.begin(), sortedChunks.end(),
+        [](const std::pair<uint64_t, Chunk*>& a, const std::pair<uint64_t, Chunk*>& b) { return a.first < b.first; });
+
+    // The leading bits of a Morton code are the index of the subtree on treeLevel
+    const unsigned width = area.bottomRight.x - area.topleft.x;
+    const unsigned shift = 2 * ((unsigned)log2(width) - (syncResponse.treelevel() - getLevel()));
+    RegionSnapshot* snapshot = syncResponse.mutable_snapshot();
+    std::vector<unsigned> chunkCounts(syncResponse.hashvalues_size(), 0);
+    uint64_t previous = 0;
+    for (const auto& entry : sortedChunks) {
+        snapshot->add_mortondeltas(entry.first - previous);
+        snapshot->add_versions(entry.second->data);
+        chunkCounts.at(entry.first >> shift)++;
+        previous = entry.first;
+    }
+    for (unsigned count : chunkCounts) {
+        snapshot->add_chunkcounts(count);
+    }
+    return syncResponse;
+}
+
+std::map<unsigned, size_t> SyncTree::getLowerLevelDigests(unsigned depth)
+{
+    std::map<unsigned, size_t> digests;
+    std::vector<SyncTree*> nodes = enumerateLowerLevel(depth);
+    for (unsigned i = 0; i < nodes.size(); i++) {
+        if (nodes[i] != nullptr) {
+            digests[i] = nodes[i]->getHash();
+        }
+    }
+    return digests;
+}
+
+SyncResponse SyncTree::prepareDigestSyncResponse(
+    unsigned depth, const std::map<unsigned, size_t>& digests, unsigned chunkThreshold)
+{
+    SyncResponse syncResponse;
+    syncResponse.set_curhash(getHash());
+    syncResponse.set_chunkdata(true);
+    syncResponse.set_hashknown(true);
+
+    // Collect the changes of all subtrees whose hash differs from the consumer's one
+    std::vector<SyncTree*> nodes = enumerateLowerLevel(depth);
+    std::map<unsigned, std::vector<Chunk*>> changesPerSubtree;
+    size_t numChanges = 0;
+    for (unsigned i = 0; i < nodes.size(); i++) {
+        if (nodes[i] == nullptr) {
+            continue;
+        }
+        auto digest = digests.find(i);
+        const size_t remoteHash = digest != digests.end() ? digest->second : 0;
+        if (remoteHash == nodes[i]->getHash()) {
+            continue;
+        }
+        std::vector<Chunk*>& changes = changesPerSubtree[i];
+        if (nodes[i]->storedChanges.first == remoteHash) {
+            changes = nodes[i]->storedChanges.second;
+        } else {
+            nodes[i]->collectChunks(changes);
+        }
+        numChanges += changes.size();
+    }
+
+    auto addChunks = [&syncResponse](const std::vector<Chunk*>& changes) {
+        for (const auto& chunk : changes) {
+            quadtree::ChunkData* protoChunk = syncResponse.add_chunks();
+            protoChunk->set_data(chunk->data);
+            protoChunk->set_x(chunk->pos.x);
+            protoChunk->set_y(chunk->pos.y);
+        }
+    };
+
+    // The differing subtrees are on the final level, or their changes are few enough
+    if (getLevel() + depth + 1 > getMaxLevel() || numChanges <= chunkThreshold) {
+        for (const auto& entry : changesPerSubtree) {
+            addChunks(entry.second);
+        }
+        return syncResponse;
+    }
+
+    // Hash values one level below the differing subtrees
+    syncResponse.set_chunkdata(false);
+    syncResponse.set_treelevel(getLevel() + depth + 1);
+    for (const auto& node : enumerateLowerLevel(depth + 1)) {
+        syncResponse.add_hashvalues(node != nullptr ? node->getHash() : 0);
+    }
+
+    // Inline the changes of the subtrees with the fewest changes first, to save as many requests as possible
+    std::vector<unsigned> subtrees;
+    for (const auto& entry : changesPerSubtree) {
+        subtrees.push_back(entry.first);
+    }
+    std::stable_sort(subtrees.begin(), subtrees.end(), [&changesPerSubtree](unsigned a, unsigned b) {
+        return changesPerSubtree[a].size() < changesPerSubtree[b].size();
+    });
+    size_t inlined = 0;
+    for (unsigned subtree : subtrees) {
+        if (inlined + changesPerSubtree[subtree].size() > chunkThreshold) {
+            break;
+        }
+        addChunks(changesPerSubtree[subtree]);
+        inlined += changesPerSubtree[subtree].size();
     }
     return syncResponse;
 }
+
+size_t SyncTree::truncateHash(size_t hash, unsigned hashBits)
+{
+    if (hashBits != 16 && hashBits != 32) {
+        return hash;
+    }
+    uint64_t folded = hash;
+    for (unsigned width = 64; width > hashBits; width /= 2) {
+        folded = (folded ^ (folded >> (width / 2))) & ((uint64_t(1) << (width / 2)) - 1);
+    }
+    return folded != 0 ? folded : 1;
+}
+
+void SyncTree::truncateHashValues(SyncResponse& syncResponse, unsigned hashBits)
+{
+    if (hashBits != 16 && hashBits != 32) {
+        return;
+    }
+    for (int i = 0; i < syncResponse.hashvalues_size(); i++) {
+        if (syncResponse.hashvalues(i) != 0) {
+            syncResponse.set_hashvalues(i, truncateHash(syncResponse.hashvalues(i), hashBits));
+        }
+    }
+    syncResponse.set_hashbits(hashBits);
+}
+
+std::vector<SyncResponse> SyncTree::splitSyncResponse(const SyncResponse& syncResponse, size_t maxSegmentSize)
+{
+    if (syncResponse.ByteSizeLong() <= maxSegmentSize) {
+        return std::vector<SyncResponse>({ syncResponse });
+    }
+    if (syncResponse.has_snapshot()) {
+        return splitSnapshotResponse(syncResponse, maxSegmentSize);
+    }
+
+    // All segments share the fields besides the chunks and hash values
+    SyncResponse header(syncResponse);
+    header.clear_chunks();
+    header.clear_hashvalues();
+    // Reserve space for the tag and the largest possible varint of hashOffset
+    const size_t headerSize = header.ByteSizeLong() + 6;
+    using google::protobuf::io::CodedOutputStream;
+
+    std::vector<SyncResponse> segments;
+    SyncResponse segment(header);
+    size_t segmentSize = headerSize;
+    // Chunks come first, in a hash value response they are the inlined changes of lower subtrees
+    for (const auto& chunk : syncResponse.chunks()) {
+        const size_t chunkSize = chunk.ByteSizeLong();
+        // Tag, length prefix and the chunk message itself
+        const size_t fieldSize = 1 + CodedOutputStream::VarintSize64(chunkSize) + chunkSize;
+        if (segmentSize + fieldSize > maxSegmentSize && segment.chunks_size() > 0) {
+            segments.push_back(segment);
+            segment = header;
+            segmentSize = headerSize;
+        }
+        segment.add_chunks()->CopyFrom(chunk);
+        segmentSize += fieldSize;
+    }
+    if (!syncResponse.chunkdata()) {
+        for (int i = 0; i < syncResponse.hashvalues_size(); i++) {
+            const size_t fieldSize = 1 + CodedOutputStream::VarintSize64(syncResponse.hashvalues(i));
+            if (segmentSize + fieldSize > maxSegmentSize
+                && (segment.hashvalues_size() > 0 || segment.chunks_size() > 0)) {
+                segments.push_back(segment);
+                segment = header;
+                segment.set_hashoffset(i);
+                segmentSize = headerSize;
+            }
+            segment.add_hashvalues(syncResponse.hashvalues(i));
+            segmentSize += fieldSize;
+        }
+    }
+    segments.push_back(segment);
+    return segments;
+}
+
+std::vector<SyncResponse> SyncTree::splitSnapshotResponse(const SyncResponse& syncResponse, size_t maxSegmentSize)
+{
+    SyncResponse header(syncResponse);
+    header.clear_hashvalues();
+    header.clear_snapshot();
+    // Reserve space for hashOffset and the tags and length prefixes of the snapshot and its packed fields
+    const size_t headerSize = header.ByteSizeLong() + 6 + 4 * 6;
+    using google::protobuf::io::CodedOutputStream;
+
+    const RegionSnapshot& snapshot = syncResponse.snapshot();
+    std::vector<SyncResponse> segments;
+    SyncResponse segment(header);
+    size_t segmentSize = headerSize;
+    int chunk = 0;
+    // Morton code of the last chunk of the snapshot and of the current segment
+    uint64_t code = 0;
+    uint64_t segmentCode = 0;
+    for (int i = 0; i < syncResponse.hashvalues_size(); i++) {
+        const unsigned count = i < snapshot.chunkcounts_size() ? snapshot.chunkcounts(i) : 0;
+
+        // A subtree is never split. Its first chunk is counted with the full Morton code, the size of the delta if the
+        // subtree starts a new segment.
+        size_t subtreeSize = 1 + CodedOutputStream::VarintSize64(syncResponse.hashvalues(i))
+            + CodedOutputStream::VarintSize32(count);
+        uint64_t subtreeCode = code;
+        for (int j = chunk; j < chunk + (int)count && j < snapshot.mortondeltas_size(); j++) {
+            subtreeCode += snapshot.mortondeltas(j);
+            subtreeSize += CodedOutputStream::VarintSize64(j == chunk ? subtreeCode : snapshot.mortondeltas(j))
+                + CodedOutputStream::VarintSize64(snapshot.versions(j));
+        }
+        if (segmentSize + subtreeSize > maxSegmentSize && segment.hashvalues_size() > 0) {
+            segments.push_back(segment);
+            segment = header;
+            segment.set_hashoffset(i);
+            segmentSize = headerSize;
+            segmentCode = 0;
+        }
+
+        segment.add_hashvalues(syncResponse.hashvalues(i));
+        RegionSnapshot* segmentSnapshot = segment.mutable_snapshot();
+        segmentSnapshot->add_chunkcounts(count);
+        for (unsigned j = 0; j < count && chunk < snapshot.mortondeltas_size(); j++, chunk++) {
+            code += snapshot.mortondeltas(chunk);
+            segmentSnapshot->add_mortondeltas(code - segmentCode);
+            segmentSnapshot->add_versions(snapshot.versions(chunk));
+            segmentCode = code;
+        }
+        segmentSize += subtreeSize;
+    }
+    segments.push_back(segment);
+    return segments;
+}
+
 ndn::Name SyncTree::subtreeToName(bool includeSubtreeHash) const
 {
     ndn::Name subtreeName;
@@ -608,8 +1148,8 @@ SyncTree* SyncTree::getSubtreeFromName(const ndn::Name& subtreeName, const bool&
     std::vector<unsigned> nameComponents;
     for (const ndn::Name::Component& component : subtreeName) {
         const std::string& stringComponent = component.toUri();
-        if (stringComponent == "h") {
-            break; // Stop parsing at the hash value
+        if (stringComponent == "h" || stringComponent == "r") {
+            break; // Stop parsing at the hash value or revision
         }
         if (std::regex_match(stringComponent, treeCoord)) {
             nameComponents.push_back(std::stoi(stringComponent));
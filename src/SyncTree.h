@@ -42,6 +42,8 @@ public:
         , parent(nullptr)
         , numChilds(numchilds)
         , currentHash(0)
+        , revision(0)
+        , remoteRevision(0)
         , storedChanges(0, std::vector<Chunk*>())
     {
         checkDimensions();
@@ -55,6 +57,8 @@ public:
         , parent(parent)
         , numChilds(numchilds)
         , currentHash(0)
+        , revision(0)
+        , remoteRevision(0)
         , storedChanges(0, std::vector<Chunk*>())
     {
         checkDimensions();
@@ -134,6 +138,18 @@ public:
      */
     Chunk* change(unsigned x, unsigned y, unsigned version);
 
+    /**
+     * Sets the versions of the given chunks and builds the inflated subtree and all hash values bottom-up in a single
+     * pass. Other than change(..) and reHash(..), the chunks are not recorded as changes, so requests for changes since
+     * an older hash value are treated like requests with an unknown hash value. The revision is kept, as snapshots are
+     * only imported for remote regions, which are not served by revision. Used to import snapshots.
+     *
+     * Chunks outside of the subtree are ignored. If a position is listed twice, the later version is kept.
+     *
+     * @param chunks Chunks to load, preferably sorted by the Morton code of their position relative to the subtree
+     */
+    void bulkLoad(const std::vector<Chunk>& chunks);
+
     /**
      * Returns the current hash of the sync tree node. The hash includes the following fields:
      *
@@ -155,8 +171,26 @@ public:
      * is set.
      *
      * For descriptions about the hash, see the getHash(..) method.
+     *
+     * @param force Rehash all nodes, even if no chunks changed
+     * @param revision Publish revision which is recorded for the nodes whose hash value changes, see getRevision()
+     */
+    void reHash(bool force = false, unsigned long revision = 0);
+
+    /**
+     * Returns the publish revision of the last rehash which changed the hash value of the sync tree node. Other than
+     * the hash value, the revision orders the states of the subtree: a requester knowing this or a later revision
+     * holds the current state.
+     *
+     * @return The revision of the tree node
      */
-    void reHash(bool force = false);
+    unsigned long getRevision() const { return revision; }
+
+    /**
+     * Returns the revision of the remote subtree this subtree was brought in sync with by the last applied sync
+     * response (see SyncResponse::subtreeRevision), 0 if unknown
+     */
+    unsigned long getRemoteRevision() const { return remoteRevision; }
 
     /**
      * Returns pointers to changed chunks since the given hash
@@ -250,7 +284,9 @@ public:
      * This method applies a sync response packet to the quadtree.
      *
      * When the sync response contains chunk changes, the chunk changes are applied. If the sync response contains
-     * hash values of lower level subtrees, than the hash values are compared.
+     * hash values of lower level subtrees, than the hash values are compared. Chunks inlined into a hash value
+     * response are applied before the hash values are compared. Truncated hash values are compared to the truncated
+     * local ones.
      *
      * When the quadtree is up to date according to the given SyncResponse, true is returned. Otherwise, a list of
      * out of sync subtrees is returned.
@@ -266,9 +302,110 @@ public:
      * @param lowerLevels Number of lower levels for subtree hashes
      * @param chunkThreshold If more than chunkThreshold chunks changed, a response containing lower chunk levels
      * is sent
+     * @param inlineThreshold If greater than 0, a response containing lower level hash values additionally contains
+     * the changes of all lower level subtrees with at most inlineThreshold changes (hybrid response). In total, no more
+     * than chunkThreshold chunks are inlined.
+     * @return SyncResponse for request with given hashValue
+     */
+    SyncResponse prepareSyncResponse(
+        size_t hashValue, unsigned lowerLevels, unsigned chunkThreshold, unsigned inlineThreshold = 0);
+
+    /**
+     * Prepares a SyncResponse for the given hash value which fits into the given number of bytes. Instead of a chunk
+     * threshold, the size of the serialized response decides: If all changed chunks fit, a chunk response is returned.
+     * Otherwise, the response contains the hash values of the lower level and, additionally, the changed chunks of as
+     * many lower level subtrees as fit into the budget, starting with the subtrees with the fewest changes. The
+     * consumer applies the chunks first, so only the remaining subtrees have to be requested.
+     *
+     * The budget is only exceeded if the subtree is on the final level or if even the hash values of the level below
+     * the subtree do not fit.
+     *
+     * @param hashValue Given hash value
+     * @param lowerLevels Number of lower levels for subtree hashes, reduced if the hash values do not fit
+     * @param byteBudget Maximum size of the serialized response
      * @return SyncResponse for request with given hashValue
      */
-    SyncResponse prepareSyncResponse(size_t hashValue, unsigned lowerLevels, unsigned chunkThreshold);
+    SyncResponse prepareBudgetedSyncResponse(size_t hashValue, unsigned lowerLevels, size_t byteBudget);
+
+    /**
+     * Prepares a SyncResponse for a requester which knows an older revision of the subtree. The changes since the
+     * revision are taken from the producer's ChangeJournal, if it does not reach back to the revision, the request is
+     * answered like a request with an unknown hash value, see syncRequest(..).
+     * @param changes Result of ChangeJournal::getChangesSince(..) for the revision known by the requester and the area
+     * of the subtree
+     * @param lowerLevels Number of lower levels for subtree hashes
+     * @param chunkThreshold If more than chunkThreshold chunks changed, a response containing lower level hash values
+     * is sent
+     * @return SyncResponse for request with given revision
+     */
+    SyncResponse prepareRevisionSyncResponse(
+        const std::pair<bool, std::vector<Chunk*>>& changes, unsigned lowerLevels, unsigned chunkThreshold);
+
+    /**
+     * Prepares a snapshot of the subtree for a requester without any state, e.g. a server which joins or recovers.
+     * The response contains the hash values of the lower level and all chunks below them as RegionSnapshot, sorted by
+     * their Morton codes. Applying it brings the requester in sync with a single response instead of descending level
+     * by level.
+     * @param lowerLevels Number of lower levels for subtree hashes
+     * @return SyncResponse containing the snapshot
+     */
+    SyncResponse prepareSnapshotResponse(unsigned lowerLevels);
+
+    /**
+     * Returns the hash values of the inflated subtrees depth levels below the current node, by their index in
+     * enumerateLowerLevel(depth). Subtrees which are not inflated are omitted, their hash value is 0.
+     * @param depth Number of levels below the current node
+     * @return Hash values of the inflated subtrees on that level
+     */
+    std::map<unsigned, size_t> getLowerLevelDigests(unsigned depth);
+
+    /**
+     * Prepares a SyncResponse for a consumer which sent its own hash values of the subtrees depth levels below the
+     * current node (see getLowerLevelDigests(..)). The hash values are compared locally: If the differing subtrees
+     * changed no more than chunkThreshold chunks, a chunk response containing these changes is returned. Otherwise,
+     * the response contains the hash values one level below the differing subtrees and the changes of as many
+     * differing subtrees as the threshold allows, starting with the subtrees with the fewest changes.
+     *
+     * The changes of a subtree are the changes since the consumer's hash value if it is known, otherwise all of its
+     * chunks.
+     *
+     * @param depth Number of levels below the current node the consumer's hash values belong to
+     * @param digests Hash values of the consumer's inflated subtrees on that level
+     * @param chunkThreshold Maximum number of chunks in the response
+     * @return SyncResponse for the consumer
+     */
+    SyncResponse prepareDigestSyncResponse(
+        unsigned depth, const std::map<unsigned, size_t>& digests, unsigned chunkThreshold);
+
+    /**
+     * Truncates a hash value to the given number of bits by folding its halves. Truncated hash values are only used to
+     * detect differences in lower levels, the final state is verified by the full hash value of the subtree. The
+     * result is never 0, which marks subtrees that are not inflated.
+     * @param hash Full hash value
+     * @param hashBits 16 or 32, any other value returns the full hash value
+     * @return The truncated hash value
+     */
+    static size_t truncateHash(size_t hash, unsigned hashBits);
+
+    /**
+     * Replaces the lower level hash values of a SyncResponse by their truncated values and sets hashBits. The hash
+     * value 0 of subtrees which are not inflated is kept.
+     * @param syncResponse The response to modify
+     * @param hashBits 16 or 32, otherwise the response is not modified
+     */
+    static void truncateHashValues(SyncResponse& syncResponse, unsigned hashBits);
+
+    /**
+     * Splits a SyncResponse into self-contained segments, which can be applied independently and in any order. Every
+     * segment contains a subset of the chunks and/or a consecutive range of the hash values (marked by hashOffset) and
+     * all other fields of the original response.
+     * @param syncResponse The response to split
+     * @param maxSegmentSize Maximum size of a serialized segment in bytes. A single chunk or hash value is never split,
+     * so a segment exceeds the size if the fields besides the chunks or hash values do. Snapshots are split at the
+     * subtrees of the hash values, every segment contains the chunks of its subtrees.
+     * @return The segments, containing only the original response if it fits into a single segment
+     */
+    static std::vector<SyncResponse> splitSyncResponse(const SyncResponse& syncResponse, size_t maxSegmentSize);
 
     /**
      * Returns a name representing the path to the current subtree. When includeSubtreeHash is true, then a name
@@ -305,6 +442,61 @@ protected:
 
     Chunk* inflateChunk(unsigned x, unsigned y, bool rememberChanged);
 
+    /**
+     * Returns the child with the given index, it is created if it is not inflated yet
+     */
+    SyncTree* inflateChild(unsigned index);
+
+    /**
+     * Computes the hash value of the node from the current hash values of its childs and its chunks
+     */
+    std::size_t computeHash() const;
+
+    typedef std::vector<std::pair<uint64_t, Chunk>> MortonChunks;
+
+    /**
+     * Loads a range of chunks sorted by Morton code into the subtree and computes the hash values bottom-up, see
+     * bulkLoad(..)
+     */
+    void loadChunks(MortonChunks::const_iterator first, MortonChunks::const_iterator last);
+
+    /**
+     * Updates the hash value after chunks were loaded without recording the changes
+     */
+    void updateLoadedHash();
+
+    /**
+     * Groups chunks by the subtree they belong to, depth levels below the current node
+     * @return Indices of the chunks, by index of the subtree in enumerateLowerLevel(depth)
+     */
+    std::map<unsigned, std::vector<size_t>> groupChunksBySubtree(const std::vector<Chunk*>& chunks, unsigned depth);
+
+    /**
+     * Answers a request whose state is unknown: all chunks of the subtree if there are at most threshold * 4 of them,
+     * otherwise the hash values nextNLevels * 2 levels below
+     */
+    SyncRequestResponse unknownStateResponse(unsigned nextNLevels, unsigned threshold);
+
+    /**
+     * Appends all inflated chunks of the subtree to the given vector
+     */
+    void collectChunks(std::vector<Chunk*>& chunks) const;
+
+    /**
+     * Applies chunk changes of a sync response to the whole tree and rehashes it
+     */
+    void applyChunks(const SyncResponse& syncResponse);
+
+    /**
+     * Loads the chunks of a snapshot of this subtree with bulkLoad(..)
+     */
+    void applySnapshot(const RegionSnapshot& snapshot);
+
+    /**
+     * Splits a snapshot response at the subtrees of its hash values, see splitSyncResponse(..)
+     */
+    static std::vector<SyncResponse> splitSnapshotResponse(const SyncResponse& syncResponse, size_t maxSegmentSize);
+
     std::vector<SyncTree*> getTreeCoverageBasedOnRectangleRecursive(
         const Rectangle requestedArea, unsigned maxLevel, std::vector<SyncTree*> currentNeighbours);
 
@@ -328,6 +520,8 @@ protected:
     unsigned numChilds;
 
     std::size_t currentHash;
+    unsigned long revision;
+    unsigned long remoteRevision;
     std::pair<std::size_t, std::vector<Chunk*>> storedChanges;
     std::vector<Chunk*> changedChunks;
 
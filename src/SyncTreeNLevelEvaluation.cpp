@@ -209,9 +209,12 @@ void simulateQuadTreeSync(
                 chunkRequests++;
                 const std::pair<bool, std::vector<quadtree::Chunk*>>& chunkRequest = syncRequestResponse.changeReponse;
                 chunkRequestSizes.push_back(getChunkRequestResponseSize(chunkRequest));
+                // The cloned tree does not answer requests, so the changes do not need to be recorded
+                std::vector<quadtree::Chunk> chunks;
                 for (const auto& change : chunkRequest.second) {
-                    clonedTree.change(change->pos.x, change->pos.y, change->data);
+                    chunks.push_back(*change);
                 }
+                currentSubTree->bulkLoad(chunks);
             }
         }
         clonedTree.reHash();
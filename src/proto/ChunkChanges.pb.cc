@@ -1,379 +1,318 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: ChunkChanges.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "ChunkChanges.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace quadtreesync {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* ChunkChanges_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ChunkChanges_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Chunk_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Chunk_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_ChunkChanges_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AssignDesc_ChunkChanges_2eproto() {
-  protobuf_AddDesc_ChunkChanges_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "ChunkChanges.proto");
-  GOOGLE_CHECK(file != NULL);
-  ChunkChanges_descriptor_ = file->message_type(0);
-  static const int ChunkChanges_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChunkChanges, hashknown_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChunkChanges, chunks_),
+namespace quadtreesync {
+PROTOBUF_CONSTEXPR ChunkChanges::ChunkChanges(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.chunks_)*/{}
+  , /*decltype(_impl_.hashknown_)*/false} {}
+struct ChunkChangesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChunkChangesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChunkChangesDefaultTypeInternal() {}
+  union {
+    ChunkChanges _instance;
   };
-  ChunkChanges_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      ChunkChanges_descriptor_,
-      ChunkChanges::default_instance_,
-      ChunkChanges_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChunkChanges, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(ChunkChanges),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChunkChanges, _internal_metadata_),
-      -1);
-  Chunk_descriptor_ = file->message_type(1);
-  static const int Chunk_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Chunk, x_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Chunk, y_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Chunk, data_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChunkChangesDefaultTypeInternal _ChunkChanges_default_instance_;
+PROTOBUF_CONSTEXPR Chunk::Chunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/uint64_t{0u}
+  , /*decltype(_impl_.y_)*/uint64_t{0u}
+  , /*decltype(_impl_.data_)*/uint64_t{0u}} {}
+struct ChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChunkDefaultTypeInternal() {}
+  union {
+    Chunk _instance;
   };
-  Chunk_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      Chunk_descriptor_,
-      Chunk::default_instance_,
-      Chunk_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Chunk, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(Chunk),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Chunk, _internal_metadata_),
-      -1);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_ChunkChanges_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      ChunkChanges_descriptor_, &ChunkChanges::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      Chunk_descriptor_, &Chunk::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_ChunkChanges_2eproto() {
-  delete ChunkChanges::default_instance_;
-  delete ChunkChanges_reflection_;
-  delete Chunk::default_instance_;
-  delete Chunk_reflection_;
-}
-
-void protobuf_AddDesc_ChunkChanges_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AddDesc_ChunkChanges_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\022ChunkChanges.proto\022\014quadtreesync\"F\n\014Ch"
-    "unkChanges\022\021\n\thashKnown\030\001 \002(\010\022#\n\006chunks\030"
-    "\002 \003(\0132\023.quadtreesync.Chunk\"+\n\005Chunk\022\t\n\001x"
-    "\030\001 \002(\004\022\t\n\001y\030\002 \002(\004\022\014\n\004data\030\003 \002(\004", 151);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "ChunkChanges.proto", &protobuf_RegisterTypes);
-  ChunkChanges::default_instance_ = new ChunkChanges();
-  Chunk::default_instance_ = new Chunk();
-  ChunkChanges::default_instance_->InitAsDefaultInstance();
-  Chunk::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_ChunkChanges_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_ChunkChanges_2eproto {
-  StaticDescriptorInitializer_ChunkChanges_2eproto() {
-    protobuf_AddDesc_ChunkChanges_2eproto();
-  }
-} static_descriptor_initializer_ChunkChanges_2eproto_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChunkDefaultTypeInternal _Chunk_default_instance_;
+}  // namespace quadtreesync
+static ::_pb::Metadata file_level_metadata_ChunkChanges_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ChunkChanges_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ChunkChanges_2eproto = nullptr;
+
+const uint32_t TableStruct_ChunkChanges_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::ChunkChanges, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::ChunkChanges, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::ChunkChanges, _impl_.hashknown_),
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::ChunkChanges, _impl_.chunks_),
+  0,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::Chunk, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::Chunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::Chunk, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::Chunk, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::Chunk, _impl_.data_),
+  0,
+  1,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::quadtreesync::ChunkChanges)},
+  { 10, 19, -1, sizeof(::quadtreesync::Chunk)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::quadtreesync::_ChunkChanges_default_instance_._instance,
+  &::quadtreesync::_Chunk_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ChunkChanges_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022ChunkChanges.proto\022\014quadtreesync\"F\n\014Ch"
+  "unkChanges\022\021\n\thashKnown\030\001 \002(\010\022#\n\006chunks\030"
+  "\002 \003(\0132\023.quadtreesync.Chunk\"+\n\005Chunk\022\t\n\001x"
+  "\030\001 \002(\004\022\t\n\001y\030\002 \002(\004\022\014\n\004data\030\003 \002(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_ChunkChanges_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ChunkChanges_2eproto = {
+    false, false, 151, descriptor_table_protodef_ChunkChanges_2eproto,
+    "ChunkChanges.proto",
+    &descriptor_table_ChunkChanges_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_ChunkChanges_2eproto::offsets,
+    file_level_metadata_ChunkChanges_2eproto, file_level_enum_descriptors_ChunkChanges_2eproto,
+    file_level_service_descriptors_ChunkChanges_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ChunkChanges_2eproto_getter() {
+  return &descriptor_table_ChunkChanges_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ChunkChanges_2eproto(&descriptor_table_ChunkChanges_2eproto);
+namespace quadtreesync {
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ChunkChanges::kHashKnownFieldNumber;
-const int ChunkChanges::kChunksFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-ChunkChanges::ChunkChanges()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:quadtreesync.ChunkChanges)
-}
+class ChunkChanges::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ChunkChanges>()._impl_._has_bits_);
+  static void set_has_hashknown(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-void ChunkChanges::InitAsDefaultInstance() {
+ChunkChanges::ChunkChanges(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtreesync.ChunkChanges)
 }
-
 ChunkChanges::ChunkChanges(const ChunkChanges& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChunkChanges* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.chunks_){from._impl_.chunks_}
+    , decltype(_impl_.hashknown_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.hashknown_ = from._impl_.hashknown_;
   // @@protoc_insertion_point(copy_constructor:quadtreesync.ChunkChanges)
 }
 
-void ChunkChanges::SharedCtor() {
-  _cached_size_ = 0;
-  hashknown_ = false;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void ChunkChanges::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.chunks_){arena}
+    , decltype(_impl_.hashknown_){false}
+  };
 }
 
 ChunkChanges::~ChunkChanges() {
   // @@protoc_insertion_point(destructor:quadtreesync.ChunkChanges)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ChunkChanges::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void ChunkChanges::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.chunks_.~RepeatedPtrField();
 }
 
 void ChunkChanges::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* ChunkChanges::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ChunkChanges_descriptor_;
-}
-
-const ChunkChanges& ChunkChanges::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_ChunkChanges_2eproto();
-  return *default_instance_;
-}
-
-ChunkChanges* ChunkChanges::default_instance_ = NULL;
-
-ChunkChanges* ChunkChanges::New(::google::protobuf::Arena* arena) const {
-  ChunkChanges* n = new ChunkChanges;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void ChunkChanges::Clear() {
 // @@protoc_insertion_point(message_clear_start:quadtreesync.ChunkChanges)
-  hashknown_ = false;
-  chunks_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool ChunkChanges::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:quadtreesync.ChunkChanges)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.chunks_.Clear();
+  _impl_.hashknown_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChunkChanges::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required bool hashKnown = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &hashknown_)));
-          set_has_hashknown();
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_hashknown(&has_bits);
+          _impl_.hashknown_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_chunks;
-        break;
-      }
-
+        continue;
       // repeated .quadtreesync.Chunk chunks = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_chunks:
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_chunks:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
-                input, add_chunks()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_chunks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_loop_chunks;
-        input->UnsafeDecrementRecursionDepth();
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:quadtreesync.ChunkChanges)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:quadtreesync.ChunkChanges)
-  return false;
-#undef DO_
-}
-
-void ChunkChanges::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:quadtreesync.ChunkChanges)
-  // required bool hashKnown = 1;
-  if (has_hashknown()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->hashknown(), output);
-  }
-
-  // repeated .quadtreesync.Chunk chunks = 2;
-  for (unsigned int i = 0, n = this->chunks_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->chunks(i), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:quadtreesync.ChunkChanges)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* ChunkChanges::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* ChunkChanges::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:quadtreesync.ChunkChanges)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required bool hashKnown = 1;
-  if (has_hashknown()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->hashknown(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_hashknown(), target);
   }
 
   // repeated .quadtreesync.Chunk chunks = 2;
-  for (unsigned int i = 0, n = this->chunks_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, this->chunks(i), false, target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_chunks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_chunks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:quadtreesync.ChunkChanges)
   return target;
 }
 
-int ChunkChanges::ByteSize() const {
+size_t ChunkChanges::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:quadtreesync.ChunkChanges)
-  int total_size = 0;
+  size_t total_size = 0;
 
   // required bool hashKnown = 1;
-  if (has_hashknown()) {
+  if (_internal_has_hashknown()) {
     total_size += 1 + 1;
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .quadtreesync.Chunk chunks = 2;
-  total_size += 1 * this->chunks_size();
-  for (int i = 0; i < this->chunks_size(); i++) {
+  total_size += 1UL * this->_internal_chunks_size();
+  for (const auto& msg : this->_impl_.chunks_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->chunks(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ChunkChanges::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:quadtreesync.ChunkChanges)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const ChunkChanges* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const ChunkChanges>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:quadtreesync.ChunkChanges)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:quadtreesync.ChunkChanges)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChunkChanges::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChunkChanges::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChunkChanges::GetClassData() const { return &_class_data_; }
 
-void ChunkChanges::MergeFrom(const ChunkChanges& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:quadtreesync.ChunkChanges)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  chunks_.MergeFrom(from.chunks_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_hashknown()) {
-      set_hashknown(from.hashknown());
-    }
-  }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
 
-void ChunkChanges::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:quadtreesync.ChunkChanges)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void ChunkChanges::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChunkChanges*>(&to_msg);
+  auto& from = static_cast<const ChunkChanges&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtreesync.ChunkChanges)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.chunks_.MergeFrom(from._impl_.chunks_);
+  if (from._internal_has_hashknown()) {
+    _this->_internal_set_hashknown(from._internal_hashknown());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ChunkChanges::CopyFrom(const ChunkChanges& from) {
@@ -384,419 +323,279 @@ void ChunkChanges::CopyFrom(const ChunkChanges& from) {
 }
 
 bool ChunkChanges::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-
-  if (!::google::protobuf::internal::AllAreInitialized(this->chunks())) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.chunks_))
+    return false;
   return true;
 }
 
-void ChunkChanges::Swap(ChunkChanges* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ChunkChanges::InternalSwap(ChunkChanges* other) {
-  std::swap(hashknown_, other->hashknown_);
-  chunks_.UnsafeArenaSwap(&other->chunks_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.chunks_.InternalSwap(&other->_impl_.chunks_);
+  swap(_impl_.hashknown_, other->_impl_.hashknown_);
 }
 
-::google::protobuf::Metadata ChunkChanges::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ChunkChanges_descriptor_;
-  metadata.reflection = ChunkChanges_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata ChunkChanges::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChunkChanges_2eproto_getter, &descriptor_table_ChunkChanges_2eproto_once,
+      file_level_metadata_ChunkChanges_2eproto[0]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ChunkChanges
-
-// required bool hashKnown = 1;
-bool ChunkChanges::has_hashknown() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-void ChunkChanges::set_has_hashknown() {
-  _has_bits_[0] |= 0x00000001u;
-}
-void ChunkChanges::clear_has_hashknown() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-void ChunkChanges::clear_hashknown() {
-  hashknown_ = false;
-  clear_has_hashknown();
-}
- bool ChunkChanges::hashknown() const {
-  // @@protoc_insertion_point(field_get:quadtreesync.ChunkChanges.hashKnown)
-  return hashknown_;
-}
- void ChunkChanges::set_hashknown(bool value) {
-  set_has_hashknown();
-  hashknown_ = value;
-  // @@protoc_insertion_point(field_set:quadtreesync.ChunkChanges.hashKnown)
-}
-
-// repeated .quadtreesync.Chunk chunks = 2;
-int ChunkChanges::chunks_size() const {
-  return chunks_.size();
-}
-void ChunkChanges::clear_chunks() {
-  chunks_.Clear();
-}
-const ::quadtreesync::Chunk& ChunkChanges::chunks(int index) const {
-  // @@protoc_insertion_point(field_get:quadtreesync.ChunkChanges.chunks)
-  return chunks_.Get(index);
-}
-::quadtreesync::Chunk* ChunkChanges::mutable_chunks(int index) {
-  // @@protoc_insertion_point(field_mutable:quadtreesync.ChunkChanges.chunks)
-  return chunks_.Mutable(index);
-}
-::quadtreesync::Chunk* ChunkChanges::add_chunks() {
-  // @@protoc_insertion_point(field_add:quadtreesync.ChunkChanges.chunks)
-  return chunks_.Add();
-}
-::google::protobuf::RepeatedPtrField< ::quadtreesync::Chunk >*
-ChunkChanges::mutable_chunks() {
-  // @@protoc_insertion_point(field_mutable_list:quadtreesync.ChunkChanges.chunks)
-  return &chunks_;
-}
-const ::google::protobuf::RepeatedPtrField< ::quadtreesync::Chunk >&
-ChunkChanges::chunks() const {
-  // @@protoc_insertion_point(field_list:quadtreesync.ChunkChanges.chunks)
-  return chunks_;
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Chunk::kXFieldNumber;
-const int Chunk::kYFieldNumber;
-const int Chunk::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-Chunk::Chunk()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:quadtreesync.Chunk)
-}
+class Chunk::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Chunk>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
 
-void Chunk::InitAsDefaultInstance() {
+Chunk::Chunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtreesync.Chunk)
 }
-
 Chunk::Chunk(const Chunk& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Chunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.data_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.data_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.data_));
   // @@protoc_insertion_point(copy_constructor:quadtreesync.Chunk)
 }
 
-void Chunk::SharedCtor() {
-  _cached_size_ = 0;
-  x_ = GOOGLE_ULONGLONG(0);
-  y_ = GOOGLE_ULONGLONG(0);
-  data_ = GOOGLE_ULONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void Chunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){uint64_t{0u}}
+    , decltype(_impl_.y_){uint64_t{0u}}
+    , decltype(_impl_.data_){uint64_t{0u}}
+  };
 }
 
 Chunk::~Chunk() {
   // @@protoc_insertion_point(destructor:quadtreesync.Chunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Chunk::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Chunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Chunk::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Chunk::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Chunk_descriptor_;
-}
-
-const Chunk& Chunk::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_ChunkChanges_2eproto();
-  return *default_instance_;
-}
-
-Chunk* Chunk::default_instance_ = NULL;
-
-Chunk* Chunk::New(::google::protobuf::Arena* arena) const {
-  Chunk* n = new Chunk;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void Chunk::Clear() {
 // @@protoc_insertion_point(message_clear_start:quadtreesync.Chunk)
-#if defined(__clang__)
-#define ZR_HELPER_(f) \
-  _Pragma("clang diagnostic push") \
-  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
-  __builtin_offsetof(Chunk, f) \
-  _Pragma("clang diagnostic pop")
-#else
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<Chunk*>(16)->f)
-#endif
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(x_, data_);
-
-#undef ZR_HELPER_
-#undef ZR_
-
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool Chunk::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:quadtreesync.Chunk)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.data_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.data_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Chunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required uint64 x = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &x_)));
-          set_has_x();
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_y;
-        break;
-      }
-
+        continue;
       // required uint64 y = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_y:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &y_)));
-          set_has_y();
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_data;
-        break;
-      }
-
+        continue;
       // required uint64 data = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_data:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &data_)));
-          set_has_data();
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_data(&has_bits);
+          _impl_.data_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:quadtreesync.Chunk)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:quadtreesync.Chunk)
-  return false;
-#undef DO_
-}
-
-void Chunk::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:quadtreesync.Chunk)
-  // required uint64 x = 1;
-  if (has_x()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->x(), output);
-  }
-
-  // required uint64 y = 2;
-  if (has_y()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->y(), output);
-  }
-
-  // required uint64 data = 3;
-  if (has_data()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->data(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:quadtreesync.Chunk)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Chunk::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* Chunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:quadtreesync.Chunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint64 x = 1;
-  if (has_x()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->x(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_x(), target);
   }
 
   // required uint64 y = 2;
-  if (has_y()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->y(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_y(), target);
   }
 
   // required uint64 data = 3;
-  if (has_data()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->data(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_data(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:quadtreesync.Chunk)
   return target;
 }
 
-int Chunk::RequiredFieldsByteSizeFallback() const {
+size_t Chunk::RequiredFieldsByteSizeFallback() const {
 // @@protoc_insertion_point(required_fields_byte_size_fallback_start:quadtreesync.Chunk)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (has_x()) {
+  if (_internal_has_x()) {
     // required uint64 x = 1;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->x());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_x());
   }
 
-  if (has_y()) {
+  if (_internal_has_y()) {
     // required uint64 y = 2;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->y());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_y());
   }
 
-  if (has_data()) {
+  if (_internal_has_data()) {
     // required uint64 data = 3;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->data());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_data());
   }
 
   return total_size;
 }
-int Chunk::ByteSize() const {
+size_t Chunk::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:quadtreesync.Chunk)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
     // required uint64 x = 1;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->x());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_x());
 
     // required uint64 y = 2;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->y());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_y());
 
     // required uint64 data = 3;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->data());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_data());
 
   } else {
     total_size += RequiredFieldsByteSizeFallback();
   }
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void Chunk::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:quadtreesync.Chunk)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const Chunk* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const Chunk>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:quadtreesync.Chunk)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:quadtreesync.Chunk)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Chunk::MergeFrom(const Chunk& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:quadtreesync.Chunk)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_x()) {
-      set_x(from.x());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Chunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Chunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Chunk::GetClassData() const { return &_class_data_; }
+
+
+void Chunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Chunk*>(&to_msg);
+  auto& from = static_cast<const Chunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtreesync.Chunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
     }
-    if (from.has_y()) {
-      set_y(from.y());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
     }
-    if (from.has_data()) {
-      set_data(from.data());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.data_ = from._impl_.data_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
-
-void Chunk::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:quadtreesync.Chunk)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Chunk::CopyFrom(const Chunk& from) {
@@ -807,111 +606,40 @@ void Chunk::CopyFrom(const Chunk& from) {
 }
 
 bool Chunk::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Chunk::Swap(Chunk* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Chunk::InternalSwap(Chunk* other) {
-  std::swap(x_, other->x_);
-  std::swap(y_, other->y_);
-  std::swap(data_, other->data_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Chunk, _impl_.data_)
+      + sizeof(Chunk::_impl_.data_)
+      - PROTOBUF_FIELD_OFFSET(Chunk, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::google::protobuf::Metadata Chunk::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Chunk_descriptor_;
-  metadata.reflection = Chunk_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Chunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ChunkChanges_2eproto_getter, &descriptor_table_ChunkChanges_2eproto_once,
+      file_level_metadata_ChunkChanges_2eproto[1]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// Chunk
-
-// required uint64 x = 1;
-bool Chunk::has_x() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-void Chunk::set_has_x() {
-  _has_bits_[0] |= 0x00000001u;
-}
-void Chunk::clear_has_x() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-void Chunk::clear_x() {
-  x_ = GOOGLE_ULONGLONG(0);
-  clear_has_x();
-}
- ::google::protobuf::uint64 Chunk::x() const {
-  // @@protoc_insertion_point(field_get:quadtreesync.Chunk.x)
-  return x_;
-}
- void Chunk::set_x(::google::protobuf::uint64 value) {
-  set_has_x();
-  x_ = value;
-  // @@protoc_insertion_point(field_set:quadtreesync.Chunk.x)
-}
-
-// required uint64 y = 2;
-bool Chunk::has_y() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-void Chunk::set_has_y() {
-  _has_bits_[0] |= 0x00000002u;
-}
-void Chunk::clear_has_y() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-void Chunk::clear_y() {
-  y_ = GOOGLE_ULONGLONG(0);
-  clear_has_y();
-}
- ::google::protobuf::uint64 Chunk::y() const {
-  // @@protoc_insertion_point(field_get:quadtreesync.Chunk.y)
-  return y_;
-}
- void Chunk::set_y(::google::protobuf::uint64 value) {
-  set_has_y();
-  y_ = value;
-  // @@protoc_insertion_point(field_set:quadtreesync.Chunk.y)
-}
-
-// required uint64 data = 3;
-bool Chunk::has_data() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-void Chunk::set_has_data() {
-  _has_bits_[0] |= 0x00000004u;
-}
-void Chunk::clear_has_data() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-void Chunk::clear_data() {
-  data_ = GOOGLE_ULONGLONG(0);
-  clear_has_data();
-}
- ::google::protobuf::uint64 Chunk::data() const {
-  // @@protoc_insertion_point(field_get:quadtreesync.Chunk.data)
-  return data_;
-}
- void Chunk::set_data(::google::protobuf::uint64 value) {
-  set_has_data();
-  data_ = value;
-  // @@protoc_insertion_point(field_set:quadtreesync.Chunk.data)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace quadtreesync
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::quadtreesync::ChunkChanges*
+Arena::CreateMaybeMessage< ::quadtreesync::ChunkChanges >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtreesync::ChunkChanges >(arena);
+}
+template<> PROTOBUF_NOINLINE ::quadtreesync::Chunk*
+Arena::CreateMaybeMessage< ::quadtreesync::Chunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtreesync::Chunk >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
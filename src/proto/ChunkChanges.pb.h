@@ -1,326 +1,513 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: ChunkChanges.proto
 
-#ifndef PROTOBUF_ChunkChanges_2eproto__INCLUDED
-#define PROTOBUF_ChunkChanges_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ChunkChanges_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ChunkChanges_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ChunkChanges_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ChunkChanges_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ChunkChanges_2eproto;
 namespace quadtreesync {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_ChunkChanges_2eproto();
-void protobuf_AssignDesc_ChunkChanges_2eproto();
-void protobuf_ShutdownFile_ChunkChanges_2eproto();
-
 class Chunk;
+struct ChunkDefaultTypeInternal;
+extern ChunkDefaultTypeInternal _Chunk_default_instance_;
 class ChunkChanges;
+struct ChunkChangesDefaultTypeInternal;
+extern ChunkChangesDefaultTypeInternal _ChunkChanges_default_instance_;
+}  // namespace quadtreesync
+PROTOBUF_NAMESPACE_OPEN
+template<> ::quadtreesync::Chunk* Arena::CreateMaybeMessage<::quadtreesync::Chunk>(Arena*);
+template<> ::quadtreesync::ChunkChanges* Arena::CreateMaybeMessage<::quadtreesync::ChunkChanges>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace quadtreesync {
 
 // ===================================================================
 
-class ChunkChanges : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:quadtreesync.ChunkChanges) */ {
+class ChunkChanges final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtreesync.ChunkChanges) */ {
  public:
-  ChunkChanges();
-  virtual ~ChunkChanges();
+  inline ChunkChanges() : ChunkChanges(nullptr) {}
+  ~ChunkChanges() override;
+  explicit PROTOBUF_CONSTEXPR ChunkChanges(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ChunkChanges(const ChunkChanges& from);
+  ChunkChanges(ChunkChanges&& from) noexcept
+    : ChunkChanges() {
+    *this = ::std::move(from);
+  }
 
   inline ChunkChanges& operator=(const ChunkChanges& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline ChunkChanges& operator=(ChunkChanges&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ChunkChanges& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChunkChanges& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChunkChanges* internal_default_instance() {
+    return reinterpret_cast<const ChunkChanges*>(
+               &_ChunkChanges_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(ChunkChanges* other);
+  friend void swap(ChunkChanges& a, ChunkChanges& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChunkChanges* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChunkChanges* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ChunkChanges* New() const { return New(NULL); }
-
-  ChunkChanges* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  ChunkChanges* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChunkChanges>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ChunkChanges& from);
-  void MergeFrom(const ChunkChanges& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChunkChanges& from) {
+    ChunkChanges::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(ChunkChanges* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtreesync.ChunkChanges";
   }
+  protected:
+  explicit ChunkChanges(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required bool hashKnown = 1;
-  bool has_hashknown() const;
-  void clear_hashknown();
-  static const int kHashKnownFieldNumber = 1;
-  bool hashknown() const;
-  void set_hashknown(bool value);
-
+  enum : int {
+    kChunksFieldNumber = 2,
+    kHashKnownFieldNumber = 1,
+  };
   // repeated .quadtreesync.Chunk chunks = 2;
   int chunks_size() const;
+  private:
+  int _internal_chunks_size() const;
+  public:
   void clear_chunks();
-  static const int kChunksFieldNumber = 2;
-  const ::quadtreesync::Chunk& chunks(int index) const;
   ::quadtreesync::Chunk* mutable_chunks(int index);
-  ::quadtreesync::Chunk* add_chunks();
-  ::google::protobuf::RepeatedPtrField< ::quadtreesync::Chunk >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtreesync::Chunk >*
       mutable_chunks();
-  const ::google::protobuf::RepeatedPtrField< ::quadtreesync::Chunk >&
+  private:
+  const ::quadtreesync::Chunk& _internal_chunks(int index) const;
+  ::quadtreesync::Chunk* _internal_add_chunks();
+  public:
+  const ::quadtreesync::Chunk& chunks(int index) const;
+  ::quadtreesync::Chunk* add_chunks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtreesync::Chunk >&
       chunks() const;
 
+  // required bool hashKnown = 1;
+  bool has_hashknown() const;
+  private:
+  bool _internal_has_hashknown() const;
+  public:
+  void clear_hashknown();
+  bool hashknown() const;
+  void set_hashknown(bool value);
+  private:
+  bool _internal_hashknown() const;
+  void _internal_set_hashknown(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:quadtreesync.ChunkChanges)
  private:
-  inline void set_has_hashknown();
-  inline void clear_has_hashknown();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedPtrField< ::quadtreesync::Chunk > chunks_;
-  bool hashknown_;
-  friend void  protobuf_AddDesc_ChunkChanges_2eproto();
-  friend void protobuf_AssignDesc_ChunkChanges_2eproto();
-  friend void protobuf_ShutdownFile_ChunkChanges_2eproto();
-
-  void InitAsDefaultInstance();
-  static ChunkChanges* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtreesync::Chunk > chunks_;
+    bool hashknown_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChunkChanges_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Chunk : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:quadtreesync.Chunk) */ {
+class Chunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtreesync.Chunk) */ {
  public:
-  Chunk();
-  virtual ~Chunk();
+  inline Chunk() : Chunk(nullptr) {}
+  ~Chunk() override;
+  explicit PROTOBUF_CONSTEXPR Chunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Chunk(const Chunk& from);
+  Chunk(Chunk&& from) noexcept
+    : Chunk() {
+    *this = ::std::move(from);
+  }
 
   inline Chunk& operator=(const Chunk& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline Chunk& operator=(Chunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Chunk& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Chunk& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Chunk* internal_default_instance() {
+    return reinterpret_cast<const Chunk*>(
+               &_Chunk_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(Chunk* other);
+  friend void swap(Chunk& a, Chunk& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Chunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Chunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Chunk* New() const { return New(NULL); }
-
-  Chunk* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Chunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Chunk>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Chunk& from);
-  void MergeFrom(const Chunk& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Chunk& from) {
+    Chunk::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(Chunk* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtreesync.Chunk";
   }
+  protected:
+  explicit Chunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kDataFieldNumber = 3,
+  };
   // required uint64 x = 1;
   bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
   void clear_x();
-  static const int kXFieldNumber = 1;
-  ::google::protobuf::uint64 x() const;
-  void set_x(::google::protobuf::uint64 value);
+  uint64_t x() const;
+  void set_x(uint64_t value);
+  private:
+  uint64_t _internal_x() const;
+  void _internal_set_x(uint64_t value);
+  public:
 
   // required uint64 y = 2;
   bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
   void clear_y();
-  static const int kYFieldNumber = 2;
-  ::google::protobuf::uint64 y() const;
-  void set_y(::google::protobuf::uint64 value);
+  uint64_t y() const;
+  void set_y(uint64_t value);
+  private:
+  uint64_t _internal_y() const;
+  void _internal_set_y(uint64_t value);
+  public:
 
   // required uint64 data = 3;
   bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
   void clear_data();
-  static const int kDataFieldNumber = 3;
-  ::google::protobuf::uint64 data() const;
-  void set_data(::google::protobuf::uint64 value);
+  uint64_t data() const;
+  void set_data(uint64_t value);
+  private:
+  uint64_t _internal_data() const;
+  void _internal_set_data(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:quadtreesync.Chunk)
  private:
-  inline void set_has_x();
-  inline void clear_has_x();
-  inline void set_has_y();
-  inline void clear_has_y();
-  inline void set_has_data();
-  inline void clear_has_data();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint64 x_;
-  ::google::protobuf::uint64 y_;
-  ::google::protobuf::uint64 data_;
-  friend void  protobuf_AddDesc_ChunkChanges_2eproto();
-  friend void protobuf_AssignDesc_ChunkChanges_2eproto();
-  friend void protobuf_ShutdownFile_ChunkChanges_2eproto();
-
-  void InitAsDefaultInstance();
-  static Chunk* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t x_;
+    uint64_t y_;
+    uint64_t data_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ChunkChanges_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // ChunkChanges
 
 // required bool hashKnown = 1;
-inline bool ChunkChanges::has_hashknown() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void ChunkChanges::set_has_hashknown() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool ChunkChanges::_internal_has_hashknown() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void ChunkChanges::clear_has_hashknown() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool ChunkChanges::has_hashknown() const {
+  return _internal_has_hashknown();
 }
 inline void ChunkChanges::clear_hashknown() {
-  hashknown_ = false;
-  clear_has_hashknown();
+  _impl_.hashknown_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool ChunkChanges::_internal_hashknown() const {
+  return _impl_.hashknown_;
 }
 inline bool ChunkChanges::hashknown() const {
   // @@protoc_insertion_point(field_get:quadtreesync.ChunkChanges.hashKnown)
-  return hashknown_;
+  return _internal_hashknown();
+}
+inline void ChunkChanges::_internal_set_hashknown(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.hashknown_ = value;
 }
 inline void ChunkChanges::set_hashknown(bool value) {
-  set_has_hashknown();
-  hashknown_ = value;
+  _internal_set_hashknown(value);
   // @@protoc_insertion_point(field_set:quadtreesync.ChunkChanges.hashKnown)
 }
 
 // repeated .quadtreesync.Chunk chunks = 2;
+inline int ChunkChanges::_internal_chunks_size() const {
+  return _impl_.chunks_.size();
+}
 inline int ChunkChanges::chunks_size() const {
-  return chunks_.size();
+  return _internal_chunks_size();
 }
 inline void ChunkChanges::clear_chunks() {
-  chunks_.Clear();
+  _impl_.chunks_.Clear();
+}
+inline ::quadtreesync::Chunk* ChunkChanges::mutable_chunks(int index) {
+  // @@protoc_insertion_point(field_mutable:quadtreesync.ChunkChanges.chunks)
+  return _impl_.chunks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtreesync::Chunk >*
+ChunkChanges::mutable_chunks() {
+  // @@protoc_insertion_point(field_mutable_list:quadtreesync.ChunkChanges.chunks)
+  return &_impl_.chunks_;
+}
+inline const ::quadtreesync::Chunk& ChunkChanges::_internal_chunks(int index) const {
+  return _impl_.chunks_.Get(index);
 }
 inline const ::quadtreesync::Chunk& ChunkChanges::chunks(int index) const {
   // @@protoc_insertion_point(field_get:quadtreesync.ChunkChanges.chunks)
-  return chunks_.Get(index);
+  return _internal_chunks(index);
 }
-inline ::quadtreesync::Chunk* ChunkChanges::mutable_chunks(int index) {
-  // @@protoc_insertion_point(field_mutable:quadtreesync.ChunkChanges.chunks)
-  return chunks_.Mutable(index);
+inline ::quadtreesync::Chunk* ChunkChanges::_internal_add_chunks() {
+  return _impl_.chunks_.Add();
 }
 inline ::quadtreesync::Chunk* ChunkChanges::add_chunks() {
+  ::quadtreesync::Chunk* _add = _internal_add_chunks();
   // @@protoc_insertion_point(field_add:quadtreesync.ChunkChanges.chunks)
-  return chunks_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::quadtreesync::Chunk >*
-ChunkChanges::mutable_chunks() {
-  // @@protoc_insertion_point(field_mutable_list:quadtreesync.ChunkChanges.chunks)
-  return &chunks_;
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::quadtreesync::Chunk >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtreesync::Chunk >&
 ChunkChanges::chunks() const {
   // @@protoc_insertion_point(field_list:quadtreesync.ChunkChanges.chunks)
-  return chunks_;
+  return _impl_.chunks_;
 }
 
 // -------------------------------------------------------------------
@@ -328,78 +515,92 @@ ChunkChanges::chunks() const {
 // Chunk
 
 // required uint64 x = 1;
-inline bool Chunk::has_x() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Chunk::set_has_x() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Chunk::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Chunk::clear_has_x() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Chunk::has_x() const {
+  return _internal_has_x();
 }
 inline void Chunk::clear_x() {
-  x_ = GOOGLE_ULONGLONG(0);
-  clear_has_x();
+  _impl_.x_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Chunk::_internal_x() const {
+  return _impl_.x_;
 }
-inline ::google::protobuf::uint64 Chunk::x() const {
+inline uint64_t Chunk::x() const {
   // @@protoc_insertion_point(field_get:quadtreesync.Chunk.x)
-  return x_;
+  return _internal_x();
 }
-inline void Chunk::set_x(::google::protobuf::uint64 value) {
-  set_has_x();
-  x_ = value;
+inline void Chunk::_internal_set_x(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
+}
+inline void Chunk::set_x(uint64_t value) {
+  _internal_set_x(value);
   // @@protoc_insertion_point(field_set:quadtreesync.Chunk.x)
 }
 
 // required uint64 y = 2;
-inline bool Chunk::has_y() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool Chunk::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Chunk::set_has_y() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Chunk::clear_has_y() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Chunk::has_y() const {
+  return _internal_has_y();
 }
 inline void Chunk::clear_y() {
-  y_ = GOOGLE_ULONGLONG(0);
-  clear_has_y();
+  _impl_.y_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::uint64 Chunk::y() const {
+inline uint64_t Chunk::_internal_y() const {
+  return _impl_.y_;
+}
+inline uint64_t Chunk::y() const {
   // @@protoc_insertion_point(field_get:quadtreesync.Chunk.y)
-  return y_;
+  return _internal_y();
+}
+inline void Chunk::_internal_set_y(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
 }
-inline void Chunk::set_y(::google::protobuf::uint64 value) {
-  set_has_y();
-  y_ = value;
+inline void Chunk::set_y(uint64_t value) {
+  _internal_set_y(value);
   // @@protoc_insertion_point(field_set:quadtreesync.Chunk.y)
 }
 
 // required uint64 data = 3;
-inline bool Chunk::has_data() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void Chunk::set_has_data() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool Chunk::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Chunk::clear_has_data() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool Chunk::has_data() const {
+  return _internal_has_data();
 }
 inline void Chunk::clear_data() {
-  data_ = GOOGLE_ULONGLONG(0);
-  clear_has_data();
+  _impl_.data_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Chunk::_internal_data() const {
+  return _impl_.data_;
 }
-inline ::google::protobuf::uint64 Chunk::data() const {
+inline uint64_t Chunk::data() const {
   // @@protoc_insertion_point(field_get:quadtreesync.Chunk.data)
-  return data_;
+  return _internal_data();
+}
+inline void Chunk::_internal_set_data(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.data_ = value;
 }
-inline void Chunk::set_data(::google::protobuf::uint64 value) {
-  set_has_data();
-  data_ = value;
+inline void Chunk::set_data(uint64_t value) {
+  _internal_set_data(value);
   // @@protoc_insertion_point(field_set:quadtreesync.Chunk.data)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 
@@ -409,4 +610,5 @@ inline void Chunk::set_data(::google::protobuf::uint64 value) {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_ChunkChanges_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ChunkChanges_2eproto
@@ -1,468 +1,386 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: LowerLevelHashes.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "LowerLevelHashes.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace quadtreesync {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* LowerLevelHashes_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  LowerLevelHashes_reflection_ = NULL;
-const ::google::protobuf::Descriptor* HashValueList_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  HashValueList_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_LowerLevelHashes_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AssignDesc_LowerLevelHashes_2eproto() {
-  protobuf_AddDesc_LowerLevelHashes_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "LowerLevelHashes.proto");
-  GOOGLE_CHECK(file != NULL);
-  LowerLevelHashes_descriptor_ = file->message_type(0);
-  static const int LowerLevelHashes_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LowerLevelHashes, numchanges_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LowerLevelHashes, treelevel_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LowerLevelHashes, hashvalues_),
+namespace quadtreesync {
+PROTOBUF_CONSTEXPR LowerLevelHashes::LowerLevelHashes(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.hashvalues_)*/nullptr
+  , /*decltype(_impl_.numchanges_)*/uint64_t{0u}
+  , /*decltype(_impl_.treelevel_)*/uint64_t{0u}} {}
+struct LowerLevelHashesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LowerLevelHashesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LowerLevelHashesDefaultTypeInternal() {}
+  union {
+    LowerLevelHashes _instance;
   };
-  LowerLevelHashes_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      LowerLevelHashes_descriptor_,
-      LowerLevelHashes::default_instance_,
-      LowerLevelHashes_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LowerLevelHashes, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(LowerLevelHashes),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LowerLevelHashes, _internal_metadata_),
-      -1);
-  HashValueList_descriptor_ = file->message_type(1);
-  static const int HashValueList_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HashValueList, hashvalues_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LowerLevelHashesDefaultTypeInternal _LowerLevelHashes_default_instance_;
+PROTOBUF_CONSTEXPR HashValueList::HashValueList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hashvalues_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HashValueListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HashValueListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HashValueListDefaultTypeInternal() {}
+  union {
+    HashValueList _instance;
   };
-  HashValueList_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      HashValueList_descriptor_,
-      HashValueList::default_instance_,
-      HashValueList_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HashValueList, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(HashValueList),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(HashValueList, _internal_metadata_),
-      -1);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_LowerLevelHashes_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      LowerLevelHashes_descriptor_, &LowerLevelHashes::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      HashValueList_descriptor_, &HashValueList::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_LowerLevelHashes_2eproto() {
-  delete LowerLevelHashes::default_instance_;
-  delete LowerLevelHashes_reflection_;
-  delete HashValueList::default_instance_;
-  delete HashValueList_reflection_;
-}
-
-void protobuf_AddDesc_LowerLevelHashes_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AddDesc_LowerLevelHashes_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\026LowerLevelHashes.proto\022\014quadtreesync\"j"
-    "\n\020LowerLevelHashes\022\022\n\nnumChanges\030\001 \002(\004\022\021"
-    "\n\ttreeLevel\030\002 \002(\004\022/\n\nhashValues\030\003 \002(\0132\033."
-    "quadtreesync.HashValueList\"#\n\rHashValueL"
-    "ist\022\022\n\nhashValues\030\003 \003(\004", 183);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "LowerLevelHashes.proto", &protobuf_RegisterTypes);
-  LowerLevelHashes::default_instance_ = new LowerLevelHashes();
-  HashValueList::default_instance_ = new HashValueList();
-  LowerLevelHashes::default_instance_->InitAsDefaultInstance();
-  HashValueList::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_LowerLevelHashes_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_LowerLevelHashes_2eproto {
-  StaticDescriptorInitializer_LowerLevelHashes_2eproto() {
-    protobuf_AddDesc_LowerLevelHashes_2eproto();
-  }
-} static_descriptor_initializer_LowerLevelHashes_2eproto_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HashValueListDefaultTypeInternal _HashValueList_default_instance_;
+}  // namespace quadtreesync
+static ::_pb::Metadata file_level_metadata_LowerLevelHashes_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_LowerLevelHashes_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_LowerLevelHashes_2eproto = nullptr;
+
+const uint32_t TableStruct_LowerLevelHashes_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::LowerLevelHashes, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::LowerLevelHashes, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::LowerLevelHashes, _impl_.numchanges_),
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::LowerLevelHashes, _impl_.treelevel_),
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::LowerLevelHashes, _impl_.hashvalues_),
+  1,
+  2,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::HashValueList, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtreesync::HashValueList, _impl_.hashvalues_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::quadtreesync::LowerLevelHashes)},
+  { 12, -1, -1, sizeof(::quadtreesync::HashValueList)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::quadtreesync::_LowerLevelHashes_default_instance_._instance,
+  &::quadtreesync::_HashValueList_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_LowerLevelHashes_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026LowerLevelHashes.proto\022\014quadtreesync\"j"
+  "\n\020LowerLevelHashes\022\022\n\nnumChanges\030\001 \002(\004\022\021"
+  "\n\ttreeLevel\030\002 \002(\004\022/\n\nhashValues\030\003 \002(\0132\033."
+  "quadtreesync.HashValueList\"#\n\rHashValueL"
+  "ist\022\022\n\nhashValues\030\003 \003(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_LowerLevelHashes_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_LowerLevelHashes_2eproto = {
+    false, false, 183, descriptor_table_protodef_LowerLevelHashes_2eproto,
+    "LowerLevelHashes.proto",
+    &descriptor_table_LowerLevelHashes_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_LowerLevelHashes_2eproto::offsets,
+    file_level_metadata_LowerLevelHashes_2eproto, file_level_enum_descriptors_LowerLevelHashes_2eproto,
+    file_level_service_descriptors_LowerLevelHashes_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_LowerLevelHashes_2eproto_getter() {
+  return &descriptor_table_LowerLevelHashes_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_LowerLevelHashes_2eproto(&descriptor_table_LowerLevelHashes_2eproto);
+namespace quadtreesync {
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int LowerLevelHashes::kNumChangesFieldNumber;
-const int LowerLevelHashes::kTreeLevelFieldNumber;
-const int LowerLevelHashes::kHashValuesFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class LowerLevelHashes::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LowerLevelHashes>()._impl_._has_bits_);
+  static void set_has_numchanges(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_treelevel(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::quadtreesync::HashValueList& hashvalues(const LowerLevelHashes* msg);
+  static void set_has_hashvalues(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
 
-LowerLevelHashes::LowerLevelHashes()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:quadtreesync.LowerLevelHashes)
+const ::quadtreesync::HashValueList&
+LowerLevelHashes::_Internal::hashvalues(const LowerLevelHashes* msg) {
+  return *msg->_impl_.hashvalues_;
 }
-
-void LowerLevelHashes::InitAsDefaultInstance() {
-  hashvalues_ = const_cast< ::quadtreesync::HashValueList*>(&::quadtreesync::HashValueList::default_instance());
+LowerLevelHashes::LowerLevelHashes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtreesync.LowerLevelHashes)
 }
-
 LowerLevelHashes::LowerLevelHashes(const LowerLevelHashes& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LowerLevelHashes* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hashvalues_){nullptr}
+    , decltype(_impl_.numchanges_){}
+    , decltype(_impl_.treelevel_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_hashvalues()) {
+    _this->_impl_.hashvalues_ = new ::quadtreesync::HashValueList(*from._impl_.hashvalues_);
+  }
+  ::memcpy(&_impl_.numchanges_, &from._impl_.numchanges_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.treelevel_) -
+    reinterpret_cast<char*>(&_impl_.numchanges_)) + sizeof(_impl_.treelevel_));
   // @@protoc_insertion_point(copy_constructor:quadtreesync.LowerLevelHashes)
 }
 
-void LowerLevelHashes::SharedCtor() {
-  _cached_size_ = 0;
-  numchanges_ = GOOGLE_ULONGLONG(0);
-  treelevel_ = GOOGLE_ULONGLONG(0);
-  hashvalues_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void LowerLevelHashes::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hashvalues_){nullptr}
+    , decltype(_impl_.numchanges_){uint64_t{0u}}
+    , decltype(_impl_.treelevel_){uint64_t{0u}}
+  };
 }
 
 LowerLevelHashes::~LowerLevelHashes() {
   // @@protoc_insertion_point(destructor:quadtreesync.LowerLevelHashes)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void LowerLevelHashes::SharedDtor() {
-  if (this != default_instance_) {
-    delete hashvalues_;
-  }
+inline void LowerLevelHashes::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.hashvalues_;
 }
 
 void LowerLevelHashes::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* LowerLevelHashes::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return LowerLevelHashes_descriptor_;
-}
-
-const LowerLevelHashes& LowerLevelHashes::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_LowerLevelHashes_2eproto();
-  return *default_instance_;
-}
-
-LowerLevelHashes* LowerLevelHashes::default_instance_ = NULL;
-
-LowerLevelHashes* LowerLevelHashes::New(::google::protobuf::Arena* arena) const {
-  LowerLevelHashes* n = new LowerLevelHashes;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void LowerLevelHashes::Clear() {
 // @@protoc_insertion_point(message_clear_start:quadtreesync.LowerLevelHashes)
-#if defined(__clang__)
-#define ZR_HELPER_(f) \
-  _Pragma("clang diagnostic push") \
-  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
-  __builtin_offsetof(LowerLevelHashes, f) \
-  _Pragma("clang diagnostic pop")
-#else
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<LowerLevelHashes*>(16)->f)
-#endif
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  if (_has_bits_[0 / 32] & 7u) {
-    ZR_(numchanges_, treelevel_);
-    if (has_hashvalues()) {
-      if (hashvalues_ != NULL) hashvalues_->::quadtreesync::HashValueList::Clear();
-    }
-  }
-
-#undef ZR_HELPER_
-#undef ZR_
-
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool LowerLevelHashes::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:quadtreesync.LowerLevelHashes)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.hashvalues_ != nullptr);
+    _impl_.hashvalues_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.numchanges_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.treelevel_) -
+        reinterpret_cast<char*>(&_impl_.numchanges_)) + sizeof(_impl_.treelevel_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LowerLevelHashes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required uint64 numChanges = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &numchanges_)));
-          set_has_numchanges();
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_numchanges(&has_bits);
+          _impl_.numchanges_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_treeLevel;
-        break;
-      }
-
+        continue;
       // required uint64 treeLevel = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_treeLevel:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &treelevel_)));
-          set_has_treelevel();
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_treelevel(&has_bits);
+          _impl_.treelevel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(26)) goto parse_hashValues;
-        break;
-      }
-
+        continue;
       // required .quadtreesync.HashValueList hashValues = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_hashValues:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_hashvalues()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hashvalues(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:quadtreesync.LowerLevelHashes)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:quadtreesync.LowerLevelHashes)
-  return false;
-#undef DO_
-}
-
-void LowerLevelHashes::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:quadtreesync.LowerLevelHashes)
-  // required uint64 numChanges = 1;
-  if (has_numchanges()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->numchanges(), output);
-  }
-
-  // required uint64 treeLevel = 2;
-  if (has_treelevel()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->treelevel(), output);
-  }
-
-  // required .quadtreesync.HashValueList hashValues = 3;
-  if (has_hashvalues()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *this->hashvalues_, output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:quadtreesync.LowerLevelHashes)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* LowerLevelHashes::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* LowerLevelHashes::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:quadtreesync.LowerLevelHashes)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint64 numChanges = 1;
-  if (has_numchanges()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->numchanges(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_numchanges(), target);
   }
 
   // required uint64 treeLevel = 2;
-  if (has_treelevel()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->treelevel(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_treelevel(), target);
   }
 
   // required .quadtreesync.HashValueList hashValues = 3;
-  if (has_hashvalues()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        3, *this->hashvalues_, false, target);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::hashvalues(this),
+        _Internal::hashvalues(this).GetCachedSize(), target, stream);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:quadtreesync.LowerLevelHashes)
   return target;
 }
 
-int LowerLevelHashes::RequiredFieldsByteSizeFallback() const {
+size_t LowerLevelHashes::RequiredFieldsByteSizeFallback() const {
 // @@protoc_insertion_point(required_fields_byte_size_fallback_start:quadtreesync.LowerLevelHashes)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (has_numchanges()) {
-    // required uint64 numChanges = 1;
+  if (_internal_has_hashvalues()) {
+    // required .quadtreesync.HashValueList hashValues = 3;
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->numchanges());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.hashvalues_);
   }
 
-  if (has_treelevel()) {
-    // required uint64 treeLevel = 2;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->treelevel());
+  if (_internal_has_numchanges()) {
+    // required uint64 numChanges = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_numchanges());
   }
 
-  if (has_hashvalues()) {
-    // required .quadtreesync.HashValueList hashValues = 3;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->hashvalues_);
+  if (_internal_has_treelevel()) {
+    // required uint64 treeLevel = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_treelevel());
   }
 
   return total_size;
 }
-int LowerLevelHashes::ByteSize() const {
+size_t LowerLevelHashes::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:quadtreesync.LowerLevelHashes)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
-    // required uint64 numChanges = 1;
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required .quadtreesync.HashValueList hashValues = 3;
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->numchanges());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.hashvalues_);
 
-    // required uint64 treeLevel = 2;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->treelevel());
+    // required uint64 numChanges = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_numchanges());
 
-    // required .quadtreesync.HashValueList hashValues = 3;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->hashvalues_);
+    // required uint64 treeLevel = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_treelevel());
 
   } else {
     total_size += RequiredFieldsByteSizeFallback();
   }
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void LowerLevelHashes::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:quadtreesync.LowerLevelHashes)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const LowerLevelHashes* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const LowerLevelHashes>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:quadtreesync.LowerLevelHashes)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:quadtreesync.LowerLevelHashes)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LowerLevelHashes::MergeFrom(const LowerLevelHashes& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:quadtreesync.LowerLevelHashes)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_numchanges()) {
-      set_numchanges(from.numchanges());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LowerLevelHashes::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LowerLevelHashes::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LowerLevelHashes::GetClassData() const { return &_class_data_; }
+
+
+void LowerLevelHashes::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LowerLevelHashes*>(&to_msg);
+  auto& from = static_cast<const LowerLevelHashes&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtreesync.LowerLevelHashes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_hashvalues()->::quadtreesync::HashValueList::MergeFrom(
+          from._internal_hashvalues());
     }
-    if (from.has_treelevel()) {
-      set_treelevel(from.treelevel());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.numchanges_ = from._impl_.numchanges_;
     }
-    if (from.has_hashvalues()) {
-      mutable_hashvalues()->::quadtreesync::HashValueList::MergeFrom(from.hashvalues());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.treelevel_ = from._impl_.treelevel_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
-
-void LowerLevelHashes::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:quadtreesync.LowerLevelHashes)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void LowerLevelHashes::CopyFrom(const LowerLevelHashes& from) {
@@ -473,343 +391,191 @@ void LowerLevelHashes::CopyFrom(const LowerLevelHashes& from) {
 }
 
 bool LowerLevelHashes::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void LowerLevelHashes::Swap(LowerLevelHashes* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void LowerLevelHashes::InternalSwap(LowerLevelHashes* other) {
-  std::swap(numchanges_, other->numchanges_);
-  std::swap(treelevel_, other->treelevel_);
-  std::swap(hashvalues_, other->hashvalues_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LowerLevelHashes, _impl_.treelevel_)
+      + sizeof(LowerLevelHashes::_impl_.treelevel_)
+      - PROTOBUF_FIELD_OFFSET(LowerLevelHashes, _impl_.hashvalues_)>(
+          reinterpret_cast<char*>(&_impl_.hashvalues_),
+          reinterpret_cast<char*>(&other->_impl_.hashvalues_));
 }
 
-::google::protobuf::Metadata LowerLevelHashes::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = LowerLevelHashes_descriptor_;
-  metadata.reflection = LowerLevelHashes_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata LowerLevelHashes::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_LowerLevelHashes_2eproto_getter, &descriptor_table_LowerLevelHashes_2eproto_once,
+      file_level_metadata_LowerLevelHashes_2eproto[0]);
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// LowerLevelHashes
-
-// required uint64 numChanges = 1;
-bool LowerLevelHashes::has_numchanges() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-void LowerLevelHashes::set_has_numchanges() {
-  _has_bits_[0] |= 0x00000001u;
-}
-void LowerLevelHashes::clear_has_numchanges() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-void LowerLevelHashes::clear_numchanges() {
-  numchanges_ = GOOGLE_ULONGLONG(0);
-  clear_has_numchanges();
-}
- ::google::protobuf::uint64 LowerLevelHashes::numchanges() const {
-  // @@protoc_insertion_point(field_get:quadtreesync.LowerLevelHashes.numChanges)
-  return numchanges_;
-}
- void LowerLevelHashes::set_numchanges(::google::protobuf::uint64 value) {
-  set_has_numchanges();
-  numchanges_ = value;
-  // @@protoc_insertion_point(field_set:quadtreesync.LowerLevelHashes.numChanges)
-}
-
-// required uint64 treeLevel = 2;
-bool LowerLevelHashes::has_treelevel() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-void LowerLevelHashes::set_has_treelevel() {
-  _has_bits_[0] |= 0x00000002u;
-}
-void LowerLevelHashes::clear_has_treelevel() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-void LowerLevelHashes::clear_treelevel() {
-  treelevel_ = GOOGLE_ULONGLONG(0);
-  clear_has_treelevel();
-}
- ::google::protobuf::uint64 LowerLevelHashes::treelevel() const {
-  // @@protoc_insertion_point(field_get:quadtreesync.LowerLevelHashes.treeLevel)
-  return treelevel_;
-}
- void LowerLevelHashes::set_treelevel(::google::protobuf::uint64 value) {
-  set_has_treelevel();
-  treelevel_ = value;
-  // @@protoc_insertion_point(field_set:quadtreesync.LowerLevelHashes.treeLevel)
-}
-
-// required .quadtreesync.HashValueList hashValues = 3;
-bool LowerLevelHashes::has_hashvalues() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-void LowerLevelHashes::set_has_hashvalues() {
-  _has_bits_[0] |= 0x00000004u;
-}
-void LowerLevelHashes::clear_has_hashvalues() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-void LowerLevelHashes::clear_hashvalues() {
-  if (hashvalues_ != NULL) hashvalues_->::quadtreesync::HashValueList::Clear();
-  clear_has_hashvalues();
-}
-const ::quadtreesync::HashValueList& LowerLevelHashes::hashvalues() const {
-  // @@protoc_insertion_point(field_get:quadtreesync.LowerLevelHashes.hashValues)
-  return hashvalues_ != NULL ? *hashvalues_ : *default_instance_->hashvalues_;
-}
-::quadtreesync::HashValueList* LowerLevelHashes::mutable_hashvalues() {
-  set_has_hashvalues();
-  if (hashvalues_ == NULL) {
-    hashvalues_ = new ::quadtreesync::HashValueList;
-  }
-  // @@protoc_insertion_point(field_mutable:quadtreesync.LowerLevelHashes.hashValues)
-  return hashvalues_;
-}
-::quadtreesync::HashValueList* LowerLevelHashes::release_hashvalues() {
-  // @@protoc_insertion_point(field_release:quadtreesync.LowerLevelHashes.hashValues)
-  clear_has_hashvalues();
-  ::quadtreesync::HashValueList* temp = hashvalues_;
-  hashvalues_ = NULL;
-  return temp;
-}
-void LowerLevelHashes::set_allocated_hashvalues(::quadtreesync::HashValueList* hashvalues) {
-  delete hashvalues_;
-  hashvalues_ = hashvalues;
-  if (hashvalues) {
-    set_has_hashvalues();
-  } else {
-    clear_has_hashvalues();
-  }
-  // @@protoc_insertion_point(field_set_allocated:quadtreesync.LowerLevelHashes.hashValues)
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int HashValueList::kHashValuesFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-HashValueList::HashValueList()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:quadtreesync.HashValueList)
-}
+class HashValueList::_Internal {
+ public:
+};
 
-void HashValueList::InitAsDefaultInstance() {
+HashValueList::HashValueList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtreesync.HashValueList)
 }
-
 HashValueList::HashValueList(const HashValueList& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HashValueList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hashvalues_){from._impl_.hashvalues_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:quadtreesync.HashValueList)
 }
 
-void HashValueList::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void HashValueList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hashvalues_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 HashValueList::~HashValueList() {
   // @@protoc_insertion_point(destructor:quadtreesync.HashValueList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void HashValueList::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void HashValueList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hashvalues_.~RepeatedField();
 }
 
 void HashValueList::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* HashValueList::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return HashValueList_descriptor_;
-}
-
-const HashValueList& HashValueList::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_LowerLevelHashes_2eproto();
-  return *default_instance_;
-}
-
-HashValueList* HashValueList::default_instance_ = NULL;
-
-HashValueList* HashValueList::New(::google::protobuf::Arena* arena) const {
-  HashValueList* n = new HashValueList;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  _impl_._cached_size_.Set(size);
 }
 
 void HashValueList::Clear() {
 // @@protoc_insertion_point(message_clear_start:quadtreesync.HashValueList)
-  hashvalues_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.hashvalues_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool HashValueList::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:quadtreesync.HashValueList)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* HashValueList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated uint64 hashValues = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_hashValues:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 1, 24, input, this->mutable_hashvalues())));
-        } else if (tag == 26) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, this->mutable_hashvalues())));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_hashvalues(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_hashvalues(), ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_hashValues;
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:quadtreesync.HashValueList)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:quadtreesync.HashValueList)
-  return false;
-#undef DO_
-}
-
-void HashValueList::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:quadtreesync.HashValueList)
-  // repeated uint64 hashValues = 3;
-  for (int i = 0; i < this->hashvalues_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(
-      3, this->hashvalues(i), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:quadtreesync.HashValueList)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* HashValueList::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* HashValueList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:quadtreesync.HashValueList)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
   // repeated uint64 hashValues = 3;
-  for (int i = 0; i < this->hashvalues_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt64ToArray(3, this->hashvalues(i), target);
+  for (int i = 0, n = this->_internal_hashvalues_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_hashvalues(i), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:quadtreesync.HashValueList)
   return target;
 }
 
-int HashValueList::ByteSize() const {
+size_t HashValueList::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:quadtreesync.HashValueList)
-  int total_size = 0;
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated uint64 hashValues = 3;
   {
-    int data_size = 0;
-    for (int i = 0; i < this->hashvalues_size(); i++) {
-      data_size += ::google::protobuf::internal::WireFormatLite::
-        UInt64Size(this->hashvalues(i));
-    }
-    total_size += 1 * this->hashvalues_size() + data_size;
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.hashvalues_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_hashvalues_size());
+    total_size += data_size;
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void HashValueList::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:quadtreesync.HashValueList)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const HashValueList* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const HashValueList>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:quadtreesync.HashValueList)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:quadtreesync.HashValueList)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HashValueList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HashValueList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HashValueList::GetClassData() const { return &_class_data_; }
 
-void HashValueList::MergeFrom(const HashValueList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:quadtreesync.HashValueList)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  hashvalues_.MergeFrom(from.hashvalues_);
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
 
-void HashValueList::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:quadtreesync.HashValueList)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void HashValueList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HashValueList*>(&to_msg);
+  auto& from = static_cast<const HashValueList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtreesync.HashValueList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.hashvalues_.MergeFrom(from._impl_.hashvalues_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void HashValueList::CopyFrom(const HashValueList& from) {
@@ -820,66 +586,33 @@ void HashValueList::CopyFrom(const HashValueList& from) {
 }
 
 bool HashValueList::IsInitialized() const {
-
   return true;
 }
 
-void HashValueList::Swap(HashValueList* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void HashValueList::InternalSwap(HashValueList* other) {
-  hashvalues_.UnsafeArenaSwap(&other->hashvalues_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.hashvalues_.InternalSwap(&other->_impl_.hashvalues_);
 }
 
-::google::protobuf::Metadata HashValueList::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = HashValueList_descriptor_;
-  metadata.reflection = HashValueList_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// HashValueList
-
-// repeated uint64 hashValues = 3;
-int HashValueList::hashvalues_size() const {
-  return hashvalues_.size();
+::PROTOBUF_NAMESPACE_ID::Metadata HashValueList::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_LowerLevelHashes_2eproto_getter, &descriptor_table_LowerLevelHashes_2eproto_once,
+      file_level_metadata_LowerLevelHashes_2eproto[1]);
 }
-void HashValueList::clear_hashvalues() {
-  hashvalues_.Clear();
-}
- ::google::protobuf::uint64 HashValueList::hashvalues(int index) const {
-  // @@protoc_insertion_point(field_get:quadtreesync.HashValueList.hashValues)
-  return hashvalues_.Get(index);
-}
- void HashValueList::set_hashvalues(int index, ::google::protobuf::uint64 value) {
-  hashvalues_.Set(index, value);
-  // @@protoc_insertion_point(field_set:quadtreesync.HashValueList.hashValues)
-}
- void HashValueList::add_hashvalues(::google::protobuf::uint64 value) {
-  hashvalues_.Add(value);
-  // @@protoc_insertion_point(field_add:quadtreesync.HashValueList.hashValues)
-}
- const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
-HashValueList::hashvalues() const {
-  // @@protoc_insertion_point(field_list:quadtreesync.HashValueList.hashValues)
-  return hashvalues_;
-}
- ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
-HashValueList::mutable_hashvalues() {
-  // @@protoc_insertion_point(field_mutable_list:quadtreesync.HashValueList.hashValues)
-  return &hashvalues_;
-}
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace quadtreesync
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::quadtreesync::LowerLevelHashes*
+Arena::CreateMaybeMessage< ::quadtreesync::LowerLevelHashes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtreesync::LowerLevelHashes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::quadtreesync::HashValueList*
+Arena::CreateMaybeMessage< ::quadtreesync::HashValueList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtreesync::HashValueList >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
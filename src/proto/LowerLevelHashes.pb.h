@@ -1,355 +1,583 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: LowerLevelHashes.proto
 
-#ifndef PROTOBUF_LowerLevelHashes_2eproto__INCLUDED
-#define PROTOBUF_LowerLevelHashes_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_LowerLevelHashes_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_LowerLevelHashes_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_LowerLevelHashes_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_LowerLevelHashes_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_LowerLevelHashes_2eproto;
 namespace quadtreesync {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_LowerLevelHashes_2eproto();
-void protobuf_AssignDesc_LowerLevelHashes_2eproto();
-void protobuf_ShutdownFile_LowerLevelHashes_2eproto();
-
 class HashValueList;
+struct HashValueListDefaultTypeInternal;
+extern HashValueListDefaultTypeInternal _HashValueList_default_instance_;
 class LowerLevelHashes;
+struct LowerLevelHashesDefaultTypeInternal;
+extern LowerLevelHashesDefaultTypeInternal _LowerLevelHashes_default_instance_;
+}  // namespace quadtreesync
+PROTOBUF_NAMESPACE_OPEN
+template<> ::quadtreesync::HashValueList* Arena::CreateMaybeMessage<::quadtreesync::HashValueList>(Arena*);
+template<> ::quadtreesync::LowerLevelHashes* Arena::CreateMaybeMessage<::quadtreesync::LowerLevelHashes>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace quadtreesync {
 
 // ===================================================================
 
-class LowerLevelHashes : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:quadtreesync.LowerLevelHashes) */ {
+class LowerLevelHashes final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtreesync.LowerLevelHashes) */ {
  public:
-  LowerLevelHashes();
-  virtual ~LowerLevelHashes();
+  inline LowerLevelHashes() : LowerLevelHashes(nullptr) {}
+  ~LowerLevelHashes() override;
+  explicit PROTOBUF_CONSTEXPR LowerLevelHashes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LowerLevelHashes(const LowerLevelHashes& from);
+  LowerLevelHashes(LowerLevelHashes&& from) noexcept
+    : LowerLevelHashes() {
+    *this = ::std::move(from);
+  }
 
   inline LowerLevelHashes& operator=(const LowerLevelHashes& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline LowerLevelHashes& operator=(LowerLevelHashes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LowerLevelHashes& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LowerLevelHashes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LowerLevelHashes* internal_default_instance() {
+    return reinterpret_cast<const LowerLevelHashes*>(
+               &_LowerLevelHashes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(LowerLevelHashes* other);
+  friend void swap(LowerLevelHashes& a, LowerLevelHashes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LowerLevelHashes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LowerLevelHashes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LowerLevelHashes* New() const { return New(NULL); }
-
-  LowerLevelHashes* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  LowerLevelHashes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LowerLevelHashes>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LowerLevelHashes& from);
-  void MergeFrom(const LowerLevelHashes& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LowerLevelHashes& from) {
+    LowerLevelHashes::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(LowerLevelHashes* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtreesync.LowerLevelHashes";
   }
+  protected:
+  explicit LowerLevelHashes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kHashValuesFieldNumber = 3,
+    kNumChangesFieldNumber = 1,
+    kTreeLevelFieldNumber = 2,
+  };
+  // required .quadtreesync.HashValueList hashValues = 3;
+  bool has_hashvalues() const;
+  private:
+  bool _internal_has_hashvalues() const;
+  public:
+  void clear_hashvalues();
+  const ::quadtreesync::HashValueList& hashvalues() const;
+  PROTOBUF_NODISCARD ::quadtreesync::HashValueList* release_hashvalues();
+  ::quadtreesync::HashValueList* mutable_hashvalues();
+  void set_allocated_hashvalues(::quadtreesync::HashValueList* hashvalues);
+  private:
+  const ::quadtreesync::HashValueList& _internal_hashvalues() const;
+  ::quadtreesync::HashValueList* _internal_mutable_hashvalues();
+  public:
+  void unsafe_arena_set_allocated_hashvalues(
+      ::quadtreesync::HashValueList* hashvalues);
+  ::quadtreesync::HashValueList* unsafe_arena_release_hashvalues();
+
   // required uint64 numChanges = 1;
   bool has_numchanges() const;
+  private:
+  bool _internal_has_numchanges() const;
+  public:
   void clear_numchanges();
-  static const int kNumChangesFieldNumber = 1;
-  ::google::protobuf::uint64 numchanges() const;
-  void set_numchanges(::google::protobuf::uint64 value);
+  uint64_t numchanges() const;
+  void set_numchanges(uint64_t value);
+  private:
+  uint64_t _internal_numchanges() const;
+  void _internal_set_numchanges(uint64_t value);
+  public:
 
   // required uint64 treeLevel = 2;
   bool has_treelevel() const;
+  private:
+  bool _internal_has_treelevel() const;
+  public:
   void clear_treelevel();
-  static const int kTreeLevelFieldNumber = 2;
-  ::google::protobuf::uint64 treelevel() const;
-  void set_treelevel(::google::protobuf::uint64 value);
-
-  // required .quadtreesync.HashValueList hashValues = 3;
-  bool has_hashvalues() const;
-  void clear_hashvalues();
-  static const int kHashValuesFieldNumber = 3;
-  const ::quadtreesync::HashValueList& hashvalues() const;
-  ::quadtreesync::HashValueList* mutable_hashvalues();
-  ::quadtreesync::HashValueList* release_hashvalues();
-  void set_allocated_hashvalues(::quadtreesync::HashValueList* hashvalues);
+  uint64_t treelevel() const;
+  void set_treelevel(uint64_t value);
+  private:
+  uint64_t _internal_treelevel() const;
+  void _internal_set_treelevel(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:quadtreesync.LowerLevelHashes)
  private:
-  inline void set_has_numchanges();
-  inline void clear_has_numchanges();
-  inline void set_has_treelevel();
-  inline void clear_has_treelevel();
-  inline void set_has_hashvalues();
-  inline void clear_has_hashvalues();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint64 numchanges_;
-  ::google::protobuf::uint64 treelevel_;
-  ::quadtreesync::HashValueList* hashvalues_;
-  friend void  protobuf_AddDesc_LowerLevelHashes_2eproto();
-  friend void protobuf_AssignDesc_LowerLevelHashes_2eproto();
-  friend void protobuf_ShutdownFile_LowerLevelHashes_2eproto();
-
-  void InitAsDefaultInstance();
-  static LowerLevelHashes* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::quadtreesync::HashValueList* hashvalues_;
+    uint64_t numchanges_;
+    uint64_t treelevel_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_LowerLevelHashes_2eproto;
 };
 // -------------------------------------------------------------------
 
-class HashValueList : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:quadtreesync.HashValueList) */ {
+class HashValueList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtreesync.HashValueList) */ {
  public:
-  HashValueList();
-  virtual ~HashValueList();
+  inline HashValueList() : HashValueList(nullptr) {}
+  ~HashValueList() override;
+  explicit PROTOBUF_CONSTEXPR HashValueList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   HashValueList(const HashValueList& from);
+  HashValueList(HashValueList&& from) noexcept
+    : HashValueList() {
+    *this = ::std::move(from);
+  }
 
   inline HashValueList& operator=(const HashValueList& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline HashValueList& operator=(HashValueList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HashValueList& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HashValueList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HashValueList* internal_default_instance() {
+    return reinterpret_cast<const HashValueList*>(
+               &_HashValueList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(HashValueList* other);
+  friend void swap(HashValueList& a, HashValueList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HashValueList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HashValueList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline HashValueList* New() const { return New(NULL); }
-
-  HashValueList* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  HashValueList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HashValueList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const HashValueList& from);
-  void MergeFrom(const HashValueList& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HashValueList& from) {
+    HashValueList::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(HashValueList* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtreesync.HashValueList";
   }
+  protected:
+  explicit HashValueList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kHashValuesFieldNumber = 3,
+  };
   // repeated uint64 hashValues = 3;
   int hashvalues_size() const;
+  private:
+  int _internal_hashvalues_size() const;
+  public:
   void clear_hashvalues();
-  static const int kHashValuesFieldNumber = 3;
-  ::google::protobuf::uint64 hashvalues(int index) const;
-  void set_hashvalues(int index, ::google::protobuf::uint64 value);
-  void add_hashvalues(::google::protobuf::uint64 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+  private:
+  uint64_t _internal_hashvalues(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_hashvalues() const;
+  void _internal_add_hashvalues(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_hashvalues();
+  public:
+  uint64_t hashvalues(int index) const;
+  void set_hashvalues(int index, uint64_t value);
+  void add_hashvalues(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
       hashvalues() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
       mutable_hashvalues();
 
   // @@protoc_insertion_point(class_scope:quadtreesync.HashValueList)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > hashvalues_;
-  friend void  protobuf_AddDesc_LowerLevelHashes_2eproto();
-  friend void protobuf_AssignDesc_LowerLevelHashes_2eproto();
-  friend void protobuf_ShutdownFile_LowerLevelHashes_2eproto();
-
-  void InitAsDefaultInstance();
-  static HashValueList* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > hashvalues_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_LowerLevelHashes_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // LowerLevelHashes
 
 // required uint64 numChanges = 1;
-inline bool LowerLevelHashes::has_numchanges() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool LowerLevelHashes::_internal_has_numchanges() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void LowerLevelHashes::set_has_numchanges() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void LowerLevelHashes::clear_has_numchanges() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool LowerLevelHashes::has_numchanges() const {
+  return _internal_has_numchanges();
 }
 inline void LowerLevelHashes::clear_numchanges() {
-  numchanges_ = GOOGLE_ULONGLONG(0);
-  clear_has_numchanges();
+  _impl_.numchanges_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t LowerLevelHashes::_internal_numchanges() const {
+  return _impl_.numchanges_;
 }
-inline ::google::protobuf::uint64 LowerLevelHashes::numchanges() const {
+inline uint64_t LowerLevelHashes::numchanges() const {
   // @@protoc_insertion_point(field_get:quadtreesync.LowerLevelHashes.numChanges)
-  return numchanges_;
+  return _internal_numchanges();
 }
-inline void LowerLevelHashes::set_numchanges(::google::protobuf::uint64 value) {
-  set_has_numchanges();
-  numchanges_ = value;
+inline void LowerLevelHashes::_internal_set_numchanges(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.numchanges_ = value;
+}
+inline void LowerLevelHashes::set_numchanges(uint64_t value) {
+  _internal_set_numchanges(value);
   // @@protoc_insertion_point(field_set:quadtreesync.LowerLevelHashes.numChanges)
 }
 
 // required uint64 treeLevel = 2;
-inline bool LowerLevelHashes::has_treelevel() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool LowerLevelHashes::_internal_has_treelevel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void LowerLevelHashes::set_has_treelevel() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void LowerLevelHashes::clear_has_treelevel() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool LowerLevelHashes::has_treelevel() const {
+  return _internal_has_treelevel();
 }
 inline void LowerLevelHashes::clear_treelevel() {
-  treelevel_ = GOOGLE_ULONGLONG(0);
-  clear_has_treelevel();
+  _impl_.treelevel_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::uint64 LowerLevelHashes::treelevel() const {
+inline uint64_t LowerLevelHashes::_internal_treelevel() const {
+  return _impl_.treelevel_;
+}
+inline uint64_t LowerLevelHashes::treelevel() const {
   // @@protoc_insertion_point(field_get:quadtreesync.LowerLevelHashes.treeLevel)
-  return treelevel_;
+  return _internal_treelevel();
+}
+inline void LowerLevelHashes::_internal_set_treelevel(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.treelevel_ = value;
 }
-inline void LowerLevelHashes::set_treelevel(::google::protobuf::uint64 value) {
-  set_has_treelevel();
-  treelevel_ = value;
+inline void LowerLevelHashes::set_treelevel(uint64_t value) {
+  _internal_set_treelevel(value);
   // @@protoc_insertion_point(field_set:quadtreesync.LowerLevelHashes.treeLevel)
 }
 
 // required .quadtreesync.HashValueList hashValues = 3;
-inline bool LowerLevelHashes::has_hashvalues() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void LowerLevelHashes::set_has_hashvalues() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool LowerLevelHashes::_internal_has_hashvalues() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.hashvalues_ != nullptr);
+  return value;
 }
-inline void LowerLevelHashes::clear_has_hashvalues() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool LowerLevelHashes::has_hashvalues() const {
+  return _internal_has_hashvalues();
 }
 inline void LowerLevelHashes::clear_hashvalues() {
-  if (hashvalues_ != NULL) hashvalues_->::quadtreesync::HashValueList::Clear();
-  clear_has_hashvalues();
+  if (_impl_.hashvalues_ != nullptr) _impl_.hashvalues_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::quadtreesync::HashValueList& LowerLevelHashes::_internal_hashvalues() const {
+  const ::quadtreesync::HashValueList* p = _impl_.hashvalues_;
+  return p != nullptr ? *p : reinterpret_cast<const ::quadtreesync::HashValueList&>(
+      ::quadtreesync::_HashValueList_default_instance_);
 }
 inline const ::quadtreesync::HashValueList& LowerLevelHashes::hashvalues() const {
   // @@protoc_insertion_point(field_get:quadtreesync.LowerLevelHashes.hashValues)
-  return hashvalues_ != NULL ? *hashvalues_ : *default_instance_->hashvalues_;
+  return _internal_hashvalues();
 }
-inline ::quadtreesync::HashValueList* LowerLevelHashes::mutable_hashvalues() {
-  set_has_hashvalues();
-  if (hashvalues_ == NULL) {
-    hashvalues_ = new ::quadtreesync::HashValueList;
+inline void LowerLevelHashes::unsafe_arena_set_allocated_hashvalues(
+    ::quadtreesync::HashValueList* hashvalues) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hashvalues_);
   }
-  // @@protoc_insertion_point(field_mutable:quadtreesync.LowerLevelHashes.hashValues)
-  return hashvalues_;
+  _impl_.hashvalues_ = hashvalues;
+  if (hashvalues) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:quadtreesync.LowerLevelHashes.hashValues)
 }
 inline ::quadtreesync::HashValueList* LowerLevelHashes::release_hashvalues() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::quadtreesync::HashValueList* temp = _impl_.hashvalues_;
+  _impl_.hashvalues_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::quadtreesync::HashValueList* LowerLevelHashes::unsafe_arena_release_hashvalues() {
   // @@protoc_insertion_point(field_release:quadtreesync.LowerLevelHashes.hashValues)
-  clear_has_hashvalues();
-  ::quadtreesync::HashValueList* temp = hashvalues_;
-  hashvalues_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::quadtreesync::HashValueList* temp = _impl_.hashvalues_;
+  _impl_.hashvalues_ = nullptr;
   return temp;
 }
+inline ::quadtreesync::HashValueList* LowerLevelHashes::_internal_mutable_hashvalues() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.hashvalues_ == nullptr) {
+    auto* p = CreateMaybeMessage<::quadtreesync::HashValueList>(GetArenaForAllocation());
+    _impl_.hashvalues_ = p;
+  }
+  return _impl_.hashvalues_;
+}
+inline ::quadtreesync::HashValueList* LowerLevelHashes::mutable_hashvalues() {
+  ::quadtreesync::HashValueList* _msg = _internal_mutable_hashvalues();
+  // @@protoc_insertion_point(field_mutable:quadtreesync.LowerLevelHashes.hashValues)
+  return _msg;
+}
 inline void LowerLevelHashes::set_allocated_hashvalues(::quadtreesync::HashValueList* hashvalues) {
-  delete hashvalues_;
-  hashvalues_ = hashvalues;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hashvalues_;
+  }
   if (hashvalues) {
-    set_has_hashvalues();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hashvalues);
+    if (message_arena != submessage_arena) {
+      hashvalues = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hashvalues, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_hashvalues();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.hashvalues_ = hashvalues;
   // @@protoc_insertion_point(field_set_allocated:quadtreesync.LowerLevelHashes.hashValues)
 }
 
@@ -358,36 +586,55 @@ inline void LowerLevelHashes::set_allocated_hashvalues(::quadtreesync::HashValue
 // HashValueList
 
 // repeated uint64 hashValues = 3;
+inline int HashValueList::_internal_hashvalues_size() const {
+  return _impl_.hashvalues_.size();
+}
 inline int HashValueList::hashvalues_size() const {
-  return hashvalues_.size();
+  return _internal_hashvalues_size();
 }
 inline void HashValueList::clear_hashvalues() {
-  hashvalues_.Clear();
+  _impl_.hashvalues_.Clear();
+}
+inline uint64_t HashValueList::_internal_hashvalues(int index) const {
+  return _impl_.hashvalues_.Get(index);
 }
-inline ::google::protobuf::uint64 HashValueList::hashvalues(int index) const {
+inline uint64_t HashValueList::hashvalues(int index) const {
   // @@protoc_insertion_point(field_get:quadtreesync.HashValueList.hashValues)
-  return hashvalues_.Get(index);
+  return _internal_hashvalues(index);
 }
-inline void HashValueList::set_hashvalues(int index, ::google::protobuf::uint64 value) {
-  hashvalues_.Set(index, value);
+inline void HashValueList::set_hashvalues(int index, uint64_t value) {
+  _impl_.hashvalues_.Set(index, value);
   // @@protoc_insertion_point(field_set:quadtreesync.HashValueList.hashValues)
 }
-inline void HashValueList::add_hashvalues(::google::protobuf::uint64 value) {
-  hashvalues_.Add(value);
+inline void HashValueList::_internal_add_hashvalues(uint64_t value) {
+  _impl_.hashvalues_.Add(value);
+}
+inline void HashValueList::add_hashvalues(uint64_t value) {
+  _internal_add_hashvalues(value);
   // @@protoc_insertion_point(field_add:quadtreesync.HashValueList.hashValues)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+HashValueList::_internal_hashvalues() const {
+  return _impl_.hashvalues_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
 HashValueList::hashvalues() const {
   // @@protoc_insertion_point(field_list:quadtreesync.HashValueList.hashValues)
-  return hashvalues_;
+  return _internal_hashvalues();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+HashValueList::_internal_mutable_hashvalues() {
+  return &_impl_.hashvalues_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
 HashValueList::mutable_hashvalues() {
   // @@protoc_insertion_point(field_mutable_list:quadtreesync.HashValueList.hashValues)
-  return &hashvalues_;
+  return _internal_mutable_hashvalues();
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 
@@ -397,4 +644,5 @@ HashValueList::mutable_hashvalues() {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_LowerLevelHashes_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_LowerLevelHashes_2eproto
@@ -0,0 +1,323 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ResponseManifest.proto
+
+#include "ResponseManifest.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace quadtree {
+PROTOBUF_CONSTEXPR ResponseManifest::ResponseManifest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.digests_)*/{}
+  , /*decltype(_impl_.revision_)*/uint64_t{0u}} {}
+struct ResponseManifestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseManifestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseManifestDefaultTypeInternal() {}
+  union {
+    ResponseManifest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseManifestDefaultTypeInternal _ResponseManifest_default_instance_;
+}  // namespace quadtree
+static ::_pb::Metadata file_level_metadata_ResponseManifest_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ResponseManifest_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ResponseManifest_2eproto = nullptr;
+
+const uint32_t TableStruct_ResponseManifest_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::quadtree::ResponseManifest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::ResponseManifest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::ResponseManifest, _impl_.revision_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::ResponseManifest, _impl_.digests_),
+  0,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::quadtree::ResponseManifest)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::quadtree::_ResponseManifest_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ResponseManifest_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026ResponseManifest.proto\022\010quadtree\"5\n\020Re"
+  "sponseManifest\022\020\n\010revision\030\001 \002(\004\022\017\n\007dige"
+  "sts\030\002 \003(\014"
+  ;
+static ::_pbi::once_flag descriptor_table_ResponseManifest_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ResponseManifest_2eproto = {
+    false, false, 89, descriptor_table_protodef_ResponseManifest_2eproto,
+    "ResponseManifest.proto",
+    &descriptor_table_ResponseManifest_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_ResponseManifest_2eproto::offsets,
+    file_level_metadata_ResponseManifest_2eproto, file_level_enum_descriptors_ResponseManifest_2eproto,
+    file_level_service_descriptors_ResponseManifest_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ResponseManifest_2eproto_getter() {
+  return &descriptor_table_ResponseManifest_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ResponseManifest_2eproto(&descriptor_table_ResponseManifest_2eproto);
+namespace quadtree {
+
+// ===================================================================
+
+class ResponseManifest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ResponseManifest>()._impl_._has_bits_);
+  static void set_has_revision(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+ResponseManifest::ResponseManifest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.ResponseManifest)
+}
+ResponseManifest::ResponseManifest(const ResponseManifest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResponseManifest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.digests_){from._impl_.digests_}
+    , decltype(_impl_.revision_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.revision_ = from._impl_.revision_;
+  // @@protoc_insertion_point(copy_constructor:quadtree.ResponseManifest)
+}
+
+inline void ResponseManifest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.digests_){arena}
+    , decltype(_impl_.revision_){uint64_t{0u}}
+  };
+}
+
+ResponseManifest::~ResponseManifest() {
+  // @@protoc_insertion_point(destructor:quadtree.ResponseManifest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResponseManifest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.digests_.~RepeatedPtrField();
+}
+
+void ResponseManifest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResponseManifest::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.ResponseManifest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.digests_.Clear();
+  _impl_.revision_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResponseManifest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 revision = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_revision(&has_bits);
+          _impl_.revision_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes digests = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_digests();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResponseManifest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:quadtree.ResponseManifest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 revision = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_revision(), target);
+  }
+
+  // repeated bytes digests = 2;
+  for (int i = 0, n = this->_internal_digests_size(); i < n; i++) {
+    const auto& s = this->_internal_digests(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:quadtree.ResponseManifest)
+  return target;
+}
+
+size_t ResponseManifest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:quadtree.ResponseManifest)
+  size_t total_size = 0;
+
+  // required uint64 revision = 1;
+  if (_internal_has_revision()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_revision());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes digests = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.digests_.size());
+  for (int i = 0, n = _impl_.digests_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.digests_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResponseManifest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResponseManifest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResponseManifest::GetClassData() const { return &_class_data_; }
+
+
+void ResponseManifest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResponseManifest*>(&to_msg);
+  auto& from = static_cast<const ResponseManifest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.ResponseManifest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.digests_.MergeFrom(from._impl_.digests_);
+  if (from._internal_has_revision()) {
+    _this->_internal_set_revision(from._internal_revision());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResponseManifest::CopyFrom(const ResponseManifest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:quadtree.ResponseManifest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResponseManifest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ResponseManifest::InternalSwap(ResponseManifest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.digests_.InternalSwap(&other->_impl_.digests_);
+  swap(_impl_.revision_, other->_impl_.revision_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResponseManifest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ResponseManifest_2eproto_getter, &descriptor_table_ResponseManifest_2eproto_once,
+      file_level_metadata_ResponseManifest_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace quadtree
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::quadtree::ResponseManifest*
+Arena::CreateMaybeMessage< ::quadtree::ResponseManifest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::ResponseManifest >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,368 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ResponseManifest.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ResponseManifest_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ResponseManifest_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ResponseManifest_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ResponseManifest_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ResponseManifest_2eproto;
+namespace quadtree {
+class ResponseManifest;
+struct ResponseManifestDefaultTypeInternal;
+extern ResponseManifestDefaultTypeInternal _ResponseManifest_default_instance_;
+}  // namespace quadtree
+PROTOBUF_NAMESPACE_OPEN
+template<> ::quadtree::ResponseManifest* Arena::CreateMaybeMessage<::quadtree::ResponseManifest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace quadtree {
+
+// ===================================================================
+
+class ResponseManifest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.ResponseManifest) */ {
+ public:
+  inline ResponseManifest() : ResponseManifest(nullptr) {}
+  ~ResponseManifest() override;
+  explicit PROTOBUF_CONSTEXPR ResponseManifest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResponseManifest(const ResponseManifest& from);
+  ResponseManifest(ResponseManifest&& from) noexcept
+    : ResponseManifest() {
+    *this = ::std::move(from);
+  }
+
+  inline ResponseManifest& operator=(const ResponseManifest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResponseManifest& operator=(ResponseManifest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResponseManifest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResponseManifest* internal_default_instance() {
+    return reinterpret_cast<const ResponseManifest*>(
+               &_ResponseManifest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ResponseManifest& a, ResponseManifest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResponseManifest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResponseManifest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResponseManifest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResponseManifest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResponseManifest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResponseManifest& from) {
+    ResponseManifest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResponseManifest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.ResponseManifest";
+  }
+  protected:
+  explicit ResponseManifest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDigestsFieldNumber = 2,
+    kRevisionFieldNumber = 1,
+  };
+  // repeated bytes digests = 2;
+  int digests_size() const;
+  private:
+  int _internal_digests_size() const;
+  public:
+  void clear_digests();
+  const std::string& digests(int index) const;
+  std::string* mutable_digests(int index);
+  void set_digests(int index, const std::string& value);
+  void set_digests(int index, std::string&& value);
+  void set_digests(int index, const char* value);
+  void set_digests(int index, const void* value, size_t size);
+  std::string* add_digests();
+  void add_digests(const std::string& value);
+  void add_digests(std::string&& value);
+  void add_digests(const char* value);
+  void add_digests(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& digests() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_digests();
+  private:
+  const std::string& _internal_digests(int index) const;
+  std::string* _internal_add_digests();
+  public:
+
+  // required uint64 revision = 1;
+  bool has_revision() const;
+  private:
+  bool _internal_has_revision() const;
+  public:
+  void clear_revision();
+  uint64_t revision() const;
+  void set_revision(uint64_t value);
+  private:
+  uint64_t _internal_revision() const;
+  void _internal_set_revision(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:quadtree.ResponseManifest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> digests_;
+    uint64_t revision_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ResponseManifest_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ResponseManifest
+
+// required uint64 revision = 1;
+inline bool ResponseManifest::_internal_has_revision() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResponseManifest::has_revision() const {
+  return _internal_has_revision();
+}
+inline void ResponseManifest::clear_revision() {
+  _impl_.revision_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t ResponseManifest::_internal_revision() const {
+  return _impl_.revision_;
+}
+inline uint64_t ResponseManifest::revision() const {
+  // @@protoc_insertion_point(field_get:quadtree.ResponseManifest.revision)
+  return _internal_revision();
+}
+inline void ResponseManifest::_internal_set_revision(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.revision_ = value;
+}
+inline void ResponseManifest::set_revision(uint64_t value) {
+  _internal_set_revision(value);
+  // @@protoc_insertion_point(field_set:quadtree.ResponseManifest.revision)
+}
+
+// repeated bytes digests = 2;
+inline int ResponseManifest::_internal_digests_size() const {
+  return _impl_.digests_.size();
+}
+inline int ResponseManifest::digests_size() const {
+  return _internal_digests_size();
+}
+inline void ResponseManifest::clear_digests() {
+  _impl_.digests_.Clear();
+}
+inline std::string* ResponseManifest::add_digests() {
+  std::string* _s = _internal_add_digests();
+  // @@protoc_insertion_point(field_add_mutable:quadtree.ResponseManifest.digests)
+  return _s;
+}
+inline const std::string& ResponseManifest::_internal_digests(int index) const {
+  return _impl_.digests_.Get(index);
+}
+inline const std::string& ResponseManifest::digests(int index) const {
+  // @@protoc_insertion_point(field_get:quadtree.ResponseManifest.digests)
+  return _internal_digests(index);
+}
+inline std::string* ResponseManifest::mutable_digests(int index) {
+  // @@protoc_insertion_point(field_mutable:quadtree.ResponseManifest.digests)
+  return _impl_.digests_.Mutable(index);
+}
+inline void ResponseManifest::set_digests(int index, const std::string& value) {
+  _impl_.digests_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:quadtree.ResponseManifest.digests)
+}
+inline void ResponseManifest::set_digests(int index, std::string&& value) {
+  _impl_.digests_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:quadtree.ResponseManifest.digests)
+}
+inline void ResponseManifest::set_digests(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.digests_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:quadtree.ResponseManifest.digests)
+}
+inline void ResponseManifest::set_digests(int index, const void* value, size_t size) {
+  _impl_.digests_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:quadtree.ResponseManifest.digests)
+}
+inline std::string* ResponseManifest::_internal_add_digests() {
+  return _impl_.digests_.Add();
+}
+inline void ResponseManifest::add_digests(const std::string& value) {
+  _impl_.digests_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:quadtree.ResponseManifest.digests)
+}
+inline void ResponseManifest::add_digests(std::string&& value) {
+  _impl_.digests_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:quadtree.ResponseManifest.digests)
+}
+inline void ResponseManifest::add_digests(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.digests_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:quadtree.ResponseManifest.digests)
+}
+inline void ResponseManifest::add_digests(const void* value, size_t size) {
+  _impl_.digests_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:quadtree.ResponseManifest.digests)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ResponseManifest::digests() const {
+  // @@protoc_insertion_point(field_list:quadtree.ResponseManifest.digests)
+  return _impl_.digests_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ResponseManifest::mutable_digests() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.ResponseManifest.digests)
+  return &_impl_.digests_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace quadtree
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ResponseManifest_2eproto
@@ -0,0 +1,1423 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SyncRequest.proto
+
+#include "SyncRequest.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace quadtree {
+PROTOBUF_CONSTEXPR SyncRequest::SyncRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.subtrees_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncRequestDefaultTypeInternal() {}
+  union {
+    SyncRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncRequestDefaultTypeInternal _SyncRequest_default_instance_;
+PROTOBUF_CONSTEXPR SubtreeRequest::SubtreeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.subtree_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hash_)*/uint64_t{0u}} {}
+struct SubtreeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubtreeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubtreeRequestDefaultTypeInternal() {}
+  union {
+    SubtreeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubtreeRequestDefaultTypeInternal _SubtreeRequest_default_instance_;
+PROTOBUF_CONSTEXPR SubtreeDigests::SubtreeDigests(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.indices_)*/{}
+  , /*decltype(_impl_._indices_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.hashes_)*/{}
+  , /*decltype(_impl_._hashes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.depth_)*/0u} {}
+struct SubtreeDigestsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubtreeDigestsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubtreeDigestsDefaultTypeInternal() {}
+  union {
+    SubtreeDigests _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubtreeDigestsDefaultTypeInternal _SubtreeDigests_default_instance_;
+PROTOBUF_CONSTEXPR PeerState::PeerState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.region_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hash_)*/uint64_t{0u}} {}
+struct PeerStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PeerStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PeerStateDefaultTypeInternal() {}
+  union {
+    PeerState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PeerStateDefaultTypeInternal _PeerState_default_instance_;
+PROTOBUF_CONSTEXPR DigestHeartbeat::DigestHeartbeat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.regions_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DigestHeartbeatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DigestHeartbeatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DigestHeartbeatDefaultTypeInternal() {}
+  union {
+    DigestHeartbeat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DigestHeartbeatDefaultTypeInternal _DigestHeartbeat_default_instance_;
+}  // namespace quadtree
+static ::_pb::Metadata file_level_metadata_SyncRequest_2eproto[5];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_SyncRequest_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_SyncRequest_2eproto = nullptr;
+
+const uint32_t TableStruct_SyncRequest_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncRequest, _impl_.subtrees_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeRequest, _impl_.subtree_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeRequest, _impl_.hash_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeDigests, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeDigests, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeDigests, _impl_.depth_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeDigests, _impl_.indices_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeDigests, _impl_.hashes_),
+  0,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::quadtree::PeerState, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::PeerState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::PeerState, _impl_.region_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::PeerState, _impl_.hash_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::quadtree::DigestHeartbeat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::DigestHeartbeat, _impl_.regions_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::quadtree::SyncRequest)},
+  { 7, 15, -1, sizeof(::quadtree::SubtreeRequest)},
+  { 17, 26, -1, sizeof(::quadtree::SubtreeDigests)},
+  { 29, 37, -1, sizeof(::quadtree::PeerState)},
+  { 39, -1, -1, sizeof(::quadtree::DigestHeartbeat)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::quadtree::_SyncRequest_default_instance_._instance,
+  &::quadtree::_SubtreeRequest_default_instance_._instance,
+  &::quadtree::_SubtreeDigests_default_instance_._instance,
+  &::quadtree::_PeerState_default_instance_._instance,
+  &::quadtree::_DigestHeartbeat_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_SyncRequest_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021SyncRequest.proto\022\010quadtree\"9\n\013SyncReq"
+  "uest\022*\n\010subtrees\030\001 \003(\0132\030.quadtree.Subtre"
+  "eRequest\"/\n\016SubtreeRequest\022\017\n\007subtree\030\001 "
+  "\002(\t\022\014\n\004hash\030\002 \002(\004\"H\n\016SubtreeDigests\022\r\n\005d"
+  "epth\030\001 \002(\r\022\023\n\007indices\030\002 \003(\rB\002\020\001\022\022\n\006hashe"
+  "s\030\003 \003(\004B\002\020\001\")\n\tPeerState\022\016\n\006region\030\001 \002(\t"
+  "\022\014\n\004hash\030\002 \002(\004\"7\n\017DigestHeartbeat\022$\n\007reg"
+  "ions\030\001 \003(\0132\023.quadtree.PeerState"
+  ;
+static ::_pbi::once_flag descriptor_table_SyncRequest_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_SyncRequest_2eproto = {
+    false, false, 311, descriptor_table_protodef_SyncRequest_2eproto,
+    "SyncRequest.proto",
+    &descriptor_table_SyncRequest_2eproto_once, nullptr, 0, 5,
+    schemas, file_default_instances, TableStruct_SyncRequest_2eproto::offsets,
+    file_level_metadata_SyncRequest_2eproto, file_level_enum_descriptors_SyncRequest_2eproto,
+    file_level_service_descriptors_SyncRequest_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_SyncRequest_2eproto_getter() {
+  return &descriptor_table_SyncRequest_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_SyncRequest_2eproto(&descriptor_table_SyncRequest_2eproto);
+namespace quadtree {
+
+// ===================================================================
+
+class SyncRequest::_Internal {
+ public:
+};
+
+SyncRequest::SyncRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.SyncRequest)
+}
+SyncRequest::SyncRequest(const SyncRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.subtrees_){from._impl_.subtrees_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:quadtree.SyncRequest)
+}
+
+inline void SyncRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.subtrees_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SyncRequest::~SyncRequest() {
+  // @@protoc_insertion_point(destructor:quadtree.SyncRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.subtrees_.~RepeatedPtrField();
+}
+
+void SyncRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.SyncRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.subtrees_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .quadtree.SubtreeRequest subtrees = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_subtrees(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:quadtree.SyncRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .quadtree.SubtreeRequest subtrees = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_subtrees_size()); i < n; i++) {
+    const auto& repfield = this->_internal_subtrees(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:quadtree.SyncRequest)
+  return target;
+}
+
+size_t SyncRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:quadtree.SyncRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .quadtree.SubtreeRequest subtrees = 1;
+  total_size += 1UL * this->_internal_subtrees_size();
+  for (const auto& msg : this->_impl_.subtrees_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncRequest::GetClassData() const { return &_class_data_; }
+
+
+void SyncRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncRequest*>(&to_msg);
+  auto& from = static_cast<const SyncRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.SyncRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.subtrees_.MergeFrom(from._impl_.subtrees_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncRequest::CopyFrom(const SyncRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:quadtree.SyncRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncRequest::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.subtrees_))
+    return false;
+  return true;
+}
+
+void SyncRequest::InternalSwap(SyncRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.subtrees_.InternalSwap(&other->_impl_.subtrees_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SyncRequest_2eproto_getter, &descriptor_table_SyncRequest_2eproto_once,
+      file_level_metadata_SyncRequest_2eproto[0]);
+}
+
+// ===================================================================
+
+class SubtreeRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubtreeRequest>()._impl_._has_bits_);
+  static void set_has_subtree(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+SubtreeRequest::SubtreeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.SubtreeRequest)
+}
+SubtreeRequest::SubtreeRequest(const SubtreeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SubtreeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.subtree_){}
+    , decltype(_impl_.hash_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.subtree_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.subtree_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_subtree()) {
+    _this->_impl_.subtree_.Set(from._internal_subtree(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.hash_ = from._impl_.hash_;
+  // @@protoc_insertion_point(copy_constructor:quadtree.SubtreeRequest)
+}
+
+inline void SubtreeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.subtree_){}
+    , decltype(_impl_.hash_){uint64_t{0u}}
+  };
+  _impl_.subtree_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.subtree_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SubtreeRequest::~SubtreeRequest() {
+  // @@protoc_insertion_point(destructor:quadtree.SubtreeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubtreeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.subtree_.Destroy();
+}
+
+void SubtreeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubtreeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.SubtreeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.subtree_.ClearNonDefaultToEmpty();
+  }
+  _impl_.hash_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SubtreeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string subtree = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_subtree();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "quadtree.SubtreeRequest.subtree");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_hash(&has_bits);
+          _impl_.hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubtreeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:quadtree.SubtreeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string subtree = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_subtree().data(), static_cast<int>(this->_internal_subtree().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "quadtree.SubtreeRequest.subtree");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_subtree(), target);
+  }
+
+  // required uint64 hash = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:quadtree.SubtreeRequest)
+  return target;
+}
+
+size_t SubtreeRequest::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:quadtree.SubtreeRequest)
+  size_t total_size = 0;
+
+  if (_internal_has_subtree()) {
+    // required string subtree = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_subtree());
+  }
+
+  if (_internal_has_hash()) {
+    // required uint64 hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_hash());
+  }
+
+  return total_size;
+}
+size_t SubtreeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:quadtree.SubtreeRequest)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string subtree = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_subtree());
+
+    // required uint64 hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_hash());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubtreeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SubtreeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubtreeRequest::GetClassData() const { return &_class_data_; }
+
+
+void SubtreeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SubtreeRequest*>(&to_msg);
+  auto& from = static_cast<const SubtreeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.SubtreeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_subtree(from._internal_subtree());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.hash_ = from._impl_.hash_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SubtreeRequest::CopyFrom(const SubtreeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:quadtree.SubtreeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubtreeRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SubtreeRequest::InternalSwap(SubtreeRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.subtree_, lhs_arena,
+      &other->_impl_.subtree_, rhs_arena
+  );
+  swap(_impl_.hash_, other->_impl_.hash_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SubtreeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SyncRequest_2eproto_getter, &descriptor_table_SyncRequest_2eproto_once,
+      file_level_metadata_SyncRequest_2eproto[1]);
+}
+
+// ===================================================================
+
+class SubtreeDigests::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubtreeDigests>()._impl_._has_bits_);
+  static void set_has_depth(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+SubtreeDigests::SubtreeDigests(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.SubtreeDigests)
+}
+SubtreeDigests::SubtreeDigests(const SubtreeDigests& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SubtreeDigests* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.indices_){from._impl_.indices_}
+    , /*decltype(_impl_._indices_cached_byte_size_)*/{0}
+    , decltype(_impl_.hashes_){from._impl_.hashes_}
+    , /*decltype(_impl_._hashes_cached_byte_size_)*/{0}
+    , decltype(_impl_.depth_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.depth_ = from._impl_.depth_;
+  // @@protoc_insertion_point(copy_constructor:quadtree.SubtreeDigests)
+}
+
+inline void SubtreeDigests::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.indices_){arena}
+    , /*decltype(_impl_._indices_cached_byte_size_)*/{0}
+    , decltype(_impl_.hashes_){arena}
+    , /*decltype(_impl_._hashes_cached_byte_size_)*/{0}
+    , decltype(_impl_.depth_){0u}
+  };
+}
+
+SubtreeDigests::~SubtreeDigests() {
+  // @@protoc_insertion_point(destructor:quadtree.SubtreeDigests)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubtreeDigests::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.indices_.~RepeatedField();
+  _impl_.hashes_.~RepeatedField();
+}
+
+void SubtreeDigests::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubtreeDigests::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.SubtreeDigests)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.indices_.Clear();
+  _impl_.hashes_.Clear();
+  _impl_.depth_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SubtreeDigests::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint32 depth = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_depth(&has_bits);
+          _impl_.depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 indices = 2 [packed = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_indices(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_indices(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 hashes = 3 [packed = true];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_hashes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_hashes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubtreeDigests::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:quadtree.SubtreeDigests)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint32 depth = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_depth(), target);
+  }
+
+  // repeated uint32 indices = 2 [packed = true];
+  {
+    int byte_size = _impl_._indices_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_indices(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 hashes = 3 [packed = true];
+  {
+    int byte_size = _impl_._hashes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          3, _internal_hashes(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:quadtree.SubtreeDigests)
+  return target;
+}
+
+size_t SubtreeDigests::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:quadtree.SubtreeDigests)
+  size_t total_size = 0;
+
+  // required uint32 depth = 1;
+  if (_internal_has_depth()) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_depth());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 indices = 2 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.indices_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._indices_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 hashes = 3 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.hashes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._hashes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubtreeDigests::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SubtreeDigests::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubtreeDigests::GetClassData() const { return &_class_data_; }
+
+
+void SubtreeDigests::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SubtreeDigests*>(&to_msg);
+  auto& from = static_cast<const SubtreeDigests&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.SubtreeDigests)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.indices_.MergeFrom(from._impl_.indices_);
+  _this->_impl_.hashes_.MergeFrom(from._impl_.hashes_);
+  if (from._internal_has_depth()) {
+    _this->_internal_set_depth(from._internal_depth());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SubtreeDigests::CopyFrom(const SubtreeDigests& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:quadtree.SubtreeDigests)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubtreeDigests::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SubtreeDigests::InternalSwap(SubtreeDigests* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.indices_.InternalSwap(&other->_impl_.indices_);
+  _impl_.hashes_.InternalSwap(&other->_impl_.hashes_);
+  swap(_impl_.depth_, other->_impl_.depth_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SubtreeDigests::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SyncRequest_2eproto_getter, &descriptor_table_SyncRequest_2eproto_once,
+      file_level_metadata_SyncRequest_2eproto[2]);
+}
+
+// ===================================================================
+
+class PeerState::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PeerState>()._impl_._has_bits_);
+  static void set_has_region(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+PeerState::PeerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.PeerState)
+}
+PeerState::PeerState(const PeerState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PeerState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.region_){}
+    , decltype(_impl_.hash_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.region_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.region_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_region()) {
+    _this->_impl_.region_.Set(from._internal_region(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.hash_ = from._impl_.hash_;
+  // @@protoc_insertion_point(copy_constructor:quadtree.PeerState)
+}
+
+inline void PeerState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.region_){}
+    , decltype(_impl_.hash_){uint64_t{0u}}
+  };
+  _impl_.region_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.region_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PeerState::~PeerState() {
+  // @@protoc_insertion_point(destructor:quadtree.PeerState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PeerState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.region_.Destroy();
+}
+
+void PeerState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PeerState::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.PeerState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.region_.ClearNonDefaultToEmpty();
+  }
+  _impl_.hash_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PeerState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string region = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_region();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "quadtree.PeerState.region");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_hash(&has_bits);
+          _impl_.hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PeerState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:quadtree.PeerState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string region = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_region().data(), static_cast<int>(this->_internal_region().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "quadtree.PeerState.region");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_region(), target);
+  }
+
+  // required uint64 hash = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:quadtree.PeerState)
+  return target;
+}
+
+size_t PeerState::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:quadtree.PeerState)
+  size_t total_size = 0;
+
+  if (_internal_has_region()) {
+    // required string region = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_region());
+  }
+
+  if (_internal_has_hash()) {
+    // required uint64 hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_hash());
+  }
+
+  return total_size;
+}
+size_t PeerState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:quadtree.PeerState)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string region = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_region());
+
+    // required uint64 hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_hash());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PeerState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PeerState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PeerState::GetClassData() const { return &_class_data_; }
+
+
+void PeerState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PeerState*>(&to_msg);
+  auto& from = static_cast<const PeerState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.PeerState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_region(from._internal_region());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.hash_ = from._impl_.hash_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PeerState::CopyFrom(const PeerState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:quadtree.PeerState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PeerState::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void PeerState::InternalSwap(PeerState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.region_, lhs_arena,
+      &other->_impl_.region_, rhs_arena
+  );
+  swap(_impl_.hash_, other->_impl_.hash_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PeerState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SyncRequest_2eproto_getter, &descriptor_table_SyncRequest_2eproto_once,
+      file_level_metadata_SyncRequest_2eproto[3]);
+}
+
+// ===================================================================
+
+class DigestHeartbeat::_Internal {
+ public:
+};
+
+DigestHeartbeat::DigestHeartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.DigestHeartbeat)
+}
+DigestHeartbeat::DigestHeartbeat(const DigestHeartbeat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DigestHeartbeat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.regions_){from._impl_.regions_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:quadtree.DigestHeartbeat)
+}
+
+inline void DigestHeartbeat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.regions_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+DigestHeartbeat::~DigestHeartbeat() {
+  // @@protoc_insertion_point(destructor:quadtree.DigestHeartbeat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DigestHeartbeat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.regions_.~RepeatedPtrField();
+}
+
+void DigestHeartbeat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DigestHeartbeat::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.DigestHeartbeat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.regions_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DigestHeartbeat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .quadtree.PeerState regions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_regions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DigestHeartbeat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:quadtree.DigestHeartbeat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .quadtree.PeerState regions = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_regions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_regions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:quadtree.DigestHeartbeat)
+  return target;
+}
+
+size_t DigestHeartbeat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:quadtree.DigestHeartbeat)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .quadtree.PeerState regions = 1;
+  total_size += 1UL * this->_internal_regions_size();
+  for (const auto& msg : this->_impl_.regions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DigestHeartbeat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DigestHeartbeat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DigestHeartbeat::GetClassData() const { return &_class_data_; }
+
+
+void DigestHeartbeat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DigestHeartbeat*>(&to_msg);
+  auto& from = static_cast<const DigestHeartbeat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.DigestHeartbeat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.regions_.MergeFrom(from._impl_.regions_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DigestHeartbeat::CopyFrom(const DigestHeartbeat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:quadtree.DigestHeartbeat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DigestHeartbeat::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.regions_))
+    return false;
+  return true;
+}
+
+void DigestHeartbeat::InternalSwap(DigestHeartbeat* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.regions_.InternalSwap(&other->_impl_.regions_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DigestHeartbeat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SyncRequest_2eproto_getter, &descriptor_table_SyncRequest_2eproto_once,
+      file_level_metadata_SyncRequest_2eproto[4]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace quadtree
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::quadtree::SyncRequest*
+Arena::CreateMaybeMessage< ::quadtree::SyncRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::SyncRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::quadtree::SubtreeRequest*
+Arena::CreateMaybeMessage< ::quadtree::SubtreeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::SubtreeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::quadtree::SubtreeDigests*
+Arena::CreateMaybeMessage< ::quadtree::SubtreeDigests >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::SubtreeDigests >(arena);
+}
+template<> PROTOBUF_NOINLINE ::quadtree::PeerState*
+Arena::CreateMaybeMessage< ::quadtree::PeerState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::PeerState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::quadtree::DigestHeartbeat*
+Arena::CreateMaybeMessage< ::quadtree::DigestHeartbeat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::DigestHeartbeat >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1417 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SyncRequest.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_SyncRequest_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_SyncRequest_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_SyncRequest_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_SyncRequest_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_SyncRequest_2eproto;
+namespace quadtree {
+class DigestHeartbeat;
+struct DigestHeartbeatDefaultTypeInternal;
+extern DigestHeartbeatDefaultTypeInternal _DigestHeartbeat_default_instance_;
+class PeerState;
+struct PeerStateDefaultTypeInternal;
+extern PeerStateDefaultTypeInternal _PeerState_default_instance_;
+class SubtreeDigests;
+struct SubtreeDigestsDefaultTypeInternal;
+extern SubtreeDigestsDefaultTypeInternal _SubtreeDigests_default_instance_;
+class SubtreeRequest;
+struct SubtreeRequestDefaultTypeInternal;
+extern SubtreeRequestDefaultTypeInternal _SubtreeRequest_default_instance_;
+class SyncRequest;
+struct SyncRequestDefaultTypeInternal;
+extern SyncRequestDefaultTypeInternal _SyncRequest_default_instance_;
+}  // namespace quadtree
+PROTOBUF_NAMESPACE_OPEN
+template<> ::quadtree::DigestHeartbeat* Arena::CreateMaybeMessage<::quadtree::DigestHeartbeat>(Arena*);
+template<> ::quadtree::PeerState* Arena::CreateMaybeMessage<::quadtree::PeerState>(Arena*);
+template<> ::quadtree::SubtreeDigests* Arena::CreateMaybeMessage<::quadtree::SubtreeDigests>(Arena*);
+template<> ::quadtree::SubtreeRequest* Arena::CreateMaybeMessage<::quadtree::SubtreeRequest>(Arena*);
+template<> ::quadtree::SyncRequest* Arena::CreateMaybeMessage<::quadtree::SyncRequest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace quadtree {
+
+// ===================================================================
+
+class SyncRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.SyncRequest) */ {
+ public:
+  inline SyncRequest() : SyncRequest(nullptr) {}
+  ~SyncRequest() override;
+  explicit PROTOBUF_CONSTEXPR SyncRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncRequest(const SyncRequest& from);
+  SyncRequest(SyncRequest&& from) noexcept
+    : SyncRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncRequest& operator=(const SyncRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncRequest& operator=(SyncRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncRequest* internal_default_instance() {
+    return reinterpret_cast<const SyncRequest*>(
+               &_SyncRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SyncRequest& a, SyncRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncRequest& from) {
+    SyncRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.SyncRequest";
+  }
+  protected:
+  explicit SyncRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSubtreesFieldNumber = 1,
+  };
+  // repeated .quadtree.SubtreeRequest subtrees = 1;
+  int subtrees_size() const;
+  private:
+  int _internal_subtrees_size() const;
+  public:
+  void clear_subtrees();
+  ::quadtree::SubtreeRequest* mutable_subtrees(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::SubtreeRequest >*
+      mutable_subtrees();
+  private:
+  const ::quadtree::SubtreeRequest& _internal_subtrees(int index) const;
+  ::quadtree::SubtreeRequest* _internal_add_subtrees();
+  public:
+  const ::quadtree::SubtreeRequest& subtrees(int index) const;
+  ::quadtree::SubtreeRequest* add_subtrees();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::SubtreeRequest >&
+      subtrees() const;
+
+  // @@protoc_insertion_point(class_scope:quadtree.SyncRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::SubtreeRequest > subtrees_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SyncRequest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubtreeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.SubtreeRequest) */ {
+ public:
+  inline SubtreeRequest() : SubtreeRequest(nullptr) {}
+  ~SubtreeRequest() override;
+  explicit PROTOBUF_CONSTEXPR SubtreeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubtreeRequest(const SubtreeRequest& from);
+  SubtreeRequest(SubtreeRequest&& from) noexcept
+    : SubtreeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SubtreeRequest& operator=(const SubtreeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubtreeRequest& operator=(SubtreeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubtreeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubtreeRequest* internal_default_instance() {
+    return reinterpret_cast<const SubtreeRequest*>(
+               &_SubtreeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(SubtreeRequest& a, SubtreeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubtreeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubtreeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubtreeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubtreeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SubtreeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubtreeRequest& from) {
+    SubtreeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SubtreeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.SubtreeRequest";
+  }
+  protected:
+  explicit SubtreeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSubtreeFieldNumber = 1,
+    kHashFieldNumber = 2,
+  };
+  // required string subtree = 1;
+  bool has_subtree() const;
+  private:
+  bool _internal_has_subtree() const;
+  public:
+  void clear_subtree();
+  const std::string& subtree() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_subtree(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_subtree();
+  PROTOBUF_NODISCARD std::string* release_subtree();
+  void set_allocated_subtree(std::string* subtree);
+  private:
+  const std::string& _internal_subtree() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_subtree(const std::string& value);
+  std::string* _internal_mutable_subtree();
+  public:
+
+  // required uint64 hash = 2;
+  bool has_hash() const;
+  private:
+  bool _internal_has_hash() const;
+  public:
+  void clear_hash();
+  uint64_t hash() const;
+  void set_hash(uint64_t value);
+  private:
+  uint64_t _internal_hash() const;
+  void _internal_set_hash(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:quadtree.SubtreeRequest)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subtree_;
+    uint64_t hash_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SyncRequest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubtreeDigests final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.SubtreeDigests) */ {
+ public:
+  inline SubtreeDigests() : SubtreeDigests(nullptr) {}
+  ~SubtreeDigests() override;
+  explicit PROTOBUF_CONSTEXPR SubtreeDigests(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubtreeDigests(const SubtreeDigests& from);
+  SubtreeDigests(SubtreeDigests&& from) noexcept
+    : SubtreeDigests() {
+    *this = ::std::move(from);
+  }
+
+  inline SubtreeDigests& operator=(const SubtreeDigests& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubtreeDigests& operator=(SubtreeDigests&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubtreeDigests& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubtreeDigests* internal_default_instance() {
+    return reinterpret_cast<const SubtreeDigests*>(
+               &_SubtreeDigests_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SubtreeDigests& a, SubtreeDigests& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubtreeDigests* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubtreeDigests* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubtreeDigests* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubtreeDigests>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SubtreeDigests& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubtreeDigests& from) {
+    SubtreeDigests::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SubtreeDigests* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.SubtreeDigests";
+  }
+  protected:
+  explicit SubtreeDigests(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIndicesFieldNumber = 2,
+    kHashesFieldNumber = 3,
+    kDepthFieldNumber = 1,
+  };
+  // repeated uint32 indices = 2 [packed = true];
+  int indices_size() const;
+  private:
+  int _internal_indices_size() const;
+  public:
+  void clear_indices();
+  private:
+  uint32_t _internal_indices(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_indices() const;
+  void _internal_add_indices(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_indices();
+  public:
+  uint32_t indices(int index) const;
+  void set_indices(int index, uint32_t value);
+  void add_indices(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      indices() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_indices();
+
+  // repeated uint64 hashes = 3 [packed = true];
+  int hashes_size() const;
+  private:
+  int _internal_hashes_size() const;
+  public:
+  void clear_hashes();
+  private:
+  uint64_t _internal_hashes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_hashes() const;
+  void _internal_add_hashes(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_hashes();
+  public:
+  uint64_t hashes(int index) const;
+  void set_hashes(int index, uint64_t value);
+  void add_hashes(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      hashes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_hashes();
+
+  // required uint32 depth = 1;
+  bool has_depth() const;
+  private:
+  bool _internal_has_depth() const;
+  public:
+  void clear_depth();
+  uint32_t depth() const;
+  void set_depth(uint32_t value);
+  private:
+  uint32_t _internal_depth() const;
+  void _internal_set_depth(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:quadtree.SubtreeDigests)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > indices_;
+    mutable std::atomic<int> _indices_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > hashes_;
+    mutable std::atomic<int> _hashes_cached_byte_size_;
+    uint32_t depth_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SyncRequest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PeerState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.PeerState) */ {
+ public:
+  inline PeerState() : PeerState(nullptr) {}
+  ~PeerState() override;
+  explicit PROTOBUF_CONSTEXPR PeerState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PeerState(const PeerState& from);
+  PeerState(PeerState&& from) noexcept
+    : PeerState() {
+    *this = ::std::move(from);
+  }
+
+  inline PeerState& operator=(const PeerState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PeerState& operator=(PeerState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PeerState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PeerState* internal_default_instance() {
+    return reinterpret_cast<const PeerState*>(
+               &_PeerState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(PeerState& a, PeerState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PeerState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PeerState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PeerState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PeerState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PeerState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PeerState& from) {
+    PeerState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PeerState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.PeerState";
+  }
+  protected:
+  explicit PeerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRegionFieldNumber = 1,
+    kHashFieldNumber = 2,
+  };
+  // required string region = 1;
+  bool has_region() const;
+  private:
+  bool _internal_has_region() const;
+  public:
+  void clear_region();
+  const std::string& region() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_region(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_region();
+  PROTOBUF_NODISCARD std::string* release_region();
+  void set_allocated_region(std::string* region);
+  private:
+  const std::string& _internal_region() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_region(const std::string& value);
+  std::string* _internal_mutable_region();
+  public:
+
+  // required uint64 hash = 2;
+  bool has_hash() const;
+  private:
+  bool _internal_has_hash() const;
+  public:
+  void clear_hash();
+  uint64_t hash() const;
+  void set_hash(uint64_t value);
+  private:
+  uint64_t _internal_hash() const;
+  void _internal_set_hash(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:quadtree.PeerState)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr region_;
+    uint64_t hash_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SyncRequest_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DigestHeartbeat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.DigestHeartbeat) */ {
+ public:
+  inline DigestHeartbeat() : DigestHeartbeat(nullptr) {}
+  ~DigestHeartbeat() override;
+  explicit PROTOBUF_CONSTEXPR DigestHeartbeat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DigestHeartbeat(const DigestHeartbeat& from);
+  DigestHeartbeat(DigestHeartbeat&& from) noexcept
+    : DigestHeartbeat() {
+    *this = ::std::move(from);
+  }
+
+  inline DigestHeartbeat& operator=(const DigestHeartbeat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DigestHeartbeat& operator=(DigestHeartbeat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DigestHeartbeat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DigestHeartbeat* internal_default_instance() {
+    return reinterpret_cast<const DigestHeartbeat*>(
+               &_DigestHeartbeat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(DigestHeartbeat& a, DigestHeartbeat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DigestHeartbeat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DigestHeartbeat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DigestHeartbeat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DigestHeartbeat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DigestHeartbeat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DigestHeartbeat& from) {
+    DigestHeartbeat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DigestHeartbeat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.DigestHeartbeat";
+  }
+  protected:
+  explicit DigestHeartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRegionsFieldNumber = 1,
+  };
+  // repeated .quadtree.PeerState regions = 1;
+  int regions_size() const;
+  private:
+  int _internal_regions_size() const;
+  public:
+  void clear_regions();
+  ::quadtree::PeerState* mutable_regions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::PeerState >*
+      mutable_regions();
+  private:
+  const ::quadtree::PeerState& _internal_regions(int index) const;
+  ::quadtree::PeerState* _internal_add_regions();
+  public:
+  const ::quadtree::PeerState& regions(int index) const;
+  ::quadtree::PeerState* add_regions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::PeerState >&
+      regions() const;
+
+  // @@protoc_insertion_point(class_scope:quadtree.DigestHeartbeat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::PeerState > regions_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SyncRequest_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SyncRequest
+
+// repeated .quadtree.SubtreeRequest subtrees = 1;
+inline int SyncRequest::_internal_subtrees_size() const {
+  return _impl_.subtrees_.size();
+}
+inline int SyncRequest::subtrees_size() const {
+  return _internal_subtrees_size();
+}
+inline void SyncRequest::clear_subtrees() {
+  _impl_.subtrees_.Clear();
+}
+inline ::quadtree::SubtreeRequest* SyncRequest::mutable_subtrees(int index) {
+  // @@protoc_insertion_point(field_mutable:quadtree.SyncRequest.subtrees)
+  return _impl_.subtrees_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::SubtreeRequest >*
+SyncRequest::mutable_subtrees() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.SyncRequest.subtrees)
+  return &_impl_.subtrees_;
+}
+inline const ::quadtree::SubtreeRequest& SyncRequest::_internal_subtrees(int index) const {
+  return _impl_.subtrees_.Get(index);
+}
+inline const ::quadtree::SubtreeRequest& SyncRequest::subtrees(int index) const {
+  // @@protoc_insertion_point(field_get:quadtree.SyncRequest.subtrees)
+  return _internal_subtrees(index);
+}
+inline ::quadtree::SubtreeRequest* SyncRequest::_internal_add_subtrees() {
+  return _impl_.subtrees_.Add();
+}
+inline ::quadtree::SubtreeRequest* SyncRequest::add_subtrees() {
+  ::quadtree::SubtreeRequest* _add = _internal_add_subtrees();
+  // @@protoc_insertion_point(field_add:quadtree.SyncRequest.subtrees)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::SubtreeRequest >&
+SyncRequest::subtrees() const {
+  // @@protoc_insertion_point(field_list:quadtree.SyncRequest.subtrees)
+  return _impl_.subtrees_;
+}
+
+// -------------------------------------------------------------------
+
+// SubtreeRequest
+
+// required string subtree = 1;
+inline bool SubtreeRequest::_internal_has_subtree() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubtreeRequest::has_subtree() const {
+  return _internal_has_subtree();
+}
+inline void SubtreeRequest::clear_subtree() {
+  _impl_.subtree_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubtreeRequest::subtree() const {
+  // @@protoc_insertion_point(field_get:quadtree.SubtreeRequest.subtree)
+  return _internal_subtree();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubtreeRequest::set_subtree(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.subtree_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:quadtree.SubtreeRequest.subtree)
+}
+inline std::string* SubtreeRequest::mutable_subtree() {
+  std::string* _s = _internal_mutable_subtree();
+  // @@protoc_insertion_point(field_mutable:quadtree.SubtreeRequest.subtree)
+  return _s;
+}
+inline const std::string& SubtreeRequest::_internal_subtree() const {
+  return _impl_.subtree_.Get();
+}
+inline void SubtreeRequest::_internal_set_subtree(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subtree_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubtreeRequest::_internal_mutable_subtree() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.subtree_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubtreeRequest::release_subtree() {
+  // @@protoc_insertion_point(field_release:quadtree.SubtreeRequest.subtree)
+  if (!_internal_has_subtree()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.subtree_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subtree_.IsDefault()) {
+    _impl_.subtree_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubtreeRequest::set_allocated_subtree(std::string* subtree) {
+  if (subtree != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.subtree_.SetAllocated(subtree, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subtree_.IsDefault()) {
+    _impl_.subtree_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:quadtree.SubtreeRequest.subtree)
+}
+
+// required uint64 hash = 2;
+inline bool SubtreeRequest::_internal_has_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubtreeRequest::has_hash() const {
+  return _internal_has_hash();
+}
+inline void SubtreeRequest::clear_hash() {
+  _impl_.hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SubtreeRequest::_internal_hash() const {
+  return _impl_.hash_;
+}
+inline uint64_t SubtreeRequest::hash() const {
+  // @@protoc_insertion_point(field_get:quadtree.SubtreeRequest.hash)
+  return _internal_hash();
+}
+inline void SubtreeRequest::_internal_set_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.hash_ = value;
+}
+inline void SubtreeRequest::set_hash(uint64_t value) {
+  _internal_set_hash(value);
+  // @@protoc_insertion_point(field_set:quadtree.SubtreeRequest.hash)
+}
+
+// -------------------------------------------------------------------
+
+// SubtreeDigests
+
+// required uint32 depth = 1;
+inline bool SubtreeDigests::_internal_has_depth() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubtreeDigests::has_depth() const {
+  return _internal_has_depth();
+}
+inline void SubtreeDigests::clear_depth() {
+  _impl_.depth_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t SubtreeDigests::_internal_depth() const {
+  return _impl_.depth_;
+}
+inline uint32_t SubtreeDigests::depth() const {
+  // @@protoc_insertion_point(field_get:quadtree.SubtreeDigests.depth)
+  return _internal_depth();
+}
+inline void SubtreeDigests::_internal_set_depth(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.depth_ = value;
+}
+inline void SubtreeDigests::set_depth(uint32_t value) {
+  _internal_set_depth(value);
+  // @@protoc_insertion_point(field_set:quadtree.SubtreeDigests.depth)
+}
+
+// repeated uint32 indices = 2 [packed = true];
+inline int SubtreeDigests::_internal_indices_size() const {
+  return _impl_.indices_.size();
+}
+inline int SubtreeDigests::indices_size() const {
+  return _internal_indices_size();
+}
+inline void SubtreeDigests::clear_indices() {
+  _impl_.indices_.Clear();
+}
+inline uint32_t SubtreeDigests::_internal_indices(int index) const {
+  return _impl_.indices_.Get(index);
+}
+inline uint32_t SubtreeDigests::indices(int index) const {
+  // @@protoc_insertion_point(field_get:quadtree.SubtreeDigests.indices)
+  return _internal_indices(index);
+}
+inline void SubtreeDigests::set_indices(int index, uint32_t value) {
+  _impl_.indices_.Set(index, value);
+  // @@protoc_insertion_point(field_set:quadtree.SubtreeDigests.indices)
+}
+inline void SubtreeDigests::_internal_add_indices(uint32_t value) {
+  _impl_.indices_.Add(value);
+}
+inline void SubtreeDigests::add_indices(uint32_t value) {
+  _internal_add_indices(value);
+  // @@protoc_insertion_point(field_add:quadtree.SubtreeDigests.indices)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SubtreeDigests::_internal_indices() const {
+  return _impl_.indices_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SubtreeDigests::indices() const {
+  // @@protoc_insertion_point(field_list:quadtree.SubtreeDigests.indices)
+  return _internal_indices();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SubtreeDigests::_internal_mutable_indices() {
+  return &_impl_.indices_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SubtreeDigests::mutable_indices() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.SubtreeDigests.indices)
+  return _internal_mutable_indices();
+}
+
+// repeated uint64 hashes = 3 [packed = true];
+inline int SubtreeDigests::_internal_hashes_size() const {
+  return _impl_.hashes_.size();
+}
+inline int SubtreeDigests::hashes_size() const {
+  return _internal_hashes_size();
+}
+inline void SubtreeDigests::clear_hashes() {
+  _impl_.hashes_.Clear();
+}
+inline uint64_t SubtreeDigests::_internal_hashes(int index) const {
+  return _impl_.hashes_.Get(index);
+}
+inline uint64_t SubtreeDigests::hashes(int index) const {
+  // @@protoc_insertion_point(field_get:quadtree.SubtreeDigests.hashes)
+  return _internal_hashes(index);
+}
+inline void SubtreeDigests::set_hashes(int index, uint64_t value) {
+  _impl_.hashes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:quadtree.SubtreeDigests.hashes)
+}
+inline void SubtreeDigests::_internal_add_hashes(uint64_t value) {
+  _impl_.hashes_.Add(value);
+}
+inline void SubtreeDigests::add_hashes(uint64_t value) {
+  _internal_add_hashes(value);
+  // @@protoc_insertion_point(field_add:quadtree.SubtreeDigests.hashes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SubtreeDigests::_internal_hashes() const {
+  return _impl_.hashes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SubtreeDigests::hashes() const {
+  // @@protoc_insertion_point(field_list:quadtree.SubtreeDigests.hashes)
+  return _internal_hashes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SubtreeDigests::_internal_mutable_hashes() {
+  return &_impl_.hashes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SubtreeDigests::mutable_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.SubtreeDigests.hashes)
+  return _internal_mutable_hashes();
+}
+
+// -------------------------------------------------------------------
+
+// PeerState
+
+// required string region = 1;
+inline bool PeerState::_internal_has_region() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PeerState::has_region() const {
+  return _internal_has_region();
+}
+inline void PeerState::clear_region() {
+  _impl_.region_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PeerState::region() const {
+  // @@protoc_insertion_point(field_get:quadtree.PeerState.region)
+  return _internal_region();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PeerState::set_region(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.region_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:quadtree.PeerState.region)
+}
+inline std::string* PeerState::mutable_region() {
+  std::string* _s = _internal_mutable_region();
+  // @@protoc_insertion_point(field_mutable:quadtree.PeerState.region)
+  return _s;
+}
+inline const std::string& PeerState::_internal_region() const {
+  return _impl_.region_.Get();
+}
+inline void PeerState::_internal_set_region(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.region_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PeerState::_internal_mutable_region() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.region_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PeerState::release_region() {
+  // @@protoc_insertion_point(field_release:quadtree.PeerState.region)
+  if (!_internal_has_region()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.region_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.region_.IsDefault()) {
+    _impl_.region_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PeerState::set_allocated_region(std::string* region) {
+  if (region != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.region_.SetAllocated(region, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.region_.IsDefault()) {
+    _impl_.region_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:quadtree.PeerState.region)
+}
+
+// required uint64 hash = 2;
+inline bool PeerState::_internal_has_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PeerState::has_hash() const {
+  return _internal_has_hash();
+}
+inline void PeerState::clear_hash() {
+  _impl_.hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t PeerState::_internal_hash() const {
+  return _impl_.hash_;
+}
+inline uint64_t PeerState::hash() const {
+  // @@protoc_insertion_point(field_get:quadtree.PeerState.hash)
+  return _internal_hash();
+}
+inline void PeerState::_internal_set_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.hash_ = value;
+}
+inline void PeerState::set_hash(uint64_t value) {
+  _internal_set_hash(value);
+  // @@protoc_insertion_point(field_set:quadtree.PeerState.hash)
+}
+
+// -------------------------------------------------------------------
+
+// DigestHeartbeat
+
+// repeated .quadtree.PeerState regions = 1;
+inline int DigestHeartbeat::_internal_regions_size() const {
+  return _impl_.regions_.size();
+}
+inline int DigestHeartbeat::regions_size() const {
+  return _internal_regions_size();
+}
+inline void DigestHeartbeat::clear_regions() {
+  _impl_.regions_.Clear();
+}
+inline ::quadtree::PeerState* DigestHeartbeat::mutable_regions(int index) {
+  // @@protoc_insertion_point(field_mutable:quadtree.DigestHeartbeat.regions)
+  return _impl_.regions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::PeerState >*
+DigestHeartbeat::mutable_regions() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.DigestHeartbeat.regions)
+  return &_impl_.regions_;
+}
+inline const ::quadtree::PeerState& DigestHeartbeat::_internal_regions(int index) const {
+  return _impl_.regions_.Get(index);
+}
+inline const ::quadtree::PeerState& DigestHeartbeat::regions(int index) const {
+  // @@protoc_insertion_point(field_get:quadtree.DigestHeartbeat.regions)
+  return _internal_regions(index);
+}
+inline ::quadtree::PeerState* DigestHeartbeat::_internal_add_regions() {
+  return _impl_.regions_.Add();
+}
+inline ::quadtree::PeerState* DigestHeartbeat::add_regions() {
+  ::quadtree::PeerState* _add = _internal_add_regions();
+  // @@protoc_insertion_point(field_add:quadtree.DigestHeartbeat.regions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::PeerState >&
+DigestHeartbeat::regions() const {
+  // @@protoc_insertion_point(field_list:quadtree.DigestHeartbeat.regions)
+  return _impl_.regions_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace quadtree
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_SyncRequest_2eproto
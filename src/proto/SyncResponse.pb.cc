@@ -1,520 +1,709 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: SyncResponse.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "SyncResponse.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace quadtree {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* SyncResponse_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SyncResponse_reflection_ = NULL;
-const ::google::protobuf::Descriptor* ChunkData_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  ChunkData_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_SyncResponse_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AssignDesc_SyncResponse_2eproto() {
-  protobuf_AddDesc_SyncResponse_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "SyncResponse.proto");
-  GOOGLE_CHECK(file != NULL);
-  SyncResponse_descriptor_ = file->message_type(0);
-  static const int SyncResponse_offsets_[7] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncResponse, hashknown_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncResponse, chunkdata_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncResponse, curhash_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncResponse, lastpublishevent_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncResponse, chunks_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncResponse, treelevel_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncResponse, hashvalues_),
+namespace quadtree {
+PROTOBUF_CONSTEXPR SyncResponse::SyncResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.chunks_)*/{}
+  , /*decltype(_impl_.hashvalues_)*/{}
+  , /*decltype(_impl_.manifest_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.snapshot_)*/nullptr
+  , /*decltype(_impl_.hashknown_)*/false
+  , /*decltype(_impl_.chunkdata_)*/false
+  , /*decltype(_impl_.treelevel_)*/0u
+  , /*decltype(_impl_.curhash_)*/uint64_t{0u}
+  , /*decltype(_impl_.lastpublishevent_)*/int64_t{0}
+  , /*decltype(_impl_.hashoffset_)*/0u
+  , /*decltype(_impl_.hashbits_)*/0u
+  , /*decltype(_impl_.revision_)*/uint64_t{0u}
+  , /*decltype(_impl_.subtreerevision_)*/uint64_t{0u}} {}
+struct SyncResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncResponseDefaultTypeInternal() {}
+  union {
+    SyncResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncResponseDefaultTypeInternal _SyncResponse_default_instance_;
+PROTOBUF_CONSTEXPR RegionSnapshot::RegionSnapshot(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mortondeltas_)*/{}
+  , /*decltype(_impl_._mortondeltas_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.versions_)*/{}
+  , /*decltype(_impl_._versions_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.chunkcounts_)*/{}
+  , /*decltype(_impl_._chunkcounts_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RegionSnapshotDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RegionSnapshotDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RegionSnapshotDefaultTypeInternal() {}
+  union {
+    RegionSnapshot _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegionSnapshotDefaultTypeInternal _RegionSnapshot_default_instance_;
+PROTOBUF_CONSTEXPR AggregatedSyncResponse::AggregatedSyncResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.responses_)*/{}
+  , /*decltype(_impl_.omitted_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AggregatedSyncResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AggregatedSyncResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AggregatedSyncResponseDefaultTypeInternal() {}
+  union {
+    AggregatedSyncResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AggregatedSyncResponseDefaultTypeInternal _AggregatedSyncResponse_default_instance_;
+PROTOBUF_CONSTEXPR SubtreeSyncResponse::SubtreeSyncResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.subtree_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.response_)*/nullptr} {}
+struct SubtreeSyncResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubtreeSyncResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubtreeSyncResponseDefaultTypeInternal() {}
+  union {
+    SubtreeSyncResponse _instance;
   };
-  SyncResponse_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      SyncResponse_descriptor_,
-      SyncResponse::default_instance_,
-      SyncResponse_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncResponse, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(SyncResponse),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SyncResponse, _internal_metadata_),
-      -1);
-  ChunkData_descriptor_ = file->message_type(1);
-  static const int ChunkData_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChunkData, x_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChunkData, y_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChunkData, data_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubtreeSyncResponseDefaultTypeInternal _SubtreeSyncResponse_default_instance_;
+PROTOBUF_CONSTEXPR ChunkData::ChunkData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/uint64_t{0u}
+  , /*decltype(_impl_.y_)*/uint64_t{0u}
+  , /*decltype(_impl_.data_)*/uint64_t{0u}} {}
+struct ChunkDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChunkDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChunkDataDefaultTypeInternal() {}
+  union {
+    ChunkData _instance;
   };
-  ChunkData_reflection_ =
-    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
-      ChunkData_descriptor_,
-      ChunkData::default_instance_,
-      ChunkData_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChunkData, _has_bits_[0]),
-      -1,
-      -1,
-      sizeof(ChunkData),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChunkData, _internal_metadata_),
-      -1);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_SyncResponse_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      SyncResponse_descriptor_, &SyncResponse::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-      ChunkData_descriptor_, &ChunkData::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_SyncResponse_2eproto() {
-  delete SyncResponse::default_instance_;
-  delete SyncResponse_reflection_;
-  delete ChunkData::default_instance_;
-  delete ChunkData_reflection_;
-}
-
-void protobuf_AddDesc_SyncResponse_2eproto() GOOGLE_ATTRIBUTE_COLD;
-void protobuf_AddDesc_SyncResponse_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\022SyncResponse.proto\022\010quadtree\"\253\001\n\014SyncR"
-    "esponse\022\021\n\thashKnown\030\001 \002(\010\022\021\n\tchunkData\030"
-    "\002 \002(\010\022\017\n\007curHash\030\003 \002(\004\022\030\n\020lastPublishEve"
-    "nt\030\007 \002(\003\022#\n\006chunks\030\004 \003(\0132\023.quadtree.Chun"
-    "kData\022\021\n\ttreeLevel\030\005 \001(\r\022\022\n\nhashValues\030\006"
-    " \003(\004\"/\n\tChunkData\022\t\n\001x\030\001 \002(\004\022\t\n\001y\030\002 \002(\004\022"
-    "\014\n\004data\030\003 \002(\004", 253);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "SyncResponse.proto", &protobuf_RegisterTypes);
-  SyncResponse::default_instance_ = new SyncResponse();
-  ChunkData::default_instance_ = new ChunkData();
-  SyncResponse::default_instance_->InitAsDefaultInstance();
-  ChunkData::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_SyncResponse_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_SyncResponse_2eproto {
-  StaticDescriptorInitializer_SyncResponse_2eproto() {
-    protobuf_AddDesc_SyncResponse_2eproto();
-  }
-} static_descriptor_initializer_SyncResponse_2eproto_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChunkDataDefaultTypeInternal _ChunkData_default_instance_;
+}  // namespace quadtree
+static ::_pb::Metadata file_level_metadata_SyncResponse_2eproto[5];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_SyncResponse_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_SyncResponse_2eproto = nullptr;
+
+const uint32_t TableStruct_SyncResponse_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.hashknown_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.chunkdata_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.curhash_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.lastpublishevent_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.chunks_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.treelevel_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.hashvalues_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.manifest_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.hashoffset_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.hashbits_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.revision_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.subtreerevision_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SyncResponse, _impl_.snapshot_),
+  2,
+  3,
+  5,
+  6,
+  ~0u,
+  4,
+  ~0u,
+  0,
+  7,
+  8,
+  9,
+  10,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::quadtree::RegionSnapshot, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::RegionSnapshot, _impl_.mortondeltas_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::RegionSnapshot, _impl_.versions_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::RegionSnapshot, _impl_.chunkcounts_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::quadtree::AggregatedSyncResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::AggregatedSyncResponse, _impl_.responses_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::AggregatedSyncResponse, _impl_.omitted_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeSyncResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeSyncResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeSyncResponse, _impl_.subtree_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::SubtreeSyncResponse, _impl_.response_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::quadtree::ChunkData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::ChunkData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::quadtree::ChunkData, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::ChunkData, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::quadtree::ChunkData, _impl_.data_),
+  0,
+  1,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 19, -1, sizeof(::quadtree::SyncResponse)},
+  { 32, -1, -1, sizeof(::quadtree::RegionSnapshot)},
+  { 41, -1, -1, sizeof(::quadtree::AggregatedSyncResponse)},
+  { 49, 57, -1, sizeof(::quadtree::SubtreeSyncResponse)},
+  { 59, 68, -1, sizeof(::quadtree::ChunkData)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::quadtree::_SyncResponse_default_instance_._instance,
+  &::quadtree::_RegionSnapshot_default_instance_._instance,
+  &::quadtree::_AggregatedSyncResponse_default_instance_._instance,
+  &::quadtree::_SubtreeSyncResponse_default_instance_._instance,
+  &::quadtree::_ChunkData_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_SyncResponse_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022SyncResponse.proto\022\010quadtree\"\272\002\n\014SyncR"
+  "esponse\022\021\n\thashKnown\030\001 \002(\010\022\021\n\tchunkData\030"
+  "\002 \002(\010\022\017\n\007curHash\030\003 \002(\004\022\030\n\020lastPublishEve"
+  "nt\030\007 \002(\003\022#\n\006chunks\030\004 \003(\0132\023.quadtree.Chun"
+  "kData\022\021\n\ttreeLevel\030\005 \001(\r\022\022\n\nhashValues\030\006"
+  " \003(\004\022\020\n\010manifest\030\010 \001(\t\022\022\n\nhashOffset\030\t \001"
+  "(\r\022\020\n\010hashBits\030\n \001(\r\022\020\n\010revision\030\013 \001(\004\022\027"
+  "\n\017subtreeRevision\030\014 \001(\004\022*\n\010snapshot\030\r \001("
+  "\0132\030.quadtree.RegionSnapshot\"Y\n\016RegionSna"
+  "pshot\022\030\n\014mortonDeltas\030\001 \003(\004B\002\020\001\022\024\n\010versi"
+  "ons\030\002 \003(\004B\002\020\001\022\027\n\013chunkCounts\030\003 \003(\rB\002\020\001\"["
+  "\n\026AggregatedSyncResponse\0220\n\tresponses\030\001 "
+  "\003(\0132\035.quadtree.SubtreeSyncResponse\022\017\n\007om"
+  "itted\030\002 \003(\t\"P\n\023SubtreeSyncResponse\022\017\n\007su"
+  "btree\030\001 \002(\t\022(\n\010response\030\002 \002(\0132\026.quadtree"
+  ".SyncResponse\"/\n\tChunkData\022\t\n\001x\030\001 \002(\004\022\t\n"
+  "\001y\030\002 \002(\004\022\014\n\004data\030\003 \002(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_SyncResponse_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_SyncResponse_2eproto = {
+    false, false, 662, descriptor_table_protodef_SyncResponse_2eproto,
+    "SyncResponse.proto",
+    &descriptor_table_SyncResponse_2eproto_once, nullptr, 0, 5,
+    schemas, file_default_instances, TableStruct_SyncResponse_2eproto::offsets,
+    file_level_metadata_SyncResponse_2eproto, file_level_enum_descriptors_SyncResponse_2eproto,
+    file_level_service_descriptors_SyncResponse_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_SyncResponse_2eproto_getter() {
+  return &descriptor_table_SyncResponse_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_SyncResponse_2eproto(&descriptor_table_SyncResponse_2eproto);
+namespace quadtree {
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SyncResponse::kHashKnownFieldNumber;
-const int SyncResponse::kChunkDataFieldNumber;
-const int SyncResponse::kCurHashFieldNumber;
-const int SyncResponse::kLastPublishEventFieldNumber;
-const int SyncResponse::kChunksFieldNumber;
-const int SyncResponse::kTreeLevelFieldNumber;
-const int SyncResponse::kHashValuesFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SyncResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SyncResponse>()._impl_._has_bits_);
+  static void set_has_hashknown(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_chunkdata(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_curhash(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_lastpublishevent(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_treelevel(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_manifest(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_hashoffset(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_hashbits(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_revision(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_subtreerevision(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::quadtree::RegionSnapshot& snapshot(const SyncResponse* msg);
+  static void set_has_snapshot(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000006c) ^ 0x0000006c) != 0;
+  }
+};
 
-SyncResponse::SyncResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:quadtree.SyncResponse)
+const ::quadtree::RegionSnapshot&
+SyncResponse::_Internal::snapshot(const SyncResponse* msg) {
+  return *msg->_impl_.snapshot_;
 }
-
-void SyncResponse::InitAsDefaultInstance() {
+SyncResponse::SyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.SyncResponse)
 }
-
 SyncResponse::SyncResponse(const SyncResponse& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.chunks_){from._impl_.chunks_}
+    , decltype(_impl_.hashvalues_){from._impl_.hashvalues_}
+    , decltype(_impl_.manifest_){}
+    , decltype(_impl_.snapshot_){nullptr}
+    , decltype(_impl_.hashknown_){}
+    , decltype(_impl_.chunkdata_){}
+    , decltype(_impl_.treelevel_){}
+    , decltype(_impl_.curhash_){}
+    , decltype(_impl_.lastpublishevent_){}
+    , decltype(_impl_.hashoffset_){}
+    , decltype(_impl_.hashbits_){}
+    , decltype(_impl_.revision_){}
+    , decltype(_impl_.subtreerevision_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.manifest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.manifest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_manifest()) {
+    _this->_impl_.manifest_.Set(from._internal_manifest(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_snapshot()) {
+    _this->_impl_.snapshot_ = new ::quadtree::RegionSnapshot(*from._impl_.snapshot_);
+  }
+  ::memcpy(&_impl_.hashknown_, &from._impl_.hashknown_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.subtreerevision_) -
+    reinterpret_cast<char*>(&_impl_.hashknown_)) + sizeof(_impl_.subtreerevision_));
   // @@protoc_insertion_point(copy_constructor:quadtree.SyncResponse)
 }
 
-void SyncResponse::SharedCtor() {
-  _cached_size_ = 0;
-  hashknown_ = false;
-  chunkdata_ = false;
-  curhash_ = GOOGLE_ULONGLONG(0);
-  lastpublishevent_ = GOOGLE_LONGLONG(0);
-  treelevel_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void SyncResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.chunks_){arena}
+    , decltype(_impl_.hashvalues_){arena}
+    , decltype(_impl_.manifest_){}
+    , decltype(_impl_.snapshot_){nullptr}
+    , decltype(_impl_.hashknown_){false}
+    , decltype(_impl_.chunkdata_){false}
+    , decltype(_impl_.treelevel_){0u}
+    , decltype(_impl_.curhash_){uint64_t{0u}}
+    , decltype(_impl_.lastpublishevent_){int64_t{0}}
+    , decltype(_impl_.hashoffset_){0u}
+    , decltype(_impl_.hashbits_){0u}
+    , decltype(_impl_.revision_){uint64_t{0u}}
+    , decltype(_impl_.subtreerevision_){uint64_t{0u}}
+  };
+  _impl_.manifest_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.manifest_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SyncResponse::~SyncResponse() {
   // @@protoc_insertion_point(destructor:quadtree.SyncResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SyncResponse::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void SyncResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.chunks_.~RepeatedPtrField();
+  _impl_.hashvalues_.~RepeatedField();
+  _impl_.manifest_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.snapshot_;
 }
 
 void SyncResponse::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SyncResponse::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SyncResponse_descriptor_;
+  _impl_._cached_size_.Set(size);
 }
 
-const SyncResponse& SyncResponse::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_SyncResponse_2eproto();
-  return *default_instance_;
-}
-
-SyncResponse* SyncResponse::default_instance_ = NULL;
-
-SyncResponse* SyncResponse::New(::google::protobuf::Arena* arena) const {
-  SyncResponse* n = new SyncResponse;
-  if (arena != NULL) {
-    arena->Own(n);
+void SyncResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.SyncResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.chunks_.Clear();
+  _impl_.hashvalues_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.manifest_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.snapshot_ != nullptr);
+      _impl_.snapshot_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.hashknown_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.hashoffset_) -
+        reinterpret_cast<char*>(&_impl_.hashknown_)) + sizeof(_impl_.hashoffset_));
   }
-  return n;
+  if (cached_has_bits & 0x00000700u) {
+    ::memset(&_impl_.hashbits_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.subtreerevision_) -
+        reinterpret_cast<char*>(&_impl_.hashbits_)) + sizeof(_impl_.subtreerevision_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SyncResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:quadtree.SyncResponse)
-#if defined(__clang__)
-#define ZR_HELPER_(f) \
-  _Pragma("clang diagnostic push") \
-  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
-  __builtin_offsetof(SyncResponse, f) \
-  _Pragma("clang diagnostic pop")
-#else
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<SyncResponse*>(16)->f)
-#endif
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  if (_has_bits_[0 / 32] & 47u) {
-    ZR_(curhash_, lastpublishevent_);
-  }
-
-#undef ZR_HELPER_
-#undef ZR_
-
-  chunks_.Clear();
-  hashvalues_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool SyncResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:quadtree.SyncResponse)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SyncResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required bool hashKnown = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &hashknown_)));
-          set_has_hashknown();
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_hashknown(&has_bits);
+          _impl_.hashknown_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_chunkData;
-        break;
-      }
-
+        continue;
       // required bool chunkData = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_chunkData:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &chunkdata_)));
-          set_has_chunkdata();
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_chunkdata(&has_bits);
+          _impl_.chunkdata_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_curHash;
-        break;
-      }
-
+        continue;
       // required uint64 curHash = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_curHash:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &curhash_)));
-          set_has_curhash();
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_curhash(&has_bits);
+          _impl_.curhash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(34)) goto parse_chunks;
-        break;
-      }
-
+        continue;
       // repeated .quadtree.ChunkData chunks = 4;
-      case 4: {
-        if (tag == 34) {
-         parse_chunks:
-          DO_(input->IncrementRecursionDepth());
-         parse_loop_chunks:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
-                input, add_chunks()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_chunks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(34)) goto parse_loop_chunks;
-        input->UnsafeDecrementRecursionDepth();
-        if (input->ExpectTag(40)) goto parse_treeLevel;
-        break;
-      }
-
+        continue;
       // optional uint32 treeLevel = 5;
-      case 5: {
-        if (tag == 40) {
-         parse_treeLevel:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &treelevel_)));
-          set_has_treelevel();
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_treelevel(&has_bits);
+          _impl_.treelevel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(48)) goto parse_hashValues;
-        break;
-      }
-
+        continue;
       // repeated uint64 hashValues = 6;
-      case 6: {
-        if (tag == 48) {
-         parse_hashValues:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 1, 48, input, this->mutable_hashvalues())));
-        } else if (tag == 50) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, this->mutable_hashvalues())));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_hashvalues(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_hashvalues(), ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(48)) goto parse_hashValues;
-        if (input->ExpectTag(56)) goto parse_lastPublishEvent;
-        break;
-      }
-
+        continue;
       // required int64 lastPublishEvent = 7;
-      case 7: {
-        if (tag == 56) {
-         parse_lastPublishEvent:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &lastpublishevent_)));
-          set_has_lastpublishevent();
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_lastpublishevent(&has_bits);
+          _impl_.lastpublishevent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string manifest = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_manifest();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "quadtree.SyncResponse.manifest");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 hashOffset = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_hashoffset(&has_bits);
+          _impl_.hashoffset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 hashBits = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_hashbits(&has_bits);
+          _impl_.hashbits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 revision = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_revision(&has_bits);
+          _impl_.revision_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 subtreeRevision = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_subtreerevision(&has_bits);
+          _impl_.subtreerevision_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // optional .quadtree.RegionSnapshot snapshot = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_snapshot(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:quadtree.SyncResponse)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:quadtree.SyncResponse)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SyncResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:quadtree.SyncResponse)
+uint8_t* SyncResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:quadtree.SyncResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required bool hashKnown = 1;
-  if (has_hashknown()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->hashknown(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_hashknown(), target);
   }
 
   // required bool chunkData = 2;
-  if (has_chunkdata()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(2, this->chunkdata(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_chunkdata(), target);
   }
 
   // required uint64 curHash = 3;
-  if (has_curhash()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->curhash(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_curhash(), target);
   }
 
   // repeated .quadtree.ChunkData chunks = 4;
-  for (unsigned int i = 0, n = this->chunks_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->chunks(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_chunks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_chunks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional uint32 treeLevel = 5;
-  if (has_treelevel()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->treelevel(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_treelevel(), target);
   }
 
   // repeated uint64 hashValues = 6;
-  for (int i = 0; i < this->hashvalues_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(
-      6, this->hashvalues(i), output);
+  for (int i = 0, n = this->_internal_hashvalues_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_hashvalues(i), target);
   }
 
   // required int64 lastPublishEvent = 7;
-  if (has_lastpublishevent()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(7, this->lastpublishevent(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_lastpublishevent(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional string manifest = 8;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_manifest().data(), static_cast<int>(this->_internal_manifest().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "quadtree.SyncResponse.manifest");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_manifest(), target);
   }
-  // @@protoc_insertion_point(serialize_end:quadtree.SyncResponse)
-}
 
-::google::protobuf::uint8* SyncResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:quadtree.SyncResponse)
-  // required bool hashKnown = 1;
-  if (has_hashknown()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->hashknown(), target);
+  // optional uint32 hashOffset = 9;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_hashoffset(), target);
   }
 
-  // required bool chunkData = 2;
-  if (has_chunkdata()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(2, this->chunkdata(), target);
+  // optional uint32 hashBits = 10;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_hashbits(), target);
   }
 
-  // required uint64 curHash = 3;
-  if (has_curhash()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->curhash(), target);
+  // optional uint64 revision = 11;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(11, this->_internal_revision(), target);
   }
 
-  // repeated .quadtree.ChunkData chunks = 4;
-  for (unsigned int i = 0, n = this->chunks_size(); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        4, this->chunks(i), false, target);
+  // optional uint64 subtreeRevision = 12;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(12, this->_internal_subtreerevision(), target);
   }
 
-  // optional uint32 treeLevel = 5;
-  if (has_treelevel()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->treelevel(), target);
+  // optional .quadtree.RegionSnapshot snapshot = 13;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::snapshot(this),
+        _Internal::snapshot(this).GetCachedSize(), target, stream);
   }
 
-  // repeated uint64 hashValues = 6;
-  for (int i = 0; i < this->hashvalues_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt64ToArray(6, this->hashvalues(i), target);
-  }
-
-  // required int64 lastPublishEvent = 7;
-  if (has_lastpublishevent()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(7, this->lastpublishevent(), target);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:quadtree.SyncResponse)
   return target;
 }
 
-int SyncResponse::RequiredFieldsByteSizeFallback() const {
+size_t SyncResponse::RequiredFieldsByteSizeFallback() const {
 // @@protoc_insertion_point(required_fields_byte_size_fallback_start:quadtree.SyncResponse)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (has_hashknown()) {
+  if (_internal_has_hashknown()) {
     // required bool hashKnown = 1;
     total_size += 1 + 1;
   }
 
-  if (has_chunkdata()) {
+  if (_internal_has_chunkdata()) {
     // required bool chunkData = 2;
     total_size += 1 + 1;
   }
 
-  if (has_curhash()) {
+  if (_internal_has_curhash()) {
     // required uint64 curHash = 3;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->curhash());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_curhash());
   }
 
-  if (has_lastpublishevent()) {
+  if (_internal_has_lastpublishevent()) {
     // required int64 lastPublishEvent = 7;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->lastpublishevent());
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_lastpublishevent());
   }
 
   return total_size;
 }
-int SyncResponse::ByteSize() const {
+size_t SyncResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:quadtree.SyncResponse)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+  if (((_impl_._has_bits_[0] & 0x0000006c) ^ 0x0000006c) == 0) {  // All required fields are present.
     // required bool hashKnown = 1;
     total_size += 1 + 1;
 
@@ -522,105 +711,140 @@ int SyncResponse::ByteSize() const {
     total_size += 1 + 1;
 
     // required uint64 curHash = 3;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->curhash());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_curhash());
 
     // required int64 lastPublishEvent = 7;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->lastpublishevent());
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_lastpublishevent());
 
   } else {
     total_size += RequiredFieldsByteSizeFallback();
   }
-  // optional uint32 treeLevel = 5;
-  if (has_treelevel()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->treelevel());
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .quadtree.ChunkData chunks = 4;
-  total_size += 1 * this->chunks_size();
-  for (int i = 0; i < this->chunks_size(); i++) {
+  total_size += 1UL * this->_internal_chunks_size();
+  for (const auto& msg : this->_impl_.chunks_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->chunks(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated uint64 hashValues = 6;
   {
-    int data_size = 0;
-    for (int i = 0; i < this->hashvalues_size(); i++) {
-      data_size += ::google::protobuf::internal::WireFormatLite::
-        UInt64Size(this->hashvalues(i));
-    }
-    total_size += 1 * this->hashvalues_size() + data_size;
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.hashvalues_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_hashvalues_size());
+    total_size += data_size;
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string manifest = 8;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_manifest());
+    }
+
+    // optional .quadtree.RegionSnapshot snapshot = 13;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.snapshot_);
+    }
 
-void SyncResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:quadtree.SyncResponse)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  const SyncResponse* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const SyncResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:quadtree.SyncResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:quadtree.SyncResponse)
-    MergeFrom(*source);
+  // optional uint32 treeLevel = 5;
+  if (cached_has_bits & 0x00000010u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_treelevel());
   }
-}
 
-void SyncResponse::MergeFrom(const SyncResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:quadtree.SyncResponse)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  // optional uint32 hashOffset = 9;
+  if (cached_has_bits & 0x00000080u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_hashoffset());
   }
-  chunks_.MergeFrom(from.chunks_);
-  hashvalues_.MergeFrom(from.hashvalues_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_hashknown()) {
-      set_hashknown(from.hashknown());
+
+  if (cached_has_bits & 0x00000700u) {
+    // optional uint32 hashBits = 10;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_hashbits());
     }
-    if (from.has_chunkdata()) {
-      set_chunkdata(from.chunkdata());
+
+    // optional uint64 revision = 11;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_revision());
     }
-    if (from.has_curhash()) {
-      set_curhash(from.curhash());
+
+    // optional uint64 subtreeRevision = 12;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_subtreerevision());
     }
-    if (from.has_lastpublishevent()) {
-      set_lastpublishevent(from.lastpublishevent());
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncResponse::GetClassData() const { return &_class_data_; }
+
+
+void SyncResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncResponse*>(&to_msg);
+  auto& from = static_cast<const SyncResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.SyncResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.chunks_.MergeFrom(from._impl_.chunks_);
+  _this->_impl_.hashvalues_.MergeFrom(from._impl_.hashvalues_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_manifest(from._internal_manifest());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_snapshot()->::quadtree::RegionSnapshot::MergeFrom(
+          from._internal_snapshot());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.hashknown_ = from._impl_.hashknown_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.chunkdata_ = from._impl_.chunkdata_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.treelevel_ = from._impl_.treelevel_;
     }
-    if (from.has_treelevel()) {
-      set_treelevel(from.treelevel());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.curhash_ = from._impl_.curhash_;
     }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.lastpublishevent_ = from._impl_.lastpublishevent_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.hashoffset_ = from._impl_.hashoffset_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.hashbits_ = from._impl_.hashbits_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.revision_ = from._impl_.revision_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.subtreerevision_ = from._impl_.subtreerevision_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-}
-
-void SyncResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:quadtree.SyncResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SyncResponse::CopyFrom(const SyncResponse& from) {
@@ -631,550 +855,1092 @@ void SyncResponse::CopyFrom(const SyncResponse& from) {
 }
 
 bool SyncResponse::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
-
-  if (!::google::protobuf::internal::AllAreInitialized(this->chunks())) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.chunks_))
+    return false;
   return true;
 }
 
-void SyncResponse::Swap(SyncResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SyncResponse::InternalSwap(SyncResponse* other) {
-  std::swap(hashknown_, other->hashknown_);
-  std::swap(chunkdata_, other->chunkdata_);
-  std::swap(curhash_, other->curhash_);
-  std::swap(lastpublishevent_, other->lastpublishevent_);
-  chunks_.UnsafeArenaSwap(&other->chunks_);
-  std::swap(treelevel_, other->treelevel_);
-  hashvalues_.UnsafeArenaSwap(&other->hashvalues_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.chunks_.InternalSwap(&other->_impl_.chunks_);
+  _impl_.hashvalues_.InternalSwap(&other->_impl_.hashvalues_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.manifest_, lhs_arena,
+      &other->_impl_.manifest_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncResponse, _impl_.subtreerevision_)
+      + sizeof(SyncResponse::_impl_.subtreerevision_)
+      - PROTOBUF_FIELD_OFFSET(SyncResponse, _impl_.snapshot_)>(
+          reinterpret_cast<char*>(&_impl_.snapshot_),
+          reinterpret_cast<char*>(&other->_impl_.snapshot_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SyncResponse_2eproto_getter, &descriptor_table_SyncResponse_2eproto_once,
+      file_level_metadata_SyncResponse_2eproto[0]);
 }
 
-::google::protobuf::Metadata SyncResponse::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SyncResponse_descriptor_;
-  metadata.reflection = SyncResponse_reflection_;
-  return metadata;
-}
-
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// SyncResponse
+// ===================================================================
 
-// required bool hashKnown = 1;
-bool SyncResponse::has_hashknown() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-void SyncResponse::set_has_hashknown() {
-  _has_bits_[0] |= 0x00000001u;
-}
-void SyncResponse::clear_has_hashknown() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-void SyncResponse::clear_hashknown() {
-  hashknown_ = false;
-  clear_has_hashknown();
-}
- bool SyncResponse::hashknown() const {
-  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.hashKnown)
-  return hashknown_;
-}
- void SyncResponse::set_hashknown(bool value) {
-  set_has_hashknown();
-  hashknown_ = value;
-  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.hashKnown)
+class RegionSnapshot::_Internal {
+ public:
+};
+
+RegionSnapshot::RegionSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.RegionSnapshot)
+}
+RegionSnapshot::RegionSnapshot(const RegionSnapshot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RegionSnapshot* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mortondeltas_){from._impl_.mortondeltas_}
+    , /*decltype(_impl_._mortondeltas_cached_byte_size_)*/{0}
+    , decltype(_impl_.versions_){from._impl_.versions_}
+    , /*decltype(_impl_._versions_cached_byte_size_)*/{0}
+    , decltype(_impl_.chunkcounts_){from._impl_.chunkcounts_}
+    , /*decltype(_impl_._chunkcounts_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:quadtree.RegionSnapshot)
+}
+
+inline void RegionSnapshot::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mortondeltas_){arena}
+    , /*decltype(_impl_._mortondeltas_cached_byte_size_)*/{0}
+    , decltype(_impl_.versions_){arena}
+    , /*decltype(_impl_._versions_cached_byte_size_)*/{0}
+    , decltype(_impl_.chunkcounts_){arena}
+    , /*decltype(_impl_._chunkcounts_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-// required bool chunkData = 2;
-bool SyncResponse::has_chunkdata() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-void SyncResponse::set_has_chunkdata() {
-  _has_bits_[0] |= 0x00000002u;
-}
-void SyncResponse::clear_has_chunkdata() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-void SyncResponse::clear_chunkdata() {
-  chunkdata_ = false;
-  clear_has_chunkdata();
-}
- bool SyncResponse::chunkdata() const {
-  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.chunkData)
-  return chunkdata_;
-}
- void SyncResponse::set_chunkdata(bool value) {
-  set_has_chunkdata();
-  chunkdata_ = value;
-  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.chunkData)
+RegionSnapshot::~RegionSnapshot() {
+  // @@protoc_insertion_point(destructor:quadtree.RegionSnapshot)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-// required uint64 curHash = 3;
-bool SyncResponse::has_curhash() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-void SyncResponse::set_has_curhash() {
-  _has_bits_[0] |= 0x00000004u;
-}
-void SyncResponse::clear_has_curhash() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-void SyncResponse::clear_curhash() {
-  curhash_ = GOOGLE_ULONGLONG(0);
-  clear_has_curhash();
-}
- ::google::protobuf::uint64 SyncResponse::curhash() const {
-  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.curHash)
-  return curhash_;
+inline void RegionSnapshot::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.mortondeltas_.~RepeatedField();
+  _impl_.versions_.~RepeatedField();
+  _impl_.chunkcounts_.~RepeatedField();
+}
+
+void RegionSnapshot::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RegionSnapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.RegionSnapshot)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.mortondeltas_.Clear();
+  _impl_.versions_.Clear();
+  _impl_.chunkcounts_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RegionSnapshot::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint64 mortonDeltas = 1 [packed = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_mortondeltas(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_mortondeltas(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 versions = 2 [packed = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_versions(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_versions(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 chunkCounts = 3 [packed = true];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_chunkcounts(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_chunkcounts(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
- void SyncResponse::set_curhash(::google::protobuf::uint64 value) {
-  set_has_curhash();
-  curhash_ = value;
-  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.curHash)
+
+uint8_t* RegionSnapshot::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:quadtree.RegionSnapshot)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint64 mortonDeltas = 1 [packed = true];
+  {
+    int byte_size = _impl_._mortondeltas_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          1, _internal_mortondeltas(), byte_size, target);
+    }
+  }
+
+  // repeated uint64 versions = 2 [packed = true];
+  {
+    int byte_size = _impl_._versions_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          2, _internal_versions(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 chunkCounts = 3 [packed = true];
+  {
+    int byte_size = _impl_._chunkcounts_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_chunkcounts(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:quadtree.RegionSnapshot)
+  return target;
 }
 
-// required int64 lastPublishEvent = 7;
-bool SyncResponse::has_lastpublishevent() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+size_t RegionSnapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:quadtree.RegionSnapshot)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 mortonDeltas = 1 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.mortondeltas_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._mortondeltas_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint64 versions = 2 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.versions_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._versions_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 chunkCounts = 3 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.chunkcounts_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._chunkcounts_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
-void SyncResponse::set_has_lastpublishevent() {
-  _has_bits_[0] |= 0x00000008u;
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RegionSnapshot::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RegionSnapshot::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RegionSnapshot::GetClassData() const { return &_class_data_; }
+
+
+void RegionSnapshot::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RegionSnapshot*>(&to_msg);
+  auto& from = static_cast<const RegionSnapshot&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.RegionSnapshot)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.mortondeltas_.MergeFrom(from._impl_.mortondeltas_);
+  _this->_impl_.versions_.MergeFrom(from._impl_.versions_);
+  _this->_impl_.chunkcounts_.MergeFrom(from._impl_.chunkcounts_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-void SyncResponse::clear_has_lastpublishevent() {
-  _has_bits_[0] &= ~0x00000008u;
+
+void RegionSnapshot::CopyFrom(const RegionSnapshot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:quadtree.RegionSnapshot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-void SyncResponse::clear_lastpublishevent() {
-  lastpublishevent_ = GOOGLE_LONGLONG(0);
-  clear_has_lastpublishevent();
+
+bool RegionSnapshot::IsInitialized() const {
+  return true;
 }
- ::google::protobuf::int64 SyncResponse::lastpublishevent() const {
-  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.lastPublishEvent)
-  return lastpublishevent_;
+
+void RegionSnapshot::InternalSwap(RegionSnapshot* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.mortondeltas_.InternalSwap(&other->_impl_.mortondeltas_);
+  _impl_.versions_.InternalSwap(&other->_impl_.versions_);
+  _impl_.chunkcounts_.InternalSwap(&other->_impl_.chunkcounts_);
 }
- void SyncResponse::set_lastpublishevent(::google::protobuf::int64 value) {
-  set_has_lastpublishevent();
-  lastpublishevent_ = value;
-  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.lastPublishEvent)
+
+::PROTOBUF_NAMESPACE_ID::Metadata RegionSnapshot::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SyncResponse_2eproto_getter, &descriptor_table_SyncResponse_2eproto_once,
+      file_level_metadata_SyncResponse_2eproto[1]);
 }
 
-// repeated .quadtree.ChunkData chunks = 4;
-int SyncResponse::chunks_size() const {
-  return chunks_.size();
+// ===================================================================
+
+class AggregatedSyncResponse::_Internal {
+ public:
+};
+
+AggregatedSyncResponse::AggregatedSyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.AggregatedSyncResponse)
+}
+AggregatedSyncResponse::AggregatedSyncResponse(const AggregatedSyncResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AggregatedSyncResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.responses_){from._impl_.responses_}
+    , decltype(_impl_.omitted_){from._impl_.omitted_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:quadtree.AggregatedSyncResponse)
+}
+
+inline void AggregatedSyncResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.responses_){arena}
+    , decltype(_impl_.omitted_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
-void SyncResponse::clear_chunks() {
-  chunks_.Clear();
+
+AggregatedSyncResponse::~AggregatedSyncResponse() {
+  // @@protoc_insertion_point(destructor:quadtree.AggregatedSyncResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-const ::quadtree::ChunkData& SyncResponse::chunks(int index) const {
-  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.chunks)
-  return chunks_.Get(index);
+
+inline void AggregatedSyncResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.responses_.~RepeatedPtrField();
+  _impl_.omitted_.~RepeatedPtrField();
+}
+
+void AggregatedSyncResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AggregatedSyncResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.AggregatedSyncResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.responses_.Clear();
+  _impl_.omitted_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AggregatedSyncResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .quadtree.SubtreeSyncResponse responses = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_responses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string omitted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_omitted();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "quadtree.AggregatedSyncResponse.omitted");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AggregatedSyncResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:quadtree.AggregatedSyncResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .quadtree.SubtreeSyncResponse responses = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_responses_size()); i < n; i++) {
+    const auto& repfield = this->_internal_responses(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated string omitted = 2;
+  for (int i = 0, n = this->_internal_omitted_size(); i < n; i++) {
+    const auto& s = this->_internal_omitted(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "quadtree.AggregatedSyncResponse.omitted");
+    target = stream->WriteString(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:quadtree.AggregatedSyncResponse)
+  return target;
 }
-::quadtree::ChunkData* SyncResponse::mutable_chunks(int index) {
-  // @@protoc_insertion_point(field_mutable:quadtree.SyncResponse.chunks)
-  return chunks_.Mutable(index);
+
+size_t AggregatedSyncResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:quadtree.AggregatedSyncResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .quadtree.SubtreeSyncResponse responses = 1;
+  total_size += 1UL * this->_internal_responses_size();
+  for (const auto& msg : this->_impl_.responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string omitted = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.omitted_.size());
+  for (int i = 0, n = _impl_.omitted_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.omitted_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
-::quadtree::ChunkData* SyncResponse::add_chunks() {
-  // @@protoc_insertion_point(field_add:quadtree.SyncResponse.chunks)
-  return chunks_.Add();
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AggregatedSyncResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AggregatedSyncResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AggregatedSyncResponse::GetClassData() const { return &_class_data_; }
+
+
+void AggregatedSyncResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AggregatedSyncResponse*>(&to_msg);
+  auto& from = static_cast<const AggregatedSyncResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.AggregatedSyncResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.responses_.MergeFrom(from._impl_.responses_);
+  _this->_impl_.omitted_.MergeFrom(from._impl_.omitted_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-::google::protobuf::RepeatedPtrField< ::quadtree::ChunkData >*
-SyncResponse::mutable_chunks() {
-  // @@protoc_insertion_point(field_mutable_list:quadtree.SyncResponse.chunks)
-  return &chunks_;
+
+void AggregatedSyncResponse::CopyFrom(const AggregatedSyncResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:quadtree.AggregatedSyncResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-const ::google::protobuf::RepeatedPtrField< ::quadtree::ChunkData >&
-SyncResponse::chunks() const {
-  // @@protoc_insertion_point(field_list:quadtree.SyncResponse.chunks)
-  return chunks_;
+
+bool AggregatedSyncResponse::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.responses_))
+    return false;
+  return true;
 }
 
-// optional uint32 treeLevel = 5;
-bool SyncResponse::has_treelevel() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+void AggregatedSyncResponse::InternalSwap(AggregatedSyncResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.responses_.InternalSwap(&other->_impl_.responses_);
+  _impl_.omitted_.InternalSwap(&other->_impl_.omitted_);
 }
-void SyncResponse::set_has_treelevel() {
-  _has_bits_[0] |= 0x00000020u;
+
+::PROTOBUF_NAMESPACE_ID::Metadata AggregatedSyncResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SyncResponse_2eproto_getter, &descriptor_table_SyncResponse_2eproto_once,
+      file_level_metadata_SyncResponse_2eproto[2]);
 }
-void SyncResponse::clear_has_treelevel() {
-  _has_bits_[0] &= ~0x00000020u;
+
+// ===================================================================
+
+class SubtreeSyncResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubtreeSyncResponse>()._impl_._has_bits_);
+  static void set_has_subtree(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::quadtree::SyncResponse& response(const SubtreeSyncResponse* msg);
+  static void set_has_response(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+const ::quadtree::SyncResponse&
+SubtreeSyncResponse::_Internal::response(const SubtreeSyncResponse* msg) {
+  return *msg->_impl_.response_;
+}
+SubtreeSyncResponse::SubtreeSyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.SubtreeSyncResponse)
+}
+SubtreeSyncResponse::SubtreeSyncResponse(const SubtreeSyncResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SubtreeSyncResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.subtree_){}
+    , decltype(_impl_.response_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.subtree_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.subtree_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_subtree()) {
+    _this->_impl_.subtree_.Set(from._internal_subtree(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_response()) {
+    _this->_impl_.response_ = new ::quadtree::SyncResponse(*from._impl_.response_);
+  }
+  // @@protoc_insertion_point(copy_constructor:quadtree.SubtreeSyncResponse)
+}
+
+inline void SubtreeSyncResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.subtree_){}
+    , decltype(_impl_.response_){nullptr}
+  };
+  _impl_.subtree_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.subtree_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
-void SyncResponse::clear_treelevel() {
-  treelevel_ = 0u;
-  clear_has_treelevel();
+
+SubtreeSyncResponse::~SubtreeSyncResponse() {
+  // @@protoc_insertion_point(destructor:quadtree.SubtreeSyncResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
- ::google::protobuf::uint32 SyncResponse::treelevel() const {
-  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.treeLevel)
-  return treelevel_;
+
+inline void SubtreeSyncResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.subtree_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.response_;
 }
- void SyncResponse::set_treelevel(::google::protobuf::uint32 value) {
-  set_has_treelevel();
-  treelevel_ = value;
-  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.treeLevel)
+
+void SubtreeSyncResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-// repeated uint64 hashValues = 6;
-int SyncResponse::hashvalues_size() const {
-  return hashvalues_.size();
+void SubtreeSyncResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.SubtreeSyncResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.subtree_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.response_ != nullptr);
+      _impl_.response_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SubtreeSyncResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string subtree = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_subtree();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "quadtree.SubtreeSyncResponse.subtree");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required .quadtree.SyncResponse response = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubtreeSyncResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:quadtree.SubtreeSyncResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string subtree = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_subtree().data(), static_cast<int>(this->_internal_subtree().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "quadtree.SubtreeSyncResponse.subtree");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_subtree(), target);
+  }
+
+  // required .quadtree.SyncResponse response = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::response(this),
+        _Internal::response(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:quadtree.SubtreeSyncResponse)
+  return target;
 }
-void SyncResponse::clear_hashvalues() {
-  hashvalues_.Clear();
+
+size_t SubtreeSyncResponse::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:quadtree.SubtreeSyncResponse)
+  size_t total_size = 0;
+
+  if (_internal_has_subtree()) {
+    // required string subtree = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_subtree());
+  }
+
+  if (_internal_has_response()) {
+    // required .quadtree.SyncResponse response = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.response_);
+  }
+
+  return total_size;
 }
- ::google::protobuf::uint64 SyncResponse::hashvalues(int index) const {
-  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.hashValues)
-  return hashvalues_.Get(index);
+size_t SubtreeSyncResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:quadtree.SubtreeSyncResponse)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string subtree = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_subtree());
+
+    // required .quadtree.SyncResponse response = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.response_);
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
- void SyncResponse::set_hashvalues(int index, ::google::protobuf::uint64 value) {
-  hashvalues_.Set(index, value);
-  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.hashValues)
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubtreeSyncResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SubtreeSyncResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubtreeSyncResponse::GetClassData() const { return &_class_data_; }
+
+
+void SubtreeSyncResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SubtreeSyncResponse*>(&to_msg);
+  auto& from = static_cast<const SubtreeSyncResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.SubtreeSyncResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_subtree(from._internal_subtree());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_response()->::quadtree::SyncResponse::MergeFrom(
+          from._internal_response());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
- void SyncResponse::add_hashvalues(::google::protobuf::uint64 value) {
-  hashvalues_.Add(value);
-  // @@protoc_insertion_point(field_add:quadtree.SyncResponse.hashValues)
+
+void SubtreeSyncResponse::CopyFrom(const SubtreeSyncResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:quadtree.SubtreeSyncResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
- const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
-SyncResponse::hashvalues() const {
-  // @@protoc_insertion_point(field_list:quadtree.SyncResponse.hashValues)
-  return hashvalues_;
+
+bool SubtreeSyncResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_response()) {
+    if (!_impl_.response_->IsInitialized()) return false;
+  }
+  return true;
 }
- ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
-SyncResponse::mutable_hashvalues() {
-  // @@protoc_insertion_point(field_mutable_list:quadtree.SyncResponse.hashValues)
-  return &hashvalues_;
+
+void SubtreeSyncResponse::InternalSwap(SubtreeSyncResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.subtree_, lhs_arena,
+      &other->_impl_.subtree_, rhs_arena
+  );
+  swap(_impl_.response_, other->_impl_.response_);
 }
 
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+::PROTOBUF_NAMESPACE_ID::Metadata SubtreeSyncResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SyncResponse_2eproto_getter, &descriptor_table_SyncResponse_2eproto_once,
+      file_level_metadata_SyncResponse_2eproto[3]);
+}
 
 // ===================================================================
 
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ChunkData::kXFieldNumber;
-const int ChunkData::kYFieldNumber;
-const int ChunkData::kDataFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-ChunkData::ChunkData()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:quadtree.ChunkData)
-}
+class ChunkData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ChunkData>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
 
-void ChunkData::InitAsDefaultInstance() {
+ChunkData::ChunkData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:quadtree.ChunkData)
 }
-
 ChunkData::ChunkData(const ChunkData& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChunkData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.data_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.data_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.data_));
   // @@protoc_insertion_point(copy_constructor:quadtree.ChunkData)
 }
 
-void ChunkData::SharedCtor() {
-  _cached_size_ = 0;
-  x_ = GOOGLE_ULONGLONG(0);
-  y_ = GOOGLE_ULONGLONG(0);
-  data_ = GOOGLE_ULONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void ChunkData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){uint64_t{0u}}
+    , decltype(_impl_.y_){uint64_t{0u}}
+    , decltype(_impl_.data_){uint64_t{0u}}
+  };
 }
 
 ChunkData::~ChunkData() {
   // @@protoc_insertion_point(destructor:quadtree.ChunkData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ChunkData::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void ChunkData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void ChunkData::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* ChunkData::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return ChunkData_descriptor_;
+  _impl_._cached_size_.Set(size);
 }
 
-const ChunkData& ChunkData::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_SyncResponse_2eproto();
-  return *default_instance_;
-}
-
-ChunkData* ChunkData::default_instance_ = NULL;
-
-ChunkData* ChunkData::New(::google::protobuf::Arena* arena) const {
-  ChunkData* n = new ChunkData;
-  if (arena != NULL) {
-    arena->Own(n);
+void ChunkData::Clear() {
+// @@protoc_insertion_point(message_clear_start:quadtree.ChunkData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.data_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.data_));
   }
-  return n;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ChunkData::Clear() {
-// @@protoc_insertion_point(message_clear_start:quadtree.ChunkData)
-#if defined(__clang__)
-#define ZR_HELPER_(f) \
-  _Pragma("clang diagnostic push") \
-  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
-  __builtin_offsetof(ChunkData, f) \
-  _Pragma("clang diagnostic pop")
-#else
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<ChunkData*>(16)->f)
-#endif
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(x_, data_);
-
-#undef ZR_HELPER_
-#undef ZR_
-
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  if (_internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->Clear();
-  }
-}
-
-bool ChunkData::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:quadtree.ChunkData)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* ChunkData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required uint64 x = 1;
-      case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &x_)));
-          set_has_x();
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_y;
-        break;
-      }
-
+        continue;
       // required uint64 y = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_y:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &y_)));
-          set_has_y();
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_data;
-        break;
-      }
-
+        continue;
       // required uint64 data = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_data:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &data_)));
-          set_has_data();
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_data(&has_bits);
+          _impl_.data_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        if (input->ExpectAtEnd()) goto success;
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0 ||
-            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:quadtree.ChunkData)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:quadtree.ChunkData)
-  return false;
-#undef DO_
-}
-
-void ChunkData::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:quadtree.ChunkData)
-  // required uint64 x = 1;
-  if (has_x()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->x(), output);
-  }
-
-  // required uint64 y = 2;
-  if (has_y()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(2, this->y(), output);
-  }
-
-  // required uint64 data = 3;
-  if (has_data()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->data(), output);
-  }
-
-  if (_internal_metadata_.have_unknown_fields()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-  // @@protoc_insertion_point(serialize_end:quadtree.ChunkData)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* ChunkData::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
+uint8_t* ChunkData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:quadtree.ChunkData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint64 x = 1;
-  if (has_x()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->x(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_x(), target);
   }
 
   // required uint64 y = 2;
-  if (has_y()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(2, this->y(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_y(), target);
   }
 
   // required uint64 data = 3;
-  if (has_data()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->data(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_data(), target);
   }
 
-  if (_internal_metadata_.have_unknown_fields()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:quadtree.ChunkData)
   return target;
 }
 
-int ChunkData::RequiredFieldsByteSizeFallback() const {
+size_t ChunkData::RequiredFieldsByteSizeFallback() const {
 // @@protoc_insertion_point(required_fields_byte_size_fallback_start:quadtree.ChunkData)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (has_x()) {
+  if (_internal_has_x()) {
     // required uint64 x = 1;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->x());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_x());
   }
 
-  if (has_y()) {
+  if (_internal_has_y()) {
     // required uint64 y = 2;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->y());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_y());
   }
 
-  if (has_data()) {
+  if (_internal_has_data()) {
     // required uint64 data = 3;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->data());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_data());
   }
 
   return total_size;
 }
-int ChunkData::ByteSize() const {
+size_t ChunkData::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:quadtree.ChunkData)
-  int total_size = 0;
+  size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
     // required uint64 x = 1;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->x());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_x());
 
     // required uint64 y = 2;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->y());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_y());
 
     // required uint64 data = 3;
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->data());
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_data());
 
   } else {
     total_size += RequiredFieldsByteSizeFallback();
   }
-  if (_internal_metadata_.have_unknown_fields()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-void ChunkData::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:quadtree.ChunkData)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  const ChunkData* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const ChunkData>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:quadtree.ChunkData)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:quadtree.ChunkData)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ChunkData::MergeFrom(const ChunkData& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:quadtree.ChunkData)
-  if (GOOGLE_PREDICT_FALSE(&from == this)) {
-    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
-  }
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_x()) {
-      set_x(from.x());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChunkData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChunkData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChunkData::GetClassData() const { return &_class_data_; }
+
+
+void ChunkData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChunkData*>(&to_msg);
+  auto& from = static_cast<const ChunkData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:quadtree.ChunkData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
     }
-    if (from.has_y()) {
-      set_y(from.y());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
     }
-    if (from.has_data()) {
-      set_data(from.data());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.data_ = from._impl_.data_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._internal_metadata_.have_unknown_fields()) {
-    mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-  }
-}
-
-void ChunkData::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:quadtree.ChunkData)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ChunkData::CopyFrom(const ChunkData& from) {
@@ -1185,111 +1951,52 @@ void ChunkData::CopyFrom(const ChunkData& from) {
 }
 
 bool ChunkData::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void ChunkData::Swap(ChunkData* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void ChunkData::InternalSwap(ChunkData* other) {
-  std::swap(x_, other->x_);
-  std::swap(y_, other->y_);
-  std::swap(data_, other->data_);
-  std::swap(_has_bits_[0], other->_has_bits_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  std::swap(_cached_size_, other->_cached_size_);
-}
-
-::google::protobuf::Metadata ChunkData::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ChunkData_descriptor_;
-  metadata.reflection = ChunkData_reflection_;
-  return metadata;
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ChunkData, _impl_.data_)
+      + sizeof(ChunkData::_impl_.data_)
+      - PROTOBUF_FIELD_OFFSET(ChunkData, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-#if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ChunkData
-
-// required uint64 x = 1;
-bool ChunkData::has_x() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-void ChunkData::set_has_x() {
-  _has_bits_[0] |= 0x00000001u;
-}
-void ChunkData::clear_has_x() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-void ChunkData::clear_x() {
-  x_ = GOOGLE_ULONGLONG(0);
-  clear_has_x();
-}
- ::google::protobuf::uint64 ChunkData::x() const {
-  // @@protoc_insertion_point(field_get:quadtree.ChunkData.x)
-  return x_;
-}
- void ChunkData::set_x(::google::protobuf::uint64 value) {
-  set_has_x();
-  x_ = value;
-  // @@protoc_insertion_point(field_set:quadtree.ChunkData.x)
-}
-
-// required uint64 y = 2;
-bool ChunkData::has_y() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-void ChunkData::set_has_y() {
-  _has_bits_[0] |= 0x00000002u;
-}
-void ChunkData::clear_has_y() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-void ChunkData::clear_y() {
-  y_ = GOOGLE_ULONGLONG(0);
-  clear_has_y();
-}
- ::google::protobuf::uint64 ChunkData::y() const {
-  // @@protoc_insertion_point(field_get:quadtree.ChunkData.y)
-  return y_;
-}
- void ChunkData::set_y(::google::protobuf::uint64 value) {
-  set_has_y();
-  y_ = value;
-  // @@protoc_insertion_point(field_set:quadtree.ChunkData.y)
+::PROTOBUF_NAMESPACE_ID::Metadata ChunkData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_SyncResponse_2eproto_getter, &descriptor_table_SyncResponse_2eproto_once,
+      file_level_metadata_SyncResponse_2eproto[4]);
 }
 
-// required uint64 data = 3;
-bool ChunkData::has_data() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-void ChunkData::set_has_data() {
-  _has_bits_[0] |= 0x00000004u;
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace quadtree
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::quadtree::SyncResponse*
+Arena::CreateMaybeMessage< ::quadtree::SyncResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::SyncResponse >(arena);
 }
-void ChunkData::clear_has_data() {
-  _has_bits_[0] &= ~0x00000004u;
+template<> PROTOBUF_NOINLINE ::quadtree::RegionSnapshot*
+Arena::CreateMaybeMessage< ::quadtree::RegionSnapshot >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::RegionSnapshot >(arena);
 }
-void ChunkData::clear_data() {
-  data_ = GOOGLE_ULONGLONG(0);
-  clear_has_data();
+template<> PROTOBUF_NOINLINE ::quadtree::AggregatedSyncResponse*
+Arena::CreateMaybeMessage< ::quadtree::AggregatedSyncResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::AggregatedSyncResponse >(arena);
 }
- ::google::protobuf::uint64 ChunkData::data() const {
-  // @@protoc_insertion_point(field_get:quadtree.ChunkData.data)
-  return data_;
+template<> PROTOBUF_NOINLINE ::quadtree::SubtreeSyncResponse*
+Arena::CreateMaybeMessage< ::quadtree::SubtreeSyncResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::SubtreeSyncResponse >(arena);
 }
- void ChunkData::set_data(::google::protobuf::uint64 value) {
-  set_has_data();
-  data_ = value;
-  // @@protoc_insertion_point(field_set:quadtree.ChunkData.data)
+template<> PROTOBUF_NOINLINE ::quadtree::ChunkData*
+Arena::CreateMaybeMessage< ::quadtree::ChunkData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::quadtree::ChunkData >(arena);
 }
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace quadtree
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,508 +1,2164 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: SyncResponse.proto
 
-#ifndef PROTOBUF_SyncResponse_2eproto__INCLUDED
-#define PROTOBUF_SyncResponse_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_SyncResponse_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_SyncResponse_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_SyncResponse_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_SyncResponse_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_SyncResponse_2eproto;
 namespace quadtree {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_SyncResponse_2eproto();
-void protobuf_AssignDesc_SyncResponse_2eproto();
-void protobuf_ShutdownFile_SyncResponse_2eproto();
-
+class AggregatedSyncResponse;
+struct AggregatedSyncResponseDefaultTypeInternal;
+extern AggregatedSyncResponseDefaultTypeInternal _AggregatedSyncResponse_default_instance_;
 class ChunkData;
+struct ChunkDataDefaultTypeInternal;
+extern ChunkDataDefaultTypeInternal _ChunkData_default_instance_;
+class RegionSnapshot;
+struct RegionSnapshotDefaultTypeInternal;
+extern RegionSnapshotDefaultTypeInternal _RegionSnapshot_default_instance_;
+class SubtreeSyncResponse;
+struct SubtreeSyncResponseDefaultTypeInternal;
+extern SubtreeSyncResponseDefaultTypeInternal _SubtreeSyncResponse_default_instance_;
 class SyncResponse;
+struct SyncResponseDefaultTypeInternal;
+extern SyncResponseDefaultTypeInternal _SyncResponse_default_instance_;
+}  // namespace quadtree
+PROTOBUF_NAMESPACE_OPEN
+template<> ::quadtree::AggregatedSyncResponse* Arena::CreateMaybeMessage<::quadtree::AggregatedSyncResponse>(Arena*);
+template<> ::quadtree::ChunkData* Arena::CreateMaybeMessage<::quadtree::ChunkData>(Arena*);
+template<> ::quadtree::RegionSnapshot* Arena::CreateMaybeMessage<::quadtree::RegionSnapshot>(Arena*);
+template<> ::quadtree::SubtreeSyncResponse* Arena::CreateMaybeMessage<::quadtree::SubtreeSyncResponse>(Arena*);
+template<> ::quadtree::SyncResponse* Arena::CreateMaybeMessage<::quadtree::SyncResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace quadtree {
 
 // ===================================================================
 
-class SyncResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:quadtree.SyncResponse) */ {
+class SyncResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.SyncResponse) */ {
  public:
-  SyncResponse();
-  virtual ~SyncResponse();
+  inline SyncResponse() : SyncResponse(nullptr) {}
+  ~SyncResponse() override;
+  explicit PROTOBUF_CONSTEXPR SyncResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SyncResponse(const SyncResponse& from);
+  SyncResponse(SyncResponse&& from) noexcept
+    : SyncResponse() {
+    *this = ::std::move(from);
+  }
 
   inline SyncResponse& operator=(const SyncResponse& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline SyncResponse& operator=(SyncResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SyncResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncResponse* internal_default_instance() {
+    return reinterpret_cast<const SyncResponse*>(
+               &_SyncResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(SyncResponse* other);
+  friend void swap(SyncResponse& a, SyncResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SyncResponse* New() const { return New(NULL); }
-
-  SyncResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  SyncResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SyncResponse& from);
-  void MergeFrom(const SyncResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncResponse& from) {
+    SyncResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(SyncResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.SyncResponse";
   }
+  protected:
+  explicit SyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kChunksFieldNumber = 4,
+    kHashValuesFieldNumber = 6,
+    kManifestFieldNumber = 8,
+    kSnapshotFieldNumber = 13,
+    kHashKnownFieldNumber = 1,
+    kChunkDataFieldNumber = 2,
+    kTreeLevelFieldNumber = 5,
+    kCurHashFieldNumber = 3,
+    kLastPublishEventFieldNumber = 7,
+    kHashOffsetFieldNumber = 9,
+    kHashBitsFieldNumber = 10,
+    kRevisionFieldNumber = 11,
+    kSubtreeRevisionFieldNumber = 12,
+  };
+  // repeated .quadtree.ChunkData chunks = 4;
+  int chunks_size() const;
+  private:
+  int _internal_chunks_size() const;
+  public:
+  void clear_chunks();
+  ::quadtree::ChunkData* mutable_chunks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::ChunkData >*
+      mutable_chunks();
+  private:
+  const ::quadtree::ChunkData& _internal_chunks(int index) const;
+  ::quadtree::ChunkData* _internal_add_chunks();
+  public:
+  const ::quadtree::ChunkData& chunks(int index) const;
+  ::quadtree::ChunkData* add_chunks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::ChunkData >&
+      chunks() const;
+
+  // repeated uint64 hashValues = 6;
+  int hashvalues_size() const;
+  private:
+  int _internal_hashvalues_size() const;
+  public:
+  void clear_hashvalues();
+  private:
+  uint64_t _internal_hashvalues(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_hashvalues() const;
+  void _internal_add_hashvalues(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_hashvalues();
+  public:
+  uint64_t hashvalues(int index) const;
+  void set_hashvalues(int index, uint64_t value);
+  void add_hashvalues(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      hashvalues() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_hashvalues();
+
+  // optional string manifest = 8;
+  bool has_manifest() const;
+  private:
+  bool _internal_has_manifest() const;
+  public:
+  void clear_manifest();
+  const std::string& manifest() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_manifest(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_manifest();
+  PROTOBUF_NODISCARD std::string* release_manifest();
+  void set_allocated_manifest(std::string* manifest);
+  private:
+  const std::string& _internal_manifest() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_manifest(const std::string& value);
+  std::string* _internal_mutable_manifest();
+  public:
+
+  // optional .quadtree.RegionSnapshot snapshot = 13;
+  bool has_snapshot() const;
+  private:
+  bool _internal_has_snapshot() const;
+  public:
+  void clear_snapshot();
+  const ::quadtree::RegionSnapshot& snapshot() const;
+  PROTOBUF_NODISCARD ::quadtree::RegionSnapshot* release_snapshot();
+  ::quadtree::RegionSnapshot* mutable_snapshot();
+  void set_allocated_snapshot(::quadtree::RegionSnapshot* snapshot);
+  private:
+  const ::quadtree::RegionSnapshot& _internal_snapshot() const;
+  ::quadtree::RegionSnapshot* _internal_mutable_snapshot();
+  public:
+  void unsafe_arena_set_allocated_snapshot(
+      ::quadtree::RegionSnapshot* snapshot);
+  ::quadtree::RegionSnapshot* unsafe_arena_release_snapshot();
+
   // required bool hashKnown = 1;
   bool has_hashknown() const;
+  private:
+  bool _internal_has_hashknown() const;
+  public:
   void clear_hashknown();
-  static const int kHashKnownFieldNumber = 1;
   bool hashknown() const;
   void set_hashknown(bool value);
+  private:
+  bool _internal_hashknown() const;
+  void _internal_set_hashknown(bool value);
+  public:
 
   // required bool chunkData = 2;
   bool has_chunkdata() const;
+  private:
+  bool _internal_has_chunkdata() const;
+  public:
   void clear_chunkdata();
-  static const int kChunkDataFieldNumber = 2;
   bool chunkdata() const;
   void set_chunkdata(bool value);
+  private:
+  bool _internal_chunkdata() const;
+  void _internal_set_chunkdata(bool value);
+  public:
+
+  // optional uint32 treeLevel = 5;
+  bool has_treelevel() const;
+  private:
+  bool _internal_has_treelevel() const;
+  public:
+  void clear_treelevel();
+  uint32_t treelevel() const;
+  void set_treelevel(uint32_t value);
+  private:
+  uint32_t _internal_treelevel() const;
+  void _internal_set_treelevel(uint32_t value);
+  public:
 
   // required uint64 curHash = 3;
   bool has_curhash() const;
+  private:
+  bool _internal_has_curhash() const;
+  public:
   void clear_curhash();
-  static const int kCurHashFieldNumber = 3;
-  ::google::protobuf::uint64 curhash() const;
-  void set_curhash(::google::protobuf::uint64 value);
+  uint64_t curhash() const;
+  void set_curhash(uint64_t value);
+  private:
+  uint64_t _internal_curhash() const;
+  void _internal_set_curhash(uint64_t value);
+  public:
 
   // required int64 lastPublishEvent = 7;
   bool has_lastpublishevent() const;
+  private:
+  bool _internal_has_lastpublishevent() const;
+  public:
   void clear_lastpublishevent();
-  static const int kLastPublishEventFieldNumber = 7;
-  ::google::protobuf::int64 lastpublishevent() const;
-  void set_lastpublishevent(::google::protobuf::int64 value);
+  int64_t lastpublishevent() const;
+  void set_lastpublishevent(int64_t value);
+  private:
+  int64_t _internal_lastpublishevent() const;
+  void _internal_set_lastpublishevent(int64_t value);
+  public:
 
-  // repeated .quadtree.ChunkData chunks = 4;
-  int chunks_size() const;
-  void clear_chunks();
-  static const int kChunksFieldNumber = 4;
-  const ::quadtree::ChunkData& chunks(int index) const;
-  ::quadtree::ChunkData* mutable_chunks(int index);
-  ::quadtree::ChunkData* add_chunks();
-  ::google::protobuf::RepeatedPtrField< ::quadtree::ChunkData >*
-      mutable_chunks();
-  const ::google::protobuf::RepeatedPtrField< ::quadtree::ChunkData >&
-      chunks() const;
+  // optional uint32 hashOffset = 9;
+  bool has_hashoffset() const;
+  private:
+  bool _internal_has_hashoffset() const;
+  public:
+  void clear_hashoffset();
+  uint32_t hashoffset() const;
+  void set_hashoffset(uint32_t value);
+  private:
+  uint32_t _internal_hashoffset() const;
+  void _internal_set_hashoffset(uint32_t value);
+  public:
 
-  // optional uint32 treeLevel = 5;
-  bool has_treelevel() const;
-  void clear_treelevel();
-  static const int kTreeLevelFieldNumber = 5;
-  ::google::protobuf::uint32 treelevel() const;
-  void set_treelevel(::google::protobuf::uint32 value);
+  // optional uint32 hashBits = 10;
+  bool has_hashbits() const;
+  private:
+  bool _internal_has_hashbits() const;
+  public:
+  void clear_hashbits();
+  uint32_t hashbits() const;
+  void set_hashbits(uint32_t value);
+  private:
+  uint32_t _internal_hashbits() const;
+  void _internal_set_hashbits(uint32_t value);
+  public:
 
-  // repeated uint64 hashValues = 6;
-  int hashvalues_size() const;
-  void clear_hashvalues();
-  static const int kHashValuesFieldNumber = 6;
-  ::google::protobuf::uint64 hashvalues(int index) const;
-  void set_hashvalues(int index, ::google::protobuf::uint64 value);
-  void add_hashvalues(::google::protobuf::uint64 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
-      hashvalues() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
-      mutable_hashvalues();
+  // optional uint64 revision = 11;
+  bool has_revision() const;
+  private:
+  bool _internal_has_revision() const;
+  public:
+  void clear_revision();
+  uint64_t revision() const;
+  void set_revision(uint64_t value);
+  private:
+  uint64_t _internal_revision() const;
+  void _internal_set_revision(uint64_t value);
+  public:
+
+  // optional uint64 subtreeRevision = 12;
+  bool has_subtreerevision() const;
+  private:
+  bool _internal_has_subtreerevision() const;
+  public:
+  void clear_subtreerevision();
+  uint64_t subtreerevision() const;
+  void set_subtreerevision(uint64_t value);
+  private:
+  uint64_t _internal_subtreerevision() const;
+  void _internal_set_subtreerevision(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:quadtree.SyncResponse)
  private:
-  inline void set_has_hashknown();
-  inline void clear_has_hashknown();
-  inline void set_has_chunkdata();
-  inline void clear_has_chunkdata();
-  inline void set_has_curhash();
-  inline void clear_has_curhash();
-  inline void set_has_lastpublishevent();
-  inline void clear_has_lastpublishevent();
-  inline void set_has_treelevel();
-  inline void clear_has_treelevel();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint64 curhash_;
-  bool hashknown_;
-  bool chunkdata_;
-  ::google::protobuf::uint32 treelevel_;
-  ::google::protobuf::int64 lastpublishevent_;
-  ::google::protobuf::RepeatedPtrField< ::quadtree::ChunkData > chunks_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > hashvalues_;
-  friend void  protobuf_AddDesc_SyncResponse_2eproto();
-  friend void protobuf_AssignDesc_SyncResponse_2eproto();
-  friend void protobuf_ShutdownFile_SyncResponse_2eproto();
-
-  void InitAsDefaultInstance();
-  static SyncResponse* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::ChunkData > chunks_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > hashvalues_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr manifest_;
+    ::quadtree::RegionSnapshot* snapshot_;
+    bool hashknown_;
+    bool chunkdata_;
+    uint32_t treelevel_;
+    uint64_t curhash_;
+    int64_t lastpublishevent_;
+    uint32_t hashoffset_;
+    uint32_t hashbits_;
+    uint64_t revision_;
+    uint64_t subtreerevision_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SyncResponse_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ChunkData : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:quadtree.ChunkData) */ {
+class RegionSnapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.RegionSnapshot) */ {
  public:
-  ChunkData();
-  virtual ~ChunkData();
+  inline RegionSnapshot() : RegionSnapshot(nullptr) {}
+  ~RegionSnapshot() override;
+  explicit PROTOBUF_CONSTEXPR RegionSnapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegionSnapshot(const RegionSnapshot& from);
+  RegionSnapshot(RegionSnapshot&& from) noexcept
+    : RegionSnapshot() {
+    *this = ::std::move(from);
+  }
 
-  ChunkData(const ChunkData& from);
+  inline RegionSnapshot& operator=(const RegionSnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegionSnapshot& operator=(RegionSnapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline ChunkData& operator=(const ChunkData& from) {
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegionSnapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegionSnapshot* internal_default_instance() {
+    return reinterpret_cast<const RegionSnapshot*>(
+               &_RegionSnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RegionSnapshot& a, RegionSnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegionSnapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegionSnapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegionSnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegionSnapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegionSnapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegionSnapshot& from) {
+    RegionSnapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegionSnapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.RegionSnapshot";
+  }
+  protected:
+  explicit RegionSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMortonDeltasFieldNumber = 1,
+    kVersionsFieldNumber = 2,
+    kChunkCountsFieldNumber = 3,
+  };
+  // repeated uint64 mortonDeltas = 1 [packed = true];
+  int mortondeltas_size() const;
+  private:
+  int _internal_mortondeltas_size() const;
+  public:
+  void clear_mortondeltas();
+  private:
+  uint64_t _internal_mortondeltas(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_mortondeltas() const;
+  void _internal_add_mortondeltas(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_mortondeltas();
+  public:
+  uint64_t mortondeltas(int index) const;
+  void set_mortondeltas(int index, uint64_t value);
+  void add_mortondeltas(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      mortondeltas() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_mortondeltas();
+
+  // repeated uint64 versions = 2 [packed = true];
+  int versions_size() const;
+  private:
+  int _internal_versions_size() const;
+  public:
+  void clear_versions();
+  private:
+  uint64_t _internal_versions(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_versions() const;
+  void _internal_add_versions(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_versions();
+  public:
+  uint64_t versions(int index) const;
+  void set_versions(int index, uint64_t value);
+  void add_versions(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      versions() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_versions();
+
+  // repeated uint32 chunkCounts = 3 [packed = true];
+  int chunkcounts_size() const;
+  private:
+  int _internal_chunkcounts_size() const;
+  public:
+  void clear_chunkcounts();
+  private:
+  uint32_t _internal_chunkcounts(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_chunkcounts() const;
+  void _internal_add_chunkcounts(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_chunkcounts();
+  public:
+  uint32_t chunkcounts(int index) const;
+  void set_chunkcounts(int index, uint32_t value);
+  void add_chunkcounts(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      chunkcounts() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_chunkcounts();
+
+  // @@protoc_insertion_point(class_scope:quadtree.RegionSnapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > mortondeltas_;
+    mutable std::atomic<int> _mortondeltas_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > versions_;
+    mutable std::atomic<int> _versions_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > chunkcounts_;
+    mutable std::atomic<int> _chunkcounts_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SyncResponse_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AggregatedSyncResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.AggregatedSyncResponse) */ {
+ public:
+  inline AggregatedSyncResponse() : AggregatedSyncResponse(nullptr) {}
+  ~AggregatedSyncResponse() override;
+  explicit PROTOBUF_CONSTEXPR AggregatedSyncResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AggregatedSyncResponse(const AggregatedSyncResponse& from);
+  AggregatedSyncResponse(AggregatedSyncResponse&& from) noexcept
+    : AggregatedSyncResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline AggregatedSyncResponse& operator=(const AggregatedSyncResponse& from) {
     CopyFrom(from);
     return *this;
   }
+  inline AggregatedSyncResponse& operator=(AggregatedSyncResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AggregatedSyncResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AggregatedSyncResponse* internal_default_instance() {
+    return reinterpret_cast<const AggregatedSyncResponse*>(
+               &_AggregatedSyncResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  friend void swap(AggregatedSyncResponse& a, AggregatedSyncResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AggregatedSyncResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AggregatedSyncResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ChunkData& default_instance();
+  // implements Message ----------------------------------------------
 
-  void Swap(ChunkData* other);
+  AggregatedSyncResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AggregatedSyncResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AggregatedSyncResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AggregatedSyncResponse& from) {
+    AggregatedSyncResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AggregatedSyncResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.AggregatedSyncResponse";
+  }
+  protected:
+  explicit AggregatedSyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponsesFieldNumber = 1,
+    kOmittedFieldNumber = 2,
+  };
+  // repeated .quadtree.SubtreeSyncResponse responses = 1;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::quadtree::SubtreeSyncResponse* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::SubtreeSyncResponse >*
+      mutable_responses();
+  private:
+  const ::quadtree::SubtreeSyncResponse& _internal_responses(int index) const;
+  ::quadtree::SubtreeSyncResponse* _internal_add_responses();
+  public:
+  const ::quadtree::SubtreeSyncResponse& responses(int index) const;
+  ::quadtree::SubtreeSyncResponse* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::SubtreeSyncResponse >&
+      responses() const;
+
+  // repeated string omitted = 2;
+  int omitted_size() const;
+  private:
+  int _internal_omitted_size() const;
+  public:
+  void clear_omitted();
+  const std::string& omitted(int index) const;
+  std::string* mutable_omitted(int index);
+  void set_omitted(int index, const std::string& value);
+  void set_omitted(int index, std::string&& value);
+  void set_omitted(int index, const char* value);
+  void set_omitted(int index, const char* value, size_t size);
+  std::string* add_omitted();
+  void add_omitted(const std::string& value);
+  void add_omitted(std::string&& value);
+  void add_omitted(const char* value);
+  void add_omitted(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& omitted() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_omitted();
+  private:
+  const std::string& _internal_omitted(int index) const;
+  std::string* _internal_add_omitted();
+  public:
+
+  // @@protoc_insertion_point(class_scope:quadtree.AggregatedSyncResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::SubtreeSyncResponse > responses_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> omitted_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SyncResponse_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubtreeSyncResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.SubtreeSyncResponse) */ {
+ public:
+  inline SubtreeSyncResponse() : SubtreeSyncResponse(nullptr) {}
+  ~SubtreeSyncResponse() override;
+  explicit PROTOBUF_CONSTEXPR SubtreeSyncResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubtreeSyncResponse(const SubtreeSyncResponse& from);
+  SubtreeSyncResponse(SubtreeSyncResponse&& from) noexcept
+    : SubtreeSyncResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SubtreeSyncResponse& operator=(const SubtreeSyncResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubtreeSyncResponse& operator=(SubtreeSyncResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubtreeSyncResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubtreeSyncResponse* internal_default_instance() {
+    return reinterpret_cast<const SubtreeSyncResponse*>(
+               &_SubtreeSyncResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SubtreeSyncResponse& a, SubtreeSyncResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubtreeSyncResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubtreeSyncResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline ChunkData* New() const { return New(NULL); }
+  SubtreeSyncResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubtreeSyncResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SubtreeSyncResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubtreeSyncResponse& from) {
+    SubtreeSyncResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SubtreeSyncResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.SubtreeSyncResponse";
+  }
+  protected:
+  explicit SubtreeSyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSubtreeFieldNumber = 1,
+    kResponseFieldNumber = 2,
+  };
+  // required string subtree = 1;
+  bool has_subtree() const;
+  private:
+  bool _internal_has_subtree() const;
+  public:
+  void clear_subtree();
+  const std::string& subtree() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_subtree(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_subtree();
+  PROTOBUF_NODISCARD std::string* release_subtree();
+  void set_allocated_subtree(std::string* subtree);
+  private:
+  const std::string& _internal_subtree() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_subtree(const std::string& value);
+  std::string* _internal_mutable_subtree();
+  public:
+
+  // required .quadtree.SyncResponse response = 2;
+  bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
+  void clear_response();
+  const ::quadtree::SyncResponse& response() const;
+  PROTOBUF_NODISCARD ::quadtree::SyncResponse* release_response();
+  ::quadtree::SyncResponse* mutable_response();
+  void set_allocated_response(::quadtree::SyncResponse* response);
+  private:
+  const ::quadtree::SyncResponse& _internal_response() const;
+  ::quadtree::SyncResponse* _internal_mutable_response();
+  public:
+  void unsafe_arena_set_allocated_response(
+      ::quadtree::SyncResponse* response);
+  ::quadtree::SyncResponse* unsafe_arena_release_response();
+
+  // @@protoc_insertion_point(class_scope:quadtree.SubtreeSyncResponse)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subtree_;
+    ::quadtree::SyncResponse* response_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SyncResponse_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChunkData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:quadtree.ChunkData) */ {
+ public:
+  inline ChunkData() : ChunkData(nullptr) {}
+  ~ChunkData() override;
+  explicit PROTOBUF_CONSTEXPR ChunkData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChunkData(const ChunkData& from);
+  ChunkData(ChunkData&& from) noexcept
+    : ChunkData() {
+    *this = ::std::move(from);
+  }
+
+  inline ChunkData& operator=(const ChunkData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChunkData& operator=(ChunkData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  ChunkData* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChunkData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChunkData* internal_default_instance() {
+    return reinterpret_cast<const ChunkData*>(
+               &_ChunkData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ChunkData& a, ChunkData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChunkData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChunkData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChunkData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChunkData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ChunkData& from);
-  void MergeFrom(const ChunkData& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChunkData& from) {
+    ChunkData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(ChunkData* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "quadtree.ChunkData";
   }
+  protected:
+  explicit ChunkData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kDataFieldNumber = 3,
+  };
   // required uint64 x = 1;
   bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
   void clear_x();
-  static const int kXFieldNumber = 1;
-  ::google::protobuf::uint64 x() const;
-  void set_x(::google::protobuf::uint64 value);
+  uint64_t x() const;
+  void set_x(uint64_t value);
+  private:
+  uint64_t _internal_x() const;
+  void _internal_set_x(uint64_t value);
+  public:
 
   // required uint64 y = 2;
   bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
   void clear_y();
-  static const int kYFieldNumber = 2;
-  ::google::protobuf::uint64 y() const;
-  void set_y(::google::protobuf::uint64 value);
+  uint64_t y() const;
+  void set_y(uint64_t value);
+  private:
+  uint64_t _internal_y() const;
+  void _internal_set_y(uint64_t value);
+  public:
 
   // required uint64 data = 3;
   bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
   void clear_data();
-  static const int kDataFieldNumber = 3;
-  ::google::protobuf::uint64 data() const;
-  void set_data(::google::protobuf::uint64 value);
+  uint64_t data() const;
+  void set_data(uint64_t value);
+  private:
+  uint64_t _internal_data() const;
+  void _internal_set_data(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:quadtree.ChunkData)
  private:
-  inline void set_has_x();
-  inline void clear_has_x();
-  inline void set_has_y();
-  inline void clear_has_y();
-  inline void set_has_data();
-  inline void clear_has_data();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint64 x_;
-  ::google::protobuf::uint64 y_;
-  ::google::protobuf::uint64 data_;
-  friend void  protobuf_AddDesc_SyncResponse_2eproto();
-  friend void protobuf_AssignDesc_SyncResponse_2eproto();
-  friend void protobuf_ShutdownFile_SyncResponse_2eproto();
-
-  void InitAsDefaultInstance();
-  static ChunkData* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t x_;
+    uint64_t y_;
+    uint64_t data_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SyncResponse_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // SyncResponse
 
 // required bool hashKnown = 1;
-inline bool SyncResponse::has_hashknown() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SyncResponse::set_has_hashknown() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool SyncResponse::_internal_has_hashknown() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void SyncResponse::clear_has_hashknown() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool SyncResponse::has_hashknown() const {
+  return _internal_has_hashknown();
 }
 inline void SyncResponse::clear_hashknown() {
-  hashknown_ = false;
-  clear_has_hashknown();
+  _impl_.hashknown_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool SyncResponse::_internal_hashknown() const {
+  return _impl_.hashknown_;
 }
 inline bool SyncResponse::hashknown() const {
   // @@protoc_insertion_point(field_get:quadtree.SyncResponse.hashKnown)
-  return hashknown_;
+  return _internal_hashknown();
+}
+inline void SyncResponse::_internal_set_hashknown(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.hashknown_ = value;
 }
 inline void SyncResponse::set_hashknown(bool value) {
-  set_has_hashknown();
-  hashknown_ = value;
+  _internal_set_hashknown(value);
   // @@protoc_insertion_point(field_set:quadtree.SyncResponse.hashKnown)
 }
 
 // required bool chunkData = 2;
-inline bool SyncResponse::has_chunkdata() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool SyncResponse::_internal_has_chunkdata() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void SyncResponse::set_has_chunkdata() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void SyncResponse::clear_has_chunkdata() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool SyncResponse::has_chunkdata() const {
+  return _internal_has_chunkdata();
 }
 inline void SyncResponse::clear_chunkdata() {
-  chunkdata_ = false;
-  clear_has_chunkdata();
+  _impl_.chunkdata_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool SyncResponse::_internal_chunkdata() const {
+  return _impl_.chunkdata_;
 }
 inline bool SyncResponse::chunkdata() const {
   // @@protoc_insertion_point(field_get:quadtree.SyncResponse.chunkData)
-  return chunkdata_;
+  return _internal_chunkdata();
+}
+inline void SyncResponse::_internal_set_chunkdata(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.chunkdata_ = value;
 }
 inline void SyncResponse::set_chunkdata(bool value) {
-  set_has_chunkdata();
-  chunkdata_ = value;
+  _internal_set_chunkdata(value);
   // @@protoc_insertion_point(field_set:quadtree.SyncResponse.chunkData)
 }
 
 // required uint64 curHash = 3;
-inline bool SyncResponse::has_curhash() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void SyncResponse::set_has_curhash() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool SyncResponse::_internal_has_curhash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void SyncResponse::clear_has_curhash() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool SyncResponse::has_curhash() const {
+  return _internal_has_curhash();
 }
 inline void SyncResponse::clear_curhash() {
-  curhash_ = GOOGLE_ULONGLONG(0);
-  clear_has_curhash();
+  _impl_.curhash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t SyncResponse::_internal_curhash() const {
+  return _impl_.curhash_;
 }
-inline ::google::protobuf::uint64 SyncResponse::curhash() const {
+inline uint64_t SyncResponse::curhash() const {
   // @@protoc_insertion_point(field_get:quadtree.SyncResponse.curHash)
-  return curhash_;
+  return _internal_curhash();
 }
-inline void SyncResponse::set_curhash(::google::protobuf::uint64 value) {
-  set_has_curhash();
-  curhash_ = value;
+inline void SyncResponse::_internal_set_curhash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.curhash_ = value;
+}
+inline void SyncResponse::set_curhash(uint64_t value) {
+  _internal_set_curhash(value);
   // @@protoc_insertion_point(field_set:quadtree.SyncResponse.curHash)
 }
 
 // required int64 lastPublishEvent = 7;
-inline bool SyncResponse::has_lastpublishevent() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool SyncResponse::_internal_has_lastpublishevent() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void SyncResponse::set_has_lastpublishevent() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void SyncResponse::clear_has_lastpublishevent() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool SyncResponse::has_lastpublishevent() const {
+  return _internal_has_lastpublishevent();
 }
 inline void SyncResponse::clear_lastpublishevent() {
-  lastpublishevent_ = GOOGLE_LONGLONG(0);
-  clear_has_lastpublishevent();
+  _impl_.lastpublishevent_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline ::google::protobuf::int64 SyncResponse::lastpublishevent() const {
+inline int64_t SyncResponse::_internal_lastpublishevent() const {
+  return _impl_.lastpublishevent_;
+}
+inline int64_t SyncResponse::lastpublishevent() const {
   // @@protoc_insertion_point(field_get:quadtree.SyncResponse.lastPublishEvent)
-  return lastpublishevent_;
+  return _internal_lastpublishevent();
+}
+inline void SyncResponse::_internal_set_lastpublishevent(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.lastpublishevent_ = value;
 }
-inline void SyncResponse::set_lastpublishevent(::google::protobuf::int64 value) {
-  set_has_lastpublishevent();
-  lastpublishevent_ = value;
+inline void SyncResponse::set_lastpublishevent(int64_t value) {
+  _internal_set_lastpublishevent(value);
   // @@protoc_insertion_point(field_set:quadtree.SyncResponse.lastPublishEvent)
 }
 
 // repeated .quadtree.ChunkData chunks = 4;
+inline int SyncResponse::_internal_chunks_size() const {
+  return _impl_.chunks_.size();
+}
 inline int SyncResponse::chunks_size() const {
-  return chunks_.size();
+  return _internal_chunks_size();
 }
 inline void SyncResponse::clear_chunks() {
-  chunks_.Clear();
+  _impl_.chunks_.Clear();
+}
+inline ::quadtree::ChunkData* SyncResponse::mutable_chunks(int index) {
+  // @@protoc_insertion_point(field_mutable:quadtree.SyncResponse.chunks)
+  return _impl_.chunks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::ChunkData >*
+SyncResponse::mutable_chunks() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.SyncResponse.chunks)
+  return &_impl_.chunks_;
+}
+inline const ::quadtree::ChunkData& SyncResponse::_internal_chunks(int index) const {
+  return _impl_.chunks_.Get(index);
 }
 inline const ::quadtree::ChunkData& SyncResponse::chunks(int index) const {
   // @@protoc_insertion_point(field_get:quadtree.SyncResponse.chunks)
-  return chunks_.Get(index);
+  return _internal_chunks(index);
 }
-inline ::quadtree::ChunkData* SyncResponse::mutable_chunks(int index) {
-  // @@protoc_insertion_point(field_mutable:quadtree.SyncResponse.chunks)
-  return chunks_.Mutable(index);
+inline ::quadtree::ChunkData* SyncResponse::_internal_add_chunks() {
+  return _impl_.chunks_.Add();
 }
 inline ::quadtree::ChunkData* SyncResponse::add_chunks() {
+  ::quadtree::ChunkData* _add = _internal_add_chunks();
   // @@protoc_insertion_point(field_add:quadtree.SyncResponse.chunks)
-  return chunks_.Add();
+  return _add;
 }
-inline ::google::protobuf::RepeatedPtrField< ::quadtree::ChunkData >*
-SyncResponse::mutable_chunks() {
-  // @@protoc_insertion_point(field_mutable_list:quadtree.SyncResponse.chunks)
-  return &chunks_;
-}
-inline const ::google::protobuf::RepeatedPtrField< ::quadtree::ChunkData >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::ChunkData >&
 SyncResponse::chunks() const {
   // @@protoc_insertion_point(field_list:quadtree.SyncResponse.chunks)
-  return chunks_;
+  return _impl_.chunks_;
 }
 
 // optional uint32 treeLevel = 5;
-inline bool SyncResponse::has_treelevel() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool SyncResponse::_internal_has_treelevel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void SyncResponse::set_has_treelevel() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void SyncResponse::clear_has_treelevel() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool SyncResponse::has_treelevel() const {
+  return _internal_has_treelevel();
 }
 inline void SyncResponse::clear_treelevel() {
-  treelevel_ = 0u;
-  clear_has_treelevel();
+  _impl_.treelevel_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline ::google::protobuf::uint32 SyncResponse::treelevel() const {
+inline uint32_t SyncResponse::_internal_treelevel() const {
+  return _impl_.treelevel_;
+}
+inline uint32_t SyncResponse::treelevel() const {
   // @@protoc_insertion_point(field_get:quadtree.SyncResponse.treeLevel)
-  return treelevel_;
+  return _internal_treelevel();
+}
+inline void SyncResponse::_internal_set_treelevel(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.treelevel_ = value;
 }
-inline void SyncResponse::set_treelevel(::google::protobuf::uint32 value) {
-  set_has_treelevel();
-  treelevel_ = value;
+inline void SyncResponse::set_treelevel(uint32_t value) {
+  _internal_set_treelevel(value);
   // @@protoc_insertion_point(field_set:quadtree.SyncResponse.treeLevel)
 }
 
 // repeated uint64 hashValues = 6;
+inline int SyncResponse::_internal_hashvalues_size() const {
+  return _impl_.hashvalues_.size();
+}
 inline int SyncResponse::hashvalues_size() const {
-  return hashvalues_.size();
+  return _internal_hashvalues_size();
 }
 inline void SyncResponse::clear_hashvalues() {
-  hashvalues_.Clear();
+  _impl_.hashvalues_.Clear();
+}
+inline uint64_t SyncResponse::_internal_hashvalues(int index) const {
+  return _impl_.hashvalues_.Get(index);
 }
-inline ::google::protobuf::uint64 SyncResponse::hashvalues(int index) const {
+inline uint64_t SyncResponse::hashvalues(int index) const {
   // @@protoc_insertion_point(field_get:quadtree.SyncResponse.hashValues)
-  return hashvalues_.Get(index);
+  return _internal_hashvalues(index);
 }
-inline void SyncResponse::set_hashvalues(int index, ::google::protobuf::uint64 value) {
-  hashvalues_.Set(index, value);
+inline void SyncResponse::set_hashvalues(int index, uint64_t value) {
+  _impl_.hashvalues_.Set(index, value);
   // @@protoc_insertion_point(field_set:quadtree.SyncResponse.hashValues)
 }
-inline void SyncResponse::add_hashvalues(::google::protobuf::uint64 value) {
-  hashvalues_.Add(value);
+inline void SyncResponse::_internal_add_hashvalues(uint64_t value) {
+  _impl_.hashvalues_.Add(value);
+}
+inline void SyncResponse::add_hashvalues(uint64_t value) {
+  _internal_add_hashvalues(value);
   // @@protoc_insertion_point(field_add:quadtree.SyncResponse.hashValues)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+SyncResponse::_internal_hashvalues() const {
+  return _impl_.hashvalues_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
 SyncResponse::hashvalues() const {
   // @@protoc_insertion_point(field_list:quadtree.SyncResponse.hashValues)
-  return hashvalues_;
+  return _internal_hashvalues();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+SyncResponse::_internal_mutable_hashvalues() {
+  return &_impl_.hashvalues_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
 SyncResponse::mutable_hashvalues() {
   // @@protoc_insertion_point(field_mutable_list:quadtree.SyncResponse.hashValues)
-  return &hashvalues_;
+  return _internal_mutable_hashvalues();
+}
+
+// optional string manifest = 8;
+inline bool SyncResponse::_internal_has_manifest() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SyncResponse::has_manifest() const {
+  return _internal_has_manifest();
+}
+inline void SyncResponse::clear_manifest() {
+  _impl_.manifest_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SyncResponse::manifest() const {
+  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.manifest)
+  return _internal_manifest();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncResponse::set_manifest(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.manifest_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.manifest)
+}
+inline std::string* SyncResponse::mutable_manifest() {
+  std::string* _s = _internal_mutable_manifest();
+  // @@protoc_insertion_point(field_mutable:quadtree.SyncResponse.manifest)
+  return _s;
+}
+inline const std::string& SyncResponse::_internal_manifest() const {
+  return _impl_.manifest_.Get();
+}
+inline void SyncResponse::_internal_set_manifest(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.manifest_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncResponse::_internal_mutable_manifest() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.manifest_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncResponse::release_manifest() {
+  // @@protoc_insertion_point(field_release:quadtree.SyncResponse.manifest)
+  if (!_internal_has_manifest()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.manifest_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.manifest_.IsDefault()) {
+    _impl_.manifest_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SyncResponse::set_allocated_manifest(std::string* manifest) {
+  if (manifest != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.manifest_.SetAllocated(manifest, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.manifest_.IsDefault()) {
+    _impl_.manifest_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:quadtree.SyncResponse.manifest)
+}
+
+// optional uint32 hashOffset = 9;
+inline bool SyncResponse::_internal_has_hashoffset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SyncResponse::has_hashoffset() const {
+  return _internal_has_hashoffset();
+}
+inline void SyncResponse::clear_hashoffset() {
+  _impl_.hashoffset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t SyncResponse::_internal_hashoffset() const {
+  return _impl_.hashoffset_;
+}
+inline uint32_t SyncResponse::hashoffset() const {
+  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.hashOffset)
+  return _internal_hashoffset();
+}
+inline void SyncResponse::_internal_set_hashoffset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.hashoffset_ = value;
+}
+inline void SyncResponse::set_hashoffset(uint32_t value) {
+  _internal_set_hashoffset(value);
+  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.hashOffset)
+}
+
+// optional uint32 hashBits = 10;
+inline bool SyncResponse::_internal_has_hashbits() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SyncResponse::has_hashbits() const {
+  return _internal_has_hashbits();
+}
+inline void SyncResponse::clear_hashbits() {
+  _impl_.hashbits_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint32_t SyncResponse::_internal_hashbits() const {
+  return _impl_.hashbits_;
+}
+inline uint32_t SyncResponse::hashbits() const {
+  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.hashBits)
+  return _internal_hashbits();
+}
+inline void SyncResponse::_internal_set_hashbits(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.hashbits_ = value;
+}
+inline void SyncResponse::set_hashbits(uint32_t value) {
+  _internal_set_hashbits(value);
+  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.hashBits)
+}
+
+// optional uint64 revision = 11;
+inline bool SyncResponse::_internal_has_revision() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SyncResponse::has_revision() const {
+  return _internal_has_revision();
+}
+inline void SyncResponse::clear_revision() {
+  _impl_.revision_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint64_t SyncResponse::_internal_revision() const {
+  return _impl_.revision_;
+}
+inline uint64_t SyncResponse::revision() const {
+  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.revision)
+  return _internal_revision();
+}
+inline void SyncResponse::_internal_set_revision(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.revision_ = value;
+}
+inline void SyncResponse::set_revision(uint64_t value) {
+  _internal_set_revision(value);
+  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.revision)
+}
+
+// optional uint64 subtreeRevision = 12;
+inline bool SyncResponse::_internal_has_subtreerevision() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SyncResponse::has_subtreerevision() const {
+  return _internal_has_subtreerevision();
+}
+inline void SyncResponse::clear_subtreerevision() {
+  _impl_.subtreerevision_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint64_t SyncResponse::_internal_subtreerevision() const {
+  return _impl_.subtreerevision_;
+}
+inline uint64_t SyncResponse::subtreerevision() const {
+  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.subtreeRevision)
+  return _internal_subtreerevision();
+}
+inline void SyncResponse::_internal_set_subtreerevision(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.subtreerevision_ = value;
+}
+inline void SyncResponse::set_subtreerevision(uint64_t value) {
+  _internal_set_subtreerevision(value);
+  // @@protoc_insertion_point(field_set:quadtree.SyncResponse.subtreeRevision)
+}
+
+// optional .quadtree.RegionSnapshot snapshot = 13;
+inline bool SyncResponse::_internal_has_snapshot() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.snapshot_ != nullptr);
+  return value;
+}
+inline bool SyncResponse::has_snapshot() const {
+  return _internal_has_snapshot();
+}
+inline void SyncResponse::clear_snapshot() {
+  if (_impl_.snapshot_ != nullptr) _impl_.snapshot_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::quadtree::RegionSnapshot& SyncResponse::_internal_snapshot() const {
+  const ::quadtree::RegionSnapshot* p = _impl_.snapshot_;
+  return p != nullptr ? *p : reinterpret_cast<const ::quadtree::RegionSnapshot&>(
+      ::quadtree::_RegionSnapshot_default_instance_);
+}
+inline const ::quadtree::RegionSnapshot& SyncResponse::snapshot() const {
+  // @@protoc_insertion_point(field_get:quadtree.SyncResponse.snapshot)
+  return _internal_snapshot();
+}
+inline void SyncResponse::unsafe_arena_set_allocated_snapshot(
+    ::quadtree::RegionSnapshot* snapshot) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.snapshot_);
+  }
+  _impl_.snapshot_ = snapshot;
+  if (snapshot) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:quadtree.SyncResponse.snapshot)
+}
+inline ::quadtree::RegionSnapshot* SyncResponse::release_snapshot() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::quadtree::RegionSnapshot* temp = _impl_.snapshot_;
+  _impl_.snapshot_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::quadtree::RegionSnapshot* SyncResponse::unsafe_arena_release_snapshot() {
+  // @@protoc_insertion_point(field_release:quadtree.SyncResponse.snapshot)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::quadtree::RegionSnapshot* temp = _impl_.snapshot_;
+  _impl_.snapshot_ = nullptr;
+  return temp;
+}
+inline ::quadtree::RegionSnapshot* SyncResponse::_internal_mutable_snapshot() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.snapshot_ == nullptr) {
+    auto* p = CreateMaybeMessage<::quadtree::RegionSnapshot>(GetArenaForAllocation());
+    _impl_.snapshot_ = p;
+  }
+  return _impl_.snapshot_;
+}
+inline ::quadtree::RegionSnapshot* SyncResponse::mutable_snapshot() {
+  ::quadtree::RegionSnapshot* _msg = _internal_mutable_snapshot();
+  // @@protoc_insertion_point(field_mutable:quadtree.SyncResponse.snapshot)
+  return _msg;
+}
+inline void SyncResponse::set_allocated_snapshot(::quadtree::RegionSnapshot* snapshot) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.snapshot_;
+  }
+  if (snapshot) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(snapshot);
+    if (message_arena != submessage_arena) {
+      snapshot = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, snapshot, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.snapshot_ = snapshot;
+  // @@protoc_insertion_point(field_set_allocated:quadtree.SyncResponse.snapshot)
+}
+
+// -------------------------------------------------------------------
+
+// RegionSnapshot
+
+// repeated uint64 mortonDeltas = 1 [packed = true];
+inline int RegionSnapshot::_internal_mortondeltas_size() const {
+  return _impl_.mortondeltas_.size();
+}
+inline int RegionSnapshot::mortondeltas_size() const {
+  return _internal_mortondeltas_size();
+}
+inline void RegionSnapshot::clear_mortondeltas() {
+  _impl_.mortondeltas_.Clear();
+}
+inline uint64_t RegionSnapshot::_internal_mortondeltas(int index) const {
+  return _impl_.mortondeltas_.Get(index);
+}
+inline uint64_t RegionSnapshot::mortondeltas(int index) const {
+  // @@protoc_insertion_point(field_get:quadtree.RegionSnapshot.mortonDeltas)
+  return _internal_mortondeltas(index);
+}
+inline void RegionSnapshot::set_mortondeltas(int index, uint64_t value) {
+  _impl_.mortondeltas_.Set(index, value);
+  // @@protoc_insertion_point(field_set:quadtree.RegionSnapshot.mortonDeltas)
+}
+inline void RegionSnapshot::_internal_add_mortondeltas(uint64_t value) {
+  _impl_.mortondeltas_.Add(value);
+}
+inline void RegionSnapshot::add_mortondeltas(uint64_t value) {
+  _internal_add_mortondeltas(value);
+  // @@protoc_insertion_point(field_add:quadtree.RegionSnapshot.mortonDeltas)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+RegionSnapshot::_internal_mortondeltas() const {
+  return _impl_.mortondeltas_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+RegionSnapshot::mortondeltas() const {
+  // @@protoc_insertion_point(field_list:quadtree.RegionSnapshot.mortonDeltas)
+  return _internal_mortondeltas();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+RegionSnapshot::_internal_mutable_mortondeltas() {
+  return &_impl_.mortondeltas_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+RegionSnapshot::mutable_mortondeltas() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.RegionSnapshot.mortonDeltas)
+  return _internal_mutable_mortondeltas();
+}
+
+// repeated uint64 versions = 2 [packed = true];
+inline int RegionSnapshot::_internal_versions_size() const {
+  return _impl_.versions_.size();
+}
+inline int RegionSnapshot::versions_size() const {
+  return _internal_versions_size();
+}
+inline void RegionSnapshot::clear_versions() {
+  _impl_.versions_.Clear();
+}
+inline uint64_t RegionSnapshot::_internal_versions(int index) const {
+  return _impl_.versions_.Get(index);
+}
+inline uint64_t RegionSnapshot::versions(int index) const {
+  // @@protoc_insertion_point(field_get:quadtree.RegionSnapshot.versions)
+  return _internal_versions(index);
+}
+inline void RegionSnapshot::set_versions(int index, uint64_t value) {
+  _impl_.versions_.Set(index, value);
+  // @@protoc_insertion_point(field_set:quadtree.RegionSnapshot.versions)
+}
+inline void RegionSnapshot::_internal_add_versions(uint64_t value) {
+  _impl_.versions_.Add(value);
+}
+inline void RegionSnapshot::add_versions(uint64_t value) {
+  _internal_add_versions(value);
+  // @@protoc_insertion_point(field_add:quadtree.RegionSnapshot.versions)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+RegionSnapshot::_internal_versions() const {
+  return _impl_.versions_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+RegionSnapshot::versions() const {
+  // @@protoc_insertion_point(field_list:quadtree.RegionSnapshot.versions)
+  return _internal_versions();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+RegionSnapshot::_internal_mutable_versions() {
+  return &_impl_.versions_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+RegionSnapshot::mutable_versions() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.RegionSnapshot.versions)
+  return _internal_mutable_versions();
+}
+
+// repeated uint32 chunkCounts = 3 [packed = true];
+inline int RegionSnapshot::_internal_chunkcounts_size() const {
+  return _impl_.chunkcounts_.size();
+}
+inline int RegionSnapshot::chunkcounts_size() const {
+  return _internal_chunkcounts_size();
+}
+inline void RegionSnapshot::clear_chunkcounts() {
+  _impl_.chunkcounts_.Clear();
+}
+inline uint32_t RegionSnapshot::_internal_chunkcounts(int index) const {
+  return _impl_.chunkcounts_.Get(index);
+}
+inline uint32_t RegionSnapshot::chunkcounts(int index) const {
+  // @@protoc_insertion_point(field_get:quadtree.RegionSnapshot.chunkCounts)
+  return _internal_chunkcounts(index);
+}
+inline void RegionSnapshot::set_chunkcounts(int index, uint32_t value) {
+  _impl_.chunkcounts_.Set(index, value);
+  // @@protoc_insertion_point(field_set:quadtree.RegionSnapshot.chunkCounts)
+}
+inline void RegionSnapshot::_internal_add_chunkcounts(uint32_t value) {
+  _impl_.chunkcounts_.Add(value);
+}
+inline void RegionSnapshot::add_chunkcounts(uint32_t value) {
+  _internal_add_chunkcounts(value);
+  // @@protoc_insertion_point(field_add:quadtree.RegionSnapshot.chunkCounts)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RegionSnapshot::_internal_chunkcounts() const {
+  return _impl_.chunkcounts_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RegionSnapshot::chunkcounts() const {
+  // @@protoc_insertion_point(field_list:quadtree.RegionSnapshot.chunkCounts)
+  return _internal_chunkcounts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RegionSnapshot::_internal_mutable_chunkcounts() {
+  return &_impl_.chunkcounts_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RegionSnapshot::mutable_chunkcounts() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.RegionSnapshot.chunkCounts)
+  return _internal_mutable_chunkcounts();
+}
+
+// -------------------------------------------------------------------
+
+// AggregatedSyncResponse
+
+// repeated .quadtree.SubtreeSyncResponse responses = 1;
+inline int AggregatedSyncResponse::_internal_responses_size() const {
+  return _impl_.responses_.size();
+}
+inline int AggregatedSyncResponse::responses_size() const {
+  return _internal_responses_size();
+}
+inline void AggregatedSyncResponse::clear_responses() {
+  _impl_.responses_.Clear();
+}
+inline ::quadtree::SubtreeSyncResponse* AggregatedSyncResponse::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:quadtree.AggregatedSyncResponse.responses)
+  return _impl_.responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::SubtreeSyncResponse >*
+AggregatedSyncResponse::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.AggregatedSyncResponse.responses)
+  return &_impl_.responses_;
+}
+inline const ::quadtree::SubtreeSyncResponse& AggregatedSyncResponse::_internal_responses(int index) const {
+  return _impl_.responses_.Get(index);
+}
+inline const ::quadtree::SubtreeSyncResponse& AggregatedSyncResponse::responses(int index) const {
+  // @@protoc_insertion_point(field_get:quadtree.AggregatedSyncResponse.responses)
+  return _internal_responses(index);
+}
+inline ::quadtree::SubtreeSyncResponse* AggregatedSyncResponse::_internal_add_responses() {
+  return _impl_.responses_.Add();
+}
+inline ::quadtree::SubtreeSyncResponse* AggregatedSyncResponse::add_responses() {
+  ::quadtree::SubtreeSyncResponse* _add = _internal_add_responses();
+  // @@protoc_insertion_point(field_add:quadtree.AggregatedSyncResponse.responses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::quadtree::SubtreeSyncResponse >&
+AggregatedSyncResponse::responses() const {
+  // @@protoc_insertion_point(field_list:quadtree.AggregatedSyncResponse.responses)
+  return _impl_.responses_;
+}
+
+// repeated string omitted = 2;
+inline int AggregatedSyncResponse::_internal_omitted_size() const {
+  return _impl_.omitted_.size();
+}
+inline int AggregatedSyncResponse::omitted_size() const {
+  return _internal_omitted_size();
+}
+inline void AggregatedSyncResponse::clear_omitted() {
+  _impl_.omitted_.Clear();
+}
+inline std::string* AggregatedSyncResponse::add_omitted() {
+  std::string* _s = _internal_add_omitted();
+  // @@protoc_insertion_point(field_add_mutable:quadtree.AggregatedSyncResponse.omitted)
+  return _s;
+}
+inline const std::string& AggregatedSyncResponse::_internal_omitted(int index) const {
+  return _impl_.omitted_.Get(index);
+}
+inline const std::string& AggregatedSyncResponse::omitted(int index) const {
+  // @@protoc_insertion_point(field_get:quadtree.AggregatedSyncResponse.omitted)
+  return _internal_omitted(index);
+}
+inline std::string* AggregatedSyncResponse::mutable_omitted(int index) {
+  // @@protoc_insertion_point(field_mutable:quadtree.AggregatedSyncResponse.omitted)
+  return _impl_.omitted_.Mutable(index);
+}
+inline void AggregatedSyncResponse::set_omitted(int index, const std::string& value) {
+  _impl_.omitted_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:quadtree.AggregatedSyncResponse.omitted)
+}
+inline void AggregatedSyncResponse::set_omitted(int index, std::string&& value) {
+  _impl_.omitted_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:quadtree.AggregatedSyncResponse.omitted)
+}
+inline void AggregatedSyncResponse::set_omitted(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.omitted_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:quadtree.AggregatedSyncResponse.omitted)
+}
+inline void AggregatedSyncResponse::set_omitted(int index, const char* value, size_t size) {
+  _impl_.omitted_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:quadtree.AggregatedSyncResponse.omitted)
+}
+inline std::string* AggregatedSyncResponse::_internal_add_omitted() {
+  return _impl_.omitted_.Add();
+}
+inline void AggregatedSyncResponse::add_omitted(const std::string& value) {
+  _impl_.omitted_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:quadtree.AggregatedSyncResponse.omitted)
+}
+inline void AggregatedSyncResponse::add_omitted(std::string&& value) {
+  _impl_.omitted_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:quadtree.AggregatedSyncResponse.omitted)
+}
+inline void AggregatedSyncResponse::add_omitted(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.omitted_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:quadtree.AggregatedSyncResponse.omitted)
+}
+inline void AggregatedSyncResponse::add_omitted(const char* value, size_t size) {
+  _impl_.omitted_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:quadtree.AggregatedSyncResponse.omitted)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+AggregatedSyncResponse::omitted() const {
+  // @@protoc_insertion_point(field_list:quadtree.AggregatedSyncResponse.omitted)
+  return _impl_.omitted_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+AggregatedSyncResponse::mutable_omitted() {
+  // @@protoc_insertion_point(field_mutable_list:quadtree.AggregatedSyncResponse.omitted)
+  return &_impl_.omitted_;
+}
+
+// -------------------------------------------------------------------
+
+// SubtreeSyncResponse
+
+// required string subtree = 1;
+inline bool SubtreeSyncResponse::_internal_has_subtree() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubtreeSyncResponse::has_subtree() const {
+  return _internal_has_subtree();
+}
+inline void SubtreeSyncResponse::clear_subtree() {
+  _impl_.subtree_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubtreeSyncResponse::subtree() const {
+  // @@protoc_insertion_point(field_get:quadtree.SubtreeSyncResponse.subtree)
+  return _internal_subtree();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubtreeSyncResponse::set_subtree(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.subtree_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:quadtree.SubtreeSyncResponse.subtree)
+}
+inline std::string* SubtreeSyncResponse::mutable_subtree() {
+  std::string* _s = _internal_mutable_subtree();
+  // @@protoc_insertion_point(field_mutable:quadtree.SubtreeSyncResponse.subtree)
+  return _s;
+}
+inline const std::string& SubtreeSyncResponse::_internal_subtree() const {
+  return _impl_.subtree_.Get();
+}
+inline void SubtreeSyncResponse::_internal_set_subtree(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.subtree_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubtreeSyncResponse::_internal_mutable_subtree() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.subtree_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubtreeSyncResponse::release_subtree() {
+  // @@protoc_insertion_point(field_release:quadtree.SubtreeSyncResponse.subtree)
+  if (!_internal_has_subtree()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.subtree_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subtree_.IsDefault()) {
+    _impl_.subtree_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubtreeSyncResponse::set_allocated_subtree(std::string* subtree) {
+  if (subtree != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.subtree_.SetAllocated(subtree, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.subtree_.IsDefault()) {
+    _impl_.subtree_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:quadtree.SubtreeSyncResponse.subtree)
+}
+
+// required .quadtree.SyncResponse response = 2;
+inline bool SubtreeSyncResponse::_internal_has_response() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.response_ != nullptr);
+  return value;
+}
+inline bool SubtreeSyncResponse::has_response() const {
+  return _internal_has_response();
+}
+inline void SubtreeSyncResponse::clear_response() {
+  if (_impl_.response_ != nullptr) _impl_.response_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::quadtree::SyncResponse& SubtreeSyncResponse::_internal_response() const {
+  const ::quadtree::SyncResponse* p = _impl_.response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::quadtree::SyncResponse&>(
+      ::quadtree::_SyncResponse_default_instance_);
+}
+inline const ::quadtree::SyncResponse& SubtreeSyncResponse::response() const {
+  // @@protoc_insertion_point(field_get:quadtree.SubtreeSyncResponse.response)
+  return _internal_response();
+}
+inline void SubtreeSyncResponse::unsafe_arena_set_allocated_response(
+    ::quadtree::SyncResponse* response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.response_);
+  }
+  _impl_.response_ = response;
+  if (response) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:quadtree.SubtreeSyncResponse.response)
+}
+inline ::quadtree::SyncResponse* SubtreeSyncResponse::release_response() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::quadtree::SyncResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::quadtree::SyncResponse* SubtreeSyncResponse::unsafe_arena_release_response() {
+  // @@protoc_insertion_point(field_release:quadtree.SubtreeSyncResponse.response)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::quadtree::SyncResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+  return temp;
+}
+inline ::quadtree::SyncResponse* SubtreeSyncResponse::_internal_mutable_response() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::quadtree::SyncResponse>(GetArenaForAllocation());
+    _impl_.response_ = p;
+  }
+  return _impl_.response_;
+}
+inline ::quadtree::SyncResponse* SubtreeSyncResponse::mutable_response() {
+  ::quadtree::SyncResponse* _msg = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:quadtree.SubtreeSyncResponse.response)
+  return _msg;
+}
+inline void SubtreeSyncResponse::set_allocated_response(::quadtree::SyncResponse* response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.response_;
+  }
+  if (response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(response);
+    if (message_arena != submessage_arena) {
+      response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, response, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.response_ = response;
+  // @@protoc_insertion_point(field_set_allocated:quadtree.SubtreeSyncResponse.response)
 }
 
 // -------------------------------------------------------------------
@@ -510,78 +2166,98 @@ SyncResponse::mutable_hashvalues() {
 // ChunkData
 
 // required uint64 x = 1;
-inline bool ChunkData::has_x() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool ChunkData::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void ChunkData::set_has_x() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ChunkData::clear_has_x() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool ChunkData::has_x() const {
+  return _internal_has_x();
 }
 inline void ChunkData::clear_x() {
-  x_ = GOOGLE_ULONGLONG(0);
-  clear_has_x();
+  _impl_.x_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::google::protobuf::uint64 ChunkData::x() const {
+inline uint64_t ChunkData::_internal_x() const {
+  return _impl_.x_;
+}
+inline uint64_t ChunkData::x() const {
   // @@protoc_insertion_point(field_get:quadtree.ChunkData.x)
-  return x_;
+  return _internal_x();
+}
+inline void ChunkData::_internal_set_x(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
 }
-inline void ChunkData::set_x(::google::protobuf::uint64 value) {
-  set_has_x();
-  x_ = value;
+inline void ChunkData::set_x(uint64_t value) {
+  _internal_set_x(value);
   // @@protoc_insertion_point(field_set:quadtree.ChunkData.x)
 }
 
 // required uint64 y = 2;
-inline bool ChunkData::has_y() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ChunkData::set_has_y() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool ChunkData::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void ChunkData::clear_has_y() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool ChunkData::has_y() const {
+  return _internal_has_y();
 }
 inline void ChunkData::clear_y() {
-  y_ = GOOGLE_ULONGLONG(0);
-  clear_has_y();
+  _impl_.y_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ChunkData::_internal_y() const {
+  return _impl_.y_;
 }
-inline ::google::protobuf::uint64 ChunkData::y() const {
+inline uint64_t ChunkData::y() const {
   // @@protoc_insertion_point(field_get:quadtree.ChunkData.y)
-  return y_;
+  return _internal_y();
 }
-inline void ChunkData::set_y(::google::protobuf::uint64 value) {
-  set_has_y();
-  y_ = value;
+inline void ChunkData::_internal_set_y(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
+}
+inline void ChunkData::set_y(uint64_t value) {
+  _internal_set_y(value);
   // @@protoc_insertion_point(field_set:quadtree.ChunkData.y)
 }
 
 // required uint64 data = 3;
-inline bool ChunkData::has_data() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool ChunkData::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void ChunkData::set_has_data() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void ChunkData::clear_has_data() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool ChunkData::has_data() const {
+  return _internal_has_data();
 }
 inline void ChunkData::clear_data() {
-  data_ = GOOGLE_ULONGLONG(0);
-  clear_has_data();
+  _impl_.data_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::uint64 ChunkData::data() const {
+inline uint64_t ChunkData::_internal_data() const {
+  return _impl_.data_;
+}
+inline uint64_t ChunkData::data() const {
   // @@protoc_insertion_point(field_get:quadtree.ChunkData.data)
-  return data_;
+  return _internal_data();
+}
+inline void ChunkData::_internal_set_data(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.data_ = value;
 }
-inline void ChunkData::set_data(::google::protobuf::uint64 value) {
-  set_has_data();
-  data_ = value;
+inline void ChunkData::set_data(uint64_t value) {
+  _internal_set_data(value);
   // @@protoc_insertion_point(field_set:quadtree.ChunkData.data)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // -------------------------------------------------------------------
 
 
@@ -591,4 +2267,5 @@ inline void ChunkData::set_data(::google::protobuf::uint64 value) {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_SyncResponse_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_SyncResponse_2eproto
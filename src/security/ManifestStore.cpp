@@ -0,0 +1,107 @@
+#include "ManifestStore.h"
+
+namespace quadtree {
+
+void ManifestStore::addPendingDigests(unsigned long revision, size_t count)
+{
+    std::unique_lock<std::mutex> lck(this->storeMutex);
+    manifests[revision].pendingDigests += count;
+
+    while (manifests.size() > keptRevisions) {
+        manifests.erase(manifests.begin());
+    }
+}
+
+void ManifestStore::addDigest(unsigned long revision, const ndn::name::Component& digest)
+{
+    std::unique_lock<std::mutex> lck(this->storeMutex);
+    auto it = manifests.find(revision);
+    if (it == manifests.end() || it->second.pendingDigests == 0) {
+        return;
+    }
+    it->second.digests.push_back(digestToString(digest));
+    it->second.pendingDigests--;
+}
+
+void ManifestStore::seal(unsigned long revision)
+{
+    std::unique_lock<std::mutex> lck(this->storeMutex);
+    auto it = manifests.find(revision);
+    if (it != manifests.end()) {
+        it->second.sealed = true;
+    }
+}
+
+bool ManifestStore::takeManifestToSign(unsigned long revision, ResponseManifest& manifest)
+{
+    std::unique_lock<std::mutex> lck(this->storeMutex);
+    auto it = manifests.find(revision);
+    if (it == manifests.end() || !it->second.sealed || it->second.pendingDigests > 0 || it->second.signing
+        || it->second.digests.empty()) {
+        return false;
+    }
+    it->second.signing = true;
+
+    manifest.Clear();
+    manifest.set_revision(revision);
+    for (const auto& digest : it->second.digests) {
+        manifest.add_digests(digest);
+    }
+    return true;
+}
+
+void ManifestStore::setSignedManifest(unsigned long revision, const std::shared_ptr<const ndn::Data>& data)
+{
+    std::vector<ManifestCallback> waiting;
+    {
+        std::unique_lock<std::mutex> lck(this->storeMutex);
+        auto it = manifests.find(revision);
+        if (it == manifests.end()) {
+            return;
+        }
+        it->second.signedManifest = data;
+        waiting = std::move(it->second.waiting);
+        it->second.waiting.clear();
+    }
+
+    // Invoke callbacks outside of the lock
+    for (const auto& callback : waiting) {
+        callback(data);
+    }
+}
+
+bool ManifestStore::fetchSignedManifest(unsigned long revision, const ManifestCallback& onManifest)
+{
+    std::shared_ptr<const ndn::Data> signedManifest;
+    {
+        std::unique_lock<std::mutex> lck(this->storeMutex);
+        auto it = manifests.find(revision);
+        if (it == manifests.end()
+            || (it->second.sealed && it->second.pendingDigests == 0 && it->second.digests.empty())) {
+            return false;
+        }
+        if (it->second.signedManifest == nullptr) {
+            // The manifest is not sealed or signed yet
+            it->second.waiting.push_back(onManifest);
+            return true;
+        }
+        signedManifest = it->second.signedManifest;
+    }
+
+    onManifest(signedManifest);
+    return true;
+}
+
+ndn::Name ManifestStore::manifestName(const ndn::Name& regionName, unsigned long revision)
+{
+    ndn::Name name(regionName);
+    name.append("manifest").appendNumber(revision);
+    return name;
+}
+
+std::string ManifestStore::digestToString(const ndn::name::Component& digest)
+{
+    return std::string(reinterpret_cast<const char*>(digest.value()), digest.value_size());
+}
+
+}
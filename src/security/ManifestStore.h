@@ -0,0 +1,103 @@
+#ifndef QUADTREESYNCEVALUATION_MANIFESTSTORE_H
+#define QUADTREESYNCEVALUATION_MANIFESTSTORE_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ndn-cxx/face.hpp>
+
+#include "../proto/ResponseManifest.pb.h"
+
+namespace quadtree {
+
+/**
+ * Collects the digests of all sync responses a producer served for a revision of its tree. Instead of signing every
+ * response, the producer signs the manifest of a revision once and the responses only carry a digest.
+ *
+ * The manifest of a revision is sealed when the producer published the next revision. It is signed once all responses
+ * of the revision are signed, requests for the manifest arriving before are answered as soon as it is signed.
+ */
+class ManifestStore {
+
+public:
+    typedef std::function<void(const std::shared_ptr<const ndn::Data>&)> ManifestCallback;
+
+    explicit ManifestStore(unsigned keptRevisions = 2)
+        : keptRevisions(keptRevisions)
+    {
+    }
+
+    /**
+     * Announces digests of responses which are added as soon as the responses are signed. Manifests of revisions
+     * older than the kept revisions are dropped.
+     * @param revision Revision the responses are computed for, has to be the current revision of the producer
+     * @param count Number of digests
+     */
+    void addPendingDigests(unsigned long revision, size_t count);
+
+    /**
+     * Adds the implicit digest of a signed response announced with addPendingDigests(..)
+     * @param revision Revision the response was computed for
+     * @param digest Implicit SHA-256 digest component of the response
+     */
+    void addDigest(unsigned long revision, const ndn::name::Component& digest);
+
+    /**
+     * Seals the manifest of the given revision, no digests are announced for it afterwards. Has to be called when the
+     * producer published the next revision.
+     */
+    void seal(unsigned long revision);
+
+    /**
+     * Returns true exactly once for a sealed manifest, as soon as all announced digests were added. The caller has to
+     * sign the manifest and hand it over with setSignedManifest(..).
+     * @param revision Revision of the manifest
+     * @param manifest Set to the manifest to sign
+     */
+    bool takeManifestToSign(unsigned long revision, ResponseManifest& manifest);
+
+    /**
+     * Stores the signed manifest of a revision and invokes the callbacks of all requesters waiting for it
+     */
+    void setSignedManifest(unsigned long revision, const std::shared_ptr<const ndn::Data>& data);
+
+    /**
+     * Invokes the callback with the signed manifest of the given revision, immediately or as soon as it is signed
+     * @return False if no responses were served for the revision
+     */
+    bool fetchSignedManifest(unsigned long revision, const ManifestCallback& onManifest);
+
+    /**
+     * Returns the name of the manifest of the given revision
+     * @param regionName Name of the region the producer is responsible for (including the world prefix)
+     * @param revision Revision of the manifest
+     */
+    static ndn::Name manifestName(const ndn::Name& regionName, unsigned long revision);
+
+    /**
+     * Returns the raw bytes of a digest name component, as stored in the manifest
+     */
+    static std::string digestToString(const ndn::name::Component& digest);
+
+protected:
+    struct Manifest {
+        std::vector<std::string> digests;
+        size_t pendingDigests = 0;
+        bool sealed = false;
+        bool signing = false;
+        std::shared_ptr<const ndn::Data> signedManifest;
+        std::vector<ManifestCallback> waiting;
+    };
+
+    unsigned keptRevisions;
+    std::mutex storeMutex;
+    std::map<unsigned long, Manifest> manifests;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_MANIFESTSTORE_H
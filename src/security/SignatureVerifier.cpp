@@ -0,0 +1,161 @@
+#include "SignatureVerifier.h"
+
+#include "spdlog/spdlog.h"
+#include <ndn-cxx/security/verification-helpers.hpp>
+#include <ndn-cxx/util/io.hpp>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+namespace quadtree {
+
+SignatureVerifier::SignatureVerifier(const std::string& hmacKey, const std::vector<std::string>& trustAnchorFiles,
+    const std::vector<std::string>& certificateFiles)
+{
+    if (!hmacKey.empty()) {
+        std::vector<unsigned char> decoded(hmacKey.size());
+        int length = EVP_DecodeBlock(decoded.data(), reinterpret_cast<const unsigned char*>(hmacKey.data()),
+            (int)hmacKey.size());
+        if (length < 0) {
+            throw std::invalid_argument("HMAC key is not base64 encoded");
+        }
+        // EVP_DecodeBlock does not strip the padding
+        for (auto it = hmacKey.rbegin(); it != hmacKey.rend() && *it == '='; ++it) {
+            length--;
+        }
+        this->hmacKey = std::string(reinterpret_cast<const char*>(decoded.data()), length);
+    }
+
+    for (const auto& file : trustAnchorFiles) {
+        auto certificate = ndn::io::load<ndn::security::v2::Certificate>(file);
+        if (certificate == nullptr) {
+            throw std::invalid_argument("Cannot load trust anchor " + file);
+        }
+        trustedKeys[certificate->getKeyName()] = decodeKey(certificate->getPublicKey());
+        spdlog::info("Loaded trust anchor " + certificate->getKeyName().toUri());
+    }
+
+    for (const auto& file : certificateFiles) {
+        auto certificate = ndn::io::load<ndn::security::v2::Certificate>(file);
+        if (certificate == nullptr) {
+            throw std::invalid_argument("Cannot load certificate " + file);
+        }
+        addCertificate(*certificate);
+    }
+}
+
+void SignatureVerifier::addCertificate(const ndn::security::v2::Certificate& certificate)
+{
+    std::unique_lock<std::mutex> lck(this->keyCacheMutex);
+    pendingCertificates[certificate.getKeyName()] = certificate;
+}
+
+bool SignatureVerifier::verify(const ndn::Data& data) const
+{
+    switch (data.getSignature().getType()) {
+    case ndn::tlv::DigestSha256:
+        return ndn::security::verifyDigest(data, ndn::DigestAlgorithm::SHA256);
+    case ndn::tlv::SignatureHmacWithSha256:
+        return verifyHmac(data);
+    case ndn::tlv::SignatureSha256WithRsa:
+    case ndn::tlv::SignatureSha256WithEcdsa:
+        return verifyWithTrustedKey(data);
+    default:
+        return false;
+    }
+}
+
+ndn::Name SignatureVerifier::toKeyName(const ndn::Name& keyLocatorName)
+{
+    // Key names have the form /<identity>/KEY/<key-id>, certificate names append /<issuer-id>/<version>
+    for (size_t i = 0; i + 1 < keyLocatorName.size(); i++) {
+        if (keyLocatorName.get(i).toUri() == "KEY") {
+            return keyLocatorName.getPrefix(i + 2);
+        }
+    }
+    return keyLocatorName;
+}
+
+bool SignatureVerifier::verifyHmac(const ndn::Data& data) const
+{
+    if (hmacKey.empty()) {
+        return false;
+    }
+
+    // The signed portion reaches from the name to the end of the SignatureInfo
+    const ndn::Block& wire = data.wireEncode();
+    const ndn::Block& signatureValue = data.getSignature().getValue();
+    size_t signedLength = wire.value_size() - signatureValue.size();
+
+    unsigned char mac[EVP_MAX_MD_SIZE];
+    unsigned int macLength = 0;
+    HMAC(EVP_sha256(), hmacKey.data(), (int)hmacKey.size(), wire.value(), signedLength, mac, &macLength);
+
+    return macLength == signatureValue.value_size()
+        && CRYPTO_memcmp(mac, signatureValue.value(), macLength) == 0;
+}
+
+bool SignatureVerifier::verifyWithTrustedKey(const ndn::Data& data) const
+{
+    if (!data.getSignature().hasKeyLocator()) {
+        return false;
+    }
+    auto key = getValidatedKey(toKeyName(data.getSignature().getKeyLocator().getName()));
+    if (key == nullptr) {
+        spdlog::debug("No trusted key for " + data.getName().toUri());
+        return false;
+    }
+    return ndn::security::verifySignature(data, *key);
+}
+
+std::shared_ptr<const ndn::security::transform::PublicKey> SignatureVerifier::getValidatedKey(
+    const ndn::Name& keyName, unsigned depth) const
+{
+    auto trusted = trustedKeys.find(keyName);
+    if (trusted != trustedKeys.end()) {
+        return trusted->second;
+    }
+
+    ndn::security::v2::Certificate certificate;
+    {
+        std::unique_lock<std::mutex> lck(this->keyCacheMutex);
+        auto validated = validatedKeys.find(keyName);
+        if (validated != validatedKeys.end()) {
+            return validated->second;
+        }
+        auto pending = pendingCertificates.find(keyName);
+        if (pending == pendingCertificates.end() || depth >= MAX_CHAIN_LENGTH) {
+            return nullptr;
+        }
+        certificate = pending->second;
+    }
+
+    // Validate the certificate outside of the lock, other keys stay usable meanwhile
+    if (!certificate.isValid() || !certificate.getSignature().hasKeyLocator()) {
+        spdlog::error("Certificate " + certificate.getName().toUri() + " is expired or has no issuer");
+        return nullptr;
+    }
+    auto issuerKey = getValidatedKey(toKeyName(certificate.getSignature().getKeyLocator().getName()), depth + 1);
+    if (issuerKey == nullptr || !ndn::security::verifySignature(certificate, *issuerKey)) {
+        spdlog::error("Certificate " + certificate.getName().toUri() + " is not issued by a trusted key");
+        return nullptr;
+    }
+
+    auto key = decodeKey(certificate.getPublicKey());
+    {
+        std::unique_lock<std::mutex> lck(this->keyCacheMutex);
+        validatedKeys[keyName] = key;
+    }
+    spdlog::info("Validated certificate " + certificate.getName().toUri());
+    return key;
+}
+
+std::shared_ptr<const ndn::security::transform::PublicKey> SignatureVerifier::decodeKey(const ndn::Buffer& keyBits)
+{
+    auto key = std::make_shared<ndn::security::transform::PublicKey>();
+    key->loadPkcs8(keyBits.data(), keyBits.size());
+    return key;
+}
+
+}
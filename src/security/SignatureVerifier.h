@@ -0,0 +1,82 @@
+#ifndef QUADTREESYNCEVALUATION_SIGNATUREVERIFIER_H
+#define QUADTREESYNCEVALUATION_SIGNATUREVERIFIER_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ndn-cxx/face.hpp>
+#include <ndn-cxx/security/transform/public-key.hpp>
+#include <ndn-cxx/security/v2/certificate.hpp>
+
+namespace quadtree {
+
+/**
+ * Verifies the signatures of received Data packets. Supported are DigestSha256 signatures, HMAC signatures with the
+ * group key and asymmetric signatures of keys whose certificates are configured as trust anchors or are issued by a
+ * trusted key.
+ *
+ * Certificates of other keys are only validated when a packet signed by the key is verified for the first time. The
+ * decoded public keys of validated certificates are cached, so every further packet costs a single signature check.
+ * All methods are thread safe.
+ */
+class SignatureVerifier {
+
+public:
+    /**
+     * @param hmacKey Base64 encoded group key for HMAC signatures, empty if HMAC signatures are not accepted
+     * @param trustAnchorFiles Files containing the (base64 encoded) certificates of trusted keys
+     * @param certificateFiles Files containing certificates which have to be validated before their keys are used
+     */
+    SignatureVerifier(const std::string& hmacKey, const std::vector<std::string>& trustAnchorFiles,
+        const std::vector<std::string>& certificateFiles = std::vector<std::string>());
+
+    /**
+     * Adds a certificate which is validated as soon as a packet signed by its key is verified
+     */
+    void addCertificate(const ndn::security::v2::Certificate& certificate);
+
+    /**
+     * Verifies the signature of the given Data packet
+     * @param data Data packet to verify
+     * @return True if the signature is valid and made with a trusted key
+     */
+    bool verify(const ndn::Data& data) const;
+
+    /**
+     * Returns the name of the key in the given KeyLocator name, which is either a key or a certificate name
+     */
+    static ndn::Name toKeyName(const ndn::Name& keyLocatorName);
+
+protected:
+    bool verifyHmac(const ndn::Data& data) const;
+
+    bool verifyWithTrustedKey(const ndn::Data& data) const;
+
+    /**
+     * Returns the validated public key with the given name. If the key is not validated yet, its certificate is
+     * validated against the trusted keys and the key is cached.
+     * @param depth Number of certificates already followed in the chain
+     * @return The public key or nullptr if no valid certificate chain leads to a trust anchor
+     */
+    std::shared_ptr<const ndn::security::transform::PublicKey> getValidatedKey(
+        const ndn::Name& keyName, unsigned depth = 0) const;
+
+    static std::shared_ptr<const ndn::security::transform::PublicKey> decodeKey(const ndn::Buffer& keyBits);
+
+protected:
+    static const unsigned MAX_CHAIN_LENGTH = 4;
+
+    std::string hmacKey;
+    std::map<ndn::Name, std::shared_ptr<const ndn::security::transform::PublicKey>> trustedKeys;
+
+    mutable std::mutex keyCacheMutex;
+    std::map<ndn::Name, ndn::security::v2::Certificate> pendingCertificates;
+    mutable std::map<ndn::Name, std::shared_ptr<const ndn::security::transform::PublicKey>> validatedKeys;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_SIGNATUREVERIFIER_H
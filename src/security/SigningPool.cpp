@@ -0,0 +1,156 @@
+#include "SigningPool.h"
+
+namespace quadtree {
+
+SigningMode parseSigningMode(const std::string& mode)
+{
+    if (mode == "identity") {
+        return SigningMode::IDENTITY;
+    } else if (mode == "sha256") {
+        return SigningMode::DIGEST_SHA256;
+    } else if (mode == "hmac") {
+        return SigningMode::HMAC;
+    }
+    throw std::invalid_argument("Unknown signing mode " + mode);
+}
+
+std::string signingModeToString(SigningMode mode)
+{
+    switch (mode) {
+    case SigningMode::IDENTITY:
+        return "identity";
+    case SigningMode::DIGEST_SHA256:
+        return "sha256";
+    case SigningMode::HMAC:
+        return "hmac";
+    }
+    return "";
+}
+
+SigningPool::SigningPool(
+    SigningMode mode, const std::string& hmacKey, unsigned numThreads, boost::asio::io_service& ioService)
+    : mode(mode)
+    , ioService(ioService)
+{
+    switch (mode) {
+    case SigningMode::IDENTITY:
+        // Default SigningInfo signs with the default identity
+        break;
+    case SigningMode::DIGEST_SHA256:
+        signingInfo = ndn::security::signingWithSha256();
+        break;
+    case SigningMode::HMAC:
+        if (hmacKey.empty()) {
+            throw std::invalid_argument("HMAC signing requires a group key");
+        }
+        signingInfo.setSigningHmacKey(hmacKey);
+        break;
+    }
+
+    for (unsigned i = 0; i < numThreads; i++) {
+        workers.emplace_back(&SigningPool::work, this);
+    }
+}
+
+SigningPool::~SigningPool()
+{
+    running = false;
+    queueCondition.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void SigningPool::sign(const std::shared_ptr<ndn::Data>& data, const SignedCallback& onSigned)
+{
+    if (workers.empty()) {
+        signSynchronously(*data);
+        ioService.post([onSigned, data] { onSigned(data); });
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lck(this->queueMutex);
+        jobs.push_back({ data, onSigned });
+
+        enqueuedJobs++;
+        totalQueueDepth += jobs.size();
+        maxQueueDepth = std::max(maxQueueDepth, (unsigned long)jobs.size());
+    }
+    queueCondition.notify_one();
+}
+
+void SigningPool::signWithDigest(const std::shared_ptr<ndn::Data>& data, const SignedCallback& onSigned)
+{
+    {
+        std::unique_lock<std::mutex> lck(this->callerKeyChainMutex);
+        if (callerKeyChain == nullptr) {
+            callerKeyChain = std::make_unique<ndn::KeyChain>();
+        }
+        signAndMeasure(*callerKeyChain, *data, ndn::security::signingWithSha256());
+    }
+    ioService.post([onSigned, data] { onSigned(data); });
+}
+
+void SigningPool::signSynchronously(ndn::Data& data)
+{
+    std::unique_lock<std::mutex> lck(this->callerKeyChainMutex);
+    if (callerKeyChain == nullptr) {
+        callerKeyChain = std::make_unique<ndn::KeyChain>();
+    }
+    signAndMeasure(*callerKeyChain, data, signingInfo);
+}
+
+void SigningPool::work()
+{
+    // KeyChains are not thread safe, every worker uses its own one
+    ndn::KeyChain keyChain;
+
+    while (running) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lck(this->queueMutex);
+            queueCondition.wait(lck, [this] { return !jobs.empty() || !running; });
+            if (!running) {
+                return;
+            }
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        signAndMeasure(keyChain, *job.data, signingInfo);
+
+        // Hand the signed packet back to the face thread
+        auto data = job.data;
+        auto onSigned = job.onSigned;
+        ioService.post([onSigned, data] { onSigned(data); });
+    }
+}
+
+void SigningPool::signAndMeasure(ndn::KeyChain& keyChain, ndn::Data& data, const ndn::security::SigningInfo& info)
+{
+    auto start = std::chrono::steady_clock::now();
+    keyChain.sign(data, info);
+    auto latency
+        = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    signedPackets++;
+    totalSignLatencyMicros += latency;
+    unsigned long currentMax = maxSignLatencyMicros;
+    while ((unsigned long)latency > currentMax && !maxSignLatencyMicros.compare_exchange_weak(currentMax, latency)) {
+    }
+}
+
+double SigningPool::getAverageSignLatencyMicros() const
+{
+    return signedPackets == 0 ? 0 : (double)totalSignLatencyMicros / signedPackets;
+}
+
+double SigningPool::getAverageQueueDepth() const
+{
+    return enqueuedJobs == 0 ? 0 : (double)totalQueueDepth / enqueuedJobs;
+}
+
+}
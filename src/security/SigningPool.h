@@ -0,0 +1,118 @@
+#ifndef QUADTREESYNCEVALUATION_SIGNINGPOOL_H
+#define QUADTREESYNCEVALUATION_SIGNINGPOOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ndn-cxx/face.hpp>
+#include <ndn-cxx/security/key-chain.hpp>
+#include <ndn-cxx/security/signing-helpers.hpp>
+
+namespace quadtree {
+
+/**
+ * Signature types a producer can use for its Data packets
+ */
+enum class SigningMode {
+    IDENTITY, // Asymmetric signature (ECDSA or RSA, depending on the key) with the default identity
+    DIGEST_SHA256, // Only a SHA-256 digest, no authenticity
+    HMAC // HMAC-SHA256 with a key shared within the group of servers
+};
+
+SigningMode parseSigningMode(const std::string& mode);
+
+std::string signingModeToString(SigningMode mode);
+
+/**
+ * Signs Data packets on a pool of worker threads. Every worker uses its own KeyChain, so signatures are not
+ * serialized by a global lock. The signed packets are handed back to the thread running the given io_service (the
+ * face thread).
+ *
+ * With zero worker threads, packets are signed on the calling thread.
+ */
+class SigningPool {
+
+public:
+    typedef std::function<void(const std::shared_ptr<ndn::Data>&)> SignedCallback;
+
+    SigningPool(SigningMode mode, const std::string& hmacKey, unsigned numThreads, boost::asio::io_service& ioService);
+
+    ~SigningPool();
+
+    /**
+     * Signs the given Data packet and invokes the callback on the io_service thread afterwards.
+     * @param data Data packet to sign
+     * @param onSigned Callback invoked with the signed Data packet
+     */
+    void sign(const std::shared_ptr<ndn::Data>& data, const SignedCallback& onSigned);
+
+    /**
+     * Signs the given Data packet with a DigestSha256 signature on the calling thread, regardless of the signing mode
+     * of the pool, and invokes the callback on the io_service thread afterwards.
+     * @param data Data packet to sign
+     * @param onSigned Callback invoked with the signed Data packet
+     */
+    void signWithDigest(const std::shared_ptr<ndn::Data>& data, const SignedCallback& onSigned);
+
+    /**
+     * Signs the given Data packet on the calling thread, regardless of the number of worker threads.
+     * @param data Data packet to sign
+     */
+    void signSynchronously(ndn::Data& data);
+
+    SigningMode getMode() const { return mode; }
+
+    unsigned long getSignedPackets() const { return signedPackets; }
+
+    double getAverageSignLatencyMicros() const;
+
+    unsigned long getMaxSignLatencyMicros() const { return maxSignLatencyMicros; }
+
+    double getAverageQueueDepth() const;
+
+    unsigned long getMaxQueueDepth() const { return maxQueueDepth; }
+
+protected:
+    struct Job {
+        std::shared_ptr<ndn::Data> data;
+        SignedCallback onSigned;
+    };
+
+    void work();
+
+    void signAndMeasure(ndn::KeyChain& keyChain, ndn::Data& data, const ndn::security::SigningInfo& info);
+
+protected:
+    SigningMode mode;
+    ndn::security::SigningInfo signingInfo;
+    boost::asio::io_service& ioService;
+
+    std::atomic<bool> running { true };
+    std::vector<std::thread> workers;
+    std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    std::deque<Job> jobs;
+
+    // KeyChain used for signing on the calling thread
+    std::mutex callerKeyChainMutex;
+    std::unique_ptr<ndn::KeyChain> callerKeyChain;
+
+    std::atomic<unsigned long> signedPackets { 0 };
+    std::atomic<unsigned long> totalSignLatencyMicros { 0 };
+    std::atomic<unsigned long> maxSignLatencyMicros { 0 };
+    unsigned long enqueuedJobs = 0;
+    unsigned long totalQueueDepth = 0;
+    unsigned long maxQueueDepth = 0;
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_SIGNINGPOOL_H
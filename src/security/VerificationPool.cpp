@@ -0,0 +1,112 @@
+#include "VerificationPool.h"
+
+namespace quadtree {
+
+VerificationPool::VerificationPool(
+    const SignatureVerifier& verifier, unsigned numThreads, boost::asio::io_service& ioService)
+    : verifier(verifier)
+    , ioService(ioService)
+{
+    for (unsigned i = 0; i < numThreads; i++) {
+        workers.emplace_back(&VerificationPool::work, this);
+    }
+}
+
+VerificationPool::~VerificationPool()
+{
+    running = false;
+    queueCondition.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void VerificationPool::verify(const std::string& stream, const ndn::Data& data, const VerifiedCallback& onVerified)
+{
+    if (workers.empty()) {
+        onVerified(verifyAndMeasure(data));
+        return;
+    }
+
+    unsigned long sequenceNumber;
+    {
+        std::unique_lock<std::mutex> lck(this->streamMutex);
+        Stream& s = streams[stream];
+        sequenceNumber = s.nextSequenceNumber++;
+        s.results[sequenceNumber].onVerified = onVerified;
+    }
+    {
+        std::unique_lock<std::mutex> lck(this->queueMutex);
+        jobs.push_back({ stream, sequenceNumber, data });
+    }
+    queueCondition.notify_one();
+}
+
+void VerificationPool::work()
+{
+    while (running) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lck(this->queueMutex);
+            queueCondition.wait(lck, [this] { return !jobs.empty() || !running; });
+            if (!running) {
+                return;
+            }
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        bool valid = verifyAndMeasure(job.data);
+        release(job.stream, job.sequenceNumber, valid);
+    }
+}
+
+bool VerificationPool::verifyAndMeasure(const ndn::Data& data)
+{
+    auto start = std::chrono::steady_clock::now();
+    bool valid = verifier.verify(data);
+    auto latency
+        = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    verifiedPackets++;
+    if (!valid) {
+        invalidPackets++;
+    }
+    totalVerifyLatencyMicros += latency;
+    unsigned long currentMax = maxVerifyLatencyMicros;
+    while ((unsigned long)latency > currentMax && !maxVerifyLatencyMicros.compare_exchange_weak(currentMax, latency)) {
+    }
+    return valid;
+}
+
+void VerificationPool::release(const std::string& stream, unsigned long sequenceNumber, bool valid)
+{
+    std::unique_lock<std::mutex> lck(this->streamMutex);
+    std::map<unsigned long, Result>& results = streams[stream].results;
+    Result& result = results[sequenceNumber];
+    result.done = true;
+    result.valid = valid;
+
+    if (results.begin()->first != sequenceNumber) {
+        // A packet submitted earlier is still verified
+        reorderedPackets++;
+        return;
+    }
+
+    // Handlers are executed in the order they are posted, so they are posted while holding the lock
+    while (!results.empty() && results.begin()->second.done) {
+        auto onVerified = results.begin()->second.onVerified;
+        bool isValid = results.begin()->second.valid;
+        ioService.post([onVerified, isValid] { onVerified(isValid); });
+        results.erase(results.begin());
+    }
+}
+
+double VerificationPool::getAverageVerifyLatencyMicros() const
+{
+    return verifiedPackets == 0 ? 0 : (double)totalVerifyLatencyMicros / verifiedPackets;
+}
+
+}
@@ -0,0 +1,113 @@
+#ifndef QUADTREESYNCEVALUATION_VERIFICATIONPOOL_H
+#define QUADTREESYNCEVALUATION_VERIFICATIONPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ndn-cxx/face.hpp>
+
+#include "SignatureVerifier.h"
+
+namespace quadtree {
+
+/**
+ * Verifies the signatures of received Data packets on a pool of worker threads, so that the face thread is not blocked
+ * by expensive signature checks.
+ *
+ * Packets are submitted to an ordered stream (e.g. one stream per remote region). Although packets are verified in
+ * parallel, the results of a stream are handed back to the thread running the given io_service (the face thread) in
+ * the order the packets were submitted. Packets verified early are held back until all packets submitted before them
+ * are verified.
+ *
+ * With zero worker threads, packets are verified on the calling thread.
+ */
+class VerificationPool {
+
+public:
+    typedef std::function<void(bool valid)> VerifiedCallback;
+
+    VerificationPool(const SignatureVerifier& verifier, unsigned numThreads, boost::asio::io_service& ioService);
+
+    ~VerificationPool();
+
+    /**
+     * Verifies the given Data packet and invokes the callback with the result on the io_service thread, after the
+     * callbacks of all packets submitted to the same stream before.
+     * @param stream Identifies the stream the packet belongs to
+     * @param data Data packet to verify
+     * @param onVerified Callback invoked with the verification result
+     */
+    void verify(const std::string& stream, const ndn::Data& data, const VerifiedCallback& onVerified);
+
+    unsigned long getVerifiedPackets() const { return verifiedPackets; }
+
+    unsigned long getInvalidPackets() const { return invalidPackets; }
+
+    double getAverageVerifyLatencyMicros() const;
+
+    unsigned long getMaxVerifyLatencyMicros() const { return maxVerifyLatencyMicros; }
+
+    /**
+     * Number of packets which were verified before a packet submitted earlier to the same stream and had to be held
+     * back to keep the order
+     */
+    unsigned long getReorderedPackets() const { return reorderedPackets; }
+
+protected:
+    struct Result {
+        VerifiedCallback onVerified;
+        bool done = false;
+        bool valid = false;
+    };
+
+    struct Stream {
+        unsigned long nextSequenceNumber = 0;
+        std::map<unsigned long, Result> results;
+    };
+
+    struct Job {
+        std::string stream;
+        unsigned long sequenceNumber;
+        ndn::Data data;
+    };
+
+    void work();
+
+    bool verifyAndMeasure(const ndn::Data& data);
+
+    /**
+     * Stores the result of a packet and hands all results which are next in order back to the io_service thread
+     */
+    void release(const std::string& stream, unsigned long sequenceNumber, bool valid);
+
+protected:
+    const SignatureVerifier& verifier;
+    boost::asio::io_service& ioService;
+
+    std::atomic<bool> running { true };
+    std::vector<std::thread> workers;
+    std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    std::deque<Job> jobs;
+
+    std::mutex streamMutex;
+    std::map<std::string, Stream> streams;
+
+    std::atomic<unsigned long> verifiedPackets { 0 };
+    std::atomic<unsigned long> invalidPackets { 0 };
+    std::atomic<unsigned long> totalVerifyLatencyMicros { 0 };
+    std::atomic<unsigned long> maxVerifyLatencyMicros { 0 };
+    std::atomic<unsigned long> reorderedPackets { 0 };
+};
+
+}
+
+#endif // QUADTREESYNCEVALUATION_VERIFICATIONPOOL_H
@@ -0,0 +1,100 @@
+#define CATCH_CONFIG_MAIN
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+
+#include "../src/ChangeJournal.h"
+
+using namespace quadtree;
+
+TEST_CASE("Test ChangeJournal getChangesSince")
+{
+    GIVEN("A journal of three ticks")
+    {
+        Chunk a(Point(0, 0), 1);
+        Chunk b(Point(1, 1), 2);
+        Chunk c(Point(5, 5), 3);
+        Rectangle world(Point(0, 0), Point(8, 8));
+
+        ChangeJournal journal(3);
+        journal.addRevision(1, { &a });
+        journal.addRevision(2, { &b, &c });
+        journal.addRevision(3, { &a });
+
+        WHEN("A consumer knows the latest revision")
+        {
+            auto changes = journal.getChangesSince(3, world);
+            THEN("There are no changes")
+            {
+                REQUIRE(changes.first);
+                REQUIRE(changes.second.empty());
+            }
+        }
+
+        WHEN("A consumer knows a revision the journal does not know yet, e.g. after a restart of the producer")
+        {
+            auto changes = journal.getChangesSince(4, world);
+            THEN("The revision is not covered") { REQUIRE(!changes.first); }
+        }
+
+        WHEN("A consumer is several ticks behind")
+        {
+            auto changes = journal.getChangesSince(1, world);
+            THEN("The changes after its revision are returned")
+            {
+                REQUIRE(changes.first);
+                REQUIRE(changes.second.size() == 3);
+            }
+        }
+
+        WHEN("A chunk changed in several ticks")
+        {
+            auto changes = journal.getChangesSince(0, world);
+            THEN("It is only returned once")
+            {
+                REQUIRE(changes.first);
+                REQUIRE(changes.second.size() == 3);
+                REQUIRE(std::count(changes.second.begin(), changes.second.end(), &a) == 1);
+            }
+        }
+
+        WHEN("Only a part of the world is requested")
+        {
+            auto changes = journal.getChangesSince(0, Rectangle(Point(0, 0), Point(4, 4)));
+            THEN("Only changes within the area are returned")
+            {
+                REQUIRE(changes.first);
+                REQUIRE(changes.second.size() == 2);
+                REQUIRE(std::count(changes.second.begin(), changes.second.end(), &c) == 0);
+            }
+        }
+
+        WHEN("The oldest tick was dropped")
+        {
+            journal.addRevision(4, { &b });
+
+            THEN("The journal still reaches back to the revision before its oldest tick")
+            {
+                auto changes = journal.getChangesSince(1, world);
+                REQUIRE(changes.first);
+                REQUIRE(changes.second.size() == 3);
+            }
+
+            THEN("Older revisions are not covered")
+            {
+                auto changes = journal.getChangesSince(0, world);
+                REQUIRE(!changes.first);
+                REQUIRE(changes.second.empty());
+            }
+        }
+    }
+
+    GIVEN("An empty journal")
+    {
+        ChangeJournal journal(3);
+        THEN("No revision is covered")
+        {
+            REQUIRE(!journal.getChangesSince(0, Rectangle(Point(0, 0), Point(8, 8))).first);
+        }
+    }
+}
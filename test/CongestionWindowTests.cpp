@@ -0,0 +1,88 @@
+#define CATCH_CONFIG_MAIN
+
+#include <catch2/catch.hpp>
+
+#include "../src/CongestionWindow.h"
+
+using namespace quadtree;
+
+TEST_CASE("Test CongestionWindow additive increase")
+{
+    GIVEN("A window of four Interests")
+    {
+        CongestionWindow window(4, 1, 6);
+
+        THEN("Four outstanding Interests are allowed")
+        {
+            REQUIRE(window.allows(3));
+            REQUIRE(!window.allows(4));
+        }
+
+        WHEN("A window of Data packets is received")
+        {
+            for (int i = 0; i < 4; i++) {
+                window.increase();
+            }
+
+            THEN("The window grows by about one Interest")
+            {
+                REQUIRE(window.getWindow() > 4.9);
+                REQUIRE(window.getWindow() < 5);
+                REQUIRE(!window.allows(4));
+            }
+        }
+
+        WHEN("Many Data packets are received")
+        {
+            for (int i = 0; i < 100; i++) {
+                window.increase();
+            }
+
+            THEN("The window is bounded")
+            {
+                REQUIRE(window.getWindow() == Approx(6));
+                REQUIRE(window.allows(5));
+                REQUIRE(!window.allows(6));
+            }
+        }
+    }
+}
+
+TEST_CASE("Test CongestionWindow multiplicative decrease")
+{
+    GIVEN("A window of eight Interests")
+    {
+        CongestionWindow window(8, 0, 16);
+
+        WHEN("A congestion signal arrives")
+        {
+            THEN("The window is halved") { REQUIRE(window.decrease(0)); }
+            REQUIRE(window.getWindow() == Approx(4));
+        }
+
+        WHEN("Further signals of the same congestion event arrive within the round trip time")
+        {
+            REQUIRE(window.decrease(0));
+            THEN("They are ignored")
+            {
+                REQUIRE(!window.decrease(60000));
+                REQUIRE(!window.decrease(60000));
+                REQUIRE(window.getWindow() == Approx(4));
+            }
+        }
+
+        WHEN("Signals of separate congestion events arrive")
+        {
+            for (int i = 0; i < 10; i++) {
+                window.decrease(0);
+            }
+
+            THEN("The window never drops below one Interest")
+            {
+                REQUIRE(window.getWindow() == Approx(1));
+                REQUIRE(window.allows(0));
+                REQUIRE(!window.allows(1));
+            }
+        }
+    }
+}
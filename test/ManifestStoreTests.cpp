@@ -0,0 +1,83 @@
+#define CATCH_CONFIG_MAIN
+
+#include <catch2/catch.hpp>
+
+#include "../src/security/ManifestStore.h"
+
+using namespace quadtree;
+
+TEST_CASE("Test ManifestStore signs every manifest once")
+{
+    GIVEN("A store with two announced responses of a revision")
+    {
+        ManifestStore store;
+        std::vector<std::shared_ptr<const ndn::Data>> answers;
+        auto onManifest = [&answers](const std::shared_ptr<const ndn::Data>& data) { answers.push_back(data); };
+        ResponseManifest manifest;
+
+        store.addPendingDigests(1, 2);
+        store.addDigest(1, ndn::name::Component("first"));
+
+        WHEN("The revision is not sealed yet")
+        {
+            THEN("The manifest is not signed") { REQUIRE(!store.takeManifestToSign(1, manifest)); }
+
+            THEN("Requests for the manifest wait for it")
+            {
+                REQUIRE(store.fetchSignedManifest(1, onManifest));
+                REQUIRE(answers.empty());
+            }
+        }
+
+        WHEN("The revision is sealed before all responses are signed")
+        {
+            store.seal(1);
+
+            THEN("The manifest is signed after the last digest was added")
+            {
+                REQUIRE(!store.takeManifestToSign(1, manifest));
+                store.addDigest(1, ndn::name::Component("second"));
+                REQUIRE(store.takeManifestToSign(1, manifest));
+                REQUIRE(manifest.revision() == 1);
+                REQUIRE(manifest.digests_size() == 2);
+                REQUIRE(!store.takeManifestToSign(1, manifest));
+            }
+        }
+
+        WHEN("The manifest is signed")
+        {
+            REQUIRE(store.fetchSignedManifest(1, onManifest));
+            store.addDigest(1, ndn::name::Component("second"));
+            store.seal(1);
+            REQUIRE(store.takeManifestToSign(1, manifest));
+            auto data = std::make_shared<const ndn::Data>(ManifestStore::manifestName(ndn::Name("/world/0"), 1));
+            store.setSignedManifest(1, data);
+
+            THEN("Waiting and later requests are answered with the signed manifest")
+            {
+                REQUIRE(answers.size() == 1);
+                REQUIRE(store.fetchSignedManifest(1, onManifest));
+                REQUIRE(answers.size() == 2);
+                REQUIRE(answers.back() == data);
+            }
+        }
+
+        WHEN("Requests ask for a revision without responses")
+        {
+            store.seal(2);
+            THEN("They are not answered")
+            {
+                REQUIRE(!store.fetchSignedManifest(2, onManifest));
+                REQUIRE(!store.takeManifestToSign(2, manifest));
+            }
+        }
+
+        WHEN("Responses of newer revisions are announced")
+        {
+            store.addPendingDigests(2, 1);
+            store.addPendingDigests(3, 1);
+
+            THEN("Manifests of older revisions are dropped") { REQUIRE(!store.fetchSignedManifest(1, onManifest)); }
+        }
+    }
+}
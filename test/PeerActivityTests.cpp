@@ -0,0 +1,86 @@
+#define CATCH_CONFIG_MAIN
+
+#include <catch2/catch.hpp>
+
+#include "../src/PeerActivity.h"
+
+using namespace quadtree;
+
+TEST_CASE("Test PeerActivity heartbeat timeouts")
+{
+    GIVEN("A remote region with a heartbeat timeout of 200ms")
+    {
+        auto created = std::chrono::steady_clock::now();
+        PeerActivity activity(std::chrono::milliseconds(200), std::chrono::milliseconds(400), created);
+
+        THEN("The region is polled before the first heartbeat arrived")
+        {
+            REQUIRE(!activity.hasRecentHeartbeat(created));
+        }
+
+        WHEN("A heartbeat arrives")
+        {
+            activity.addHeartbeat(created + std::chrono::milliseconds(100));
+
+            THEN("The region is not polled until the timeout passed")
+            {
+                REQUIRE(activity.hasRecentHeartbeat(created + std::chrono::milliseconds(299)));
+                REQUIRE(!activity.hasRecentHeartbeat(created + std::chrono::milliseconds(300)));
+            }
+
+            THEN("Every further heartbeat extends the timeout")
+            {
+                activity.addHeartbeat(created + std::chrono::milliseconds(250));
+                REQUIRE(activity.hasRecentHeartbeat(created + std::chrono::milliseconds(400)));
+            }
+        }
+    }
+}
+
+TEST_CASE("Test PeerActivity passive regions")
+{
+    GIVEN("Two producers of neighbouring regions")
+    {
+        ndn::Name first("/world/0/1");
+        ndn::Name second("/world/0/2");
+
+        THEN("Exactly one of them polls the other one")
+        {
+            REQUIRE(PeerActivity::isPassiveRegion(first, second));
+            REQUIRE(!PeerActivity::isPassiveRegion(second, first));
+        }
+    }
+
+    GIVEN("A remote region with a peer state timeout of 400ms")
+    {
+        auto created = std::chrono::steady_clock::now();
+        PeerActivity activity(std::chrono::milliseconds(200), std::chrono::milliseconds(400), created);
+
+        WHEN("The region is active")
+        {
+            THEN("It is polled, even if its producer sent its state")
+            {
+                activity.addPeerState(created);
+                REQUIRE(!activity.isPolledByPeer(created));
+            }
+        }
+
+        WHEN("The region is passive")
+        {
+            activity.setPassive(true);
+
+            THEN("It is not polled before its producer had the chance to poll")
+            {
+                REQUIRE(activity.isPolledByPeer(created + std::chrono::milliseconds(399)));
+                REQUIRE(!activity.isPolledByPeer(created + std::chrono::milliseconds(400)));
+            }
+
+            THEN("It is not polled while its producer sends its state")
+            {
+                activity.addPeerState(created + std::chrono::milliseconds(300));
+                REQUIRE(activity.isPolledByPeer(created + std::chrono::milliseconds(600)));
+                REQUIRE(!activity.isPolledByPeer(created + std::chrono::milliseconds(700)));
+            }
+        }
+    }
+}
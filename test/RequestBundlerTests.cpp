@@ -0,0 +1,101 @@
+#define CATCH_CONFIG_MAIN
+
+#include <catch2/catch.hpp>
+
+#include "../src/RequestBundler.h"
+#include "../src/SyncTree.h"
+
+using namespace quadtree;
+
+TEST_CASE("Test RequestBundler bundles queued subtree requests")
+{
+    GIVEN("A queue of four subtree requests")
+    {
+        Rectangle area(Point(0, 0), Point(64, 64));
+        SyncTree first(area), second(area), third(area), fourth(area);
+        SyncTree *a = &first, *b = &second, *c = &third, *d = &fourth;
+        std::deque<SyncTree*> queued = { a, b, c, d };
+        std::set<SyncTree*> unaggregated;
+        RequestBundler bundler(3);
+
+        WHEN("The region may issue enough requests")
+        {
+            std::vector<SyncTree*> bundle = bundler.takeBundle(queued, unaggregated, 10);
+
+            THEN("The first subtrees up to the maximum are bundled and removed from the queue")
+            {
+                REQUIRE(bundle == std::vector<SyncTree*>({ a, b, c }));
+                REQUIRE(queued == std::deque<SyncTree*>({ d }));
+            }
+        }
+
+        WHEN("The region may only issue two requests")
+        {
+            std::vector<SyncTree*> bundle = bundler.takeBundle(queued, unaggregated, 2);
+
+            THEN("Only two subtrees are bundled") { REQUIRE(bundle == std::vector<SyncTree*>({ a, b })); }
+        }
+
+        WHEN("Subtrees have to be requested with plain Interests")
+        {
+            unaggregated = { a, c };
+            std::vector<SyncTree*> bundle = bundler.takeBundle(queued, unaggregated, 10);
+
+            THEN("They are skipped and stay queued in order")
+            {
+                REQUIRE(bundle == std::vector<SyncTree*>({ b, d }));
+                REQUIRE(queued == std::deque<SyncTree*>({ a, c }));
+            }
+        }
+
+        WHEN("Only a single subtree could be bundled")
+        {
+            unaggregated = { a, b, c };
+            std::vector<SyncTree*> unaggregatedBundle = bundler.takeBundle(queued, unaggregated, 10);
+            unaggregated.clear();
+            std::vector<SyncTree*> smallBundle = bundler.takeBundle(queued, unaggregated, 1);
+
+            THEN("Nothing is bundled and the queue is unchanged")
+            {
+                REQUIRE(unaggregatedBundle.empty());
+                REQUIRE(smallBundle.empty());
+                REQUIRE(queued == std::deque<SyncTree*>({ a, b, c, d }));
+            }
+        }
+    }
+}
+
+TEST_CASE("Test RequestBundler splits aggregated responses")
+{
+    GIVEN("An aggregated response of at most 1000 bytes")
+    {
+        RequestBundler::ResponseBudget budget(1000);
+        REQUIRE(budget.getRemaining() == 1000 - RequestBundler::ResponseBudget::OVERHEAD);
+
+        WHEN("Subtree responses are added")
+        {
+            REQUIRE(budget.add(400));
+            REQUIRE(budget.add(400));
+
+            THEN("The remaining budget shrinks by the responses and their overhead")
+            {
+                REQUIRE(budget.getSize() == 800 + 2 * RequestBundler::ResponseBudget::OVERHEAD);
+                REQUIRE(budget.getRemaining() == 200 - 3 * RequestBundler::ResponseBudget::OVERHEAD);
+            }
+
+            THEN("Responses which do not fit are omitted, smaller ones are still added")
+            {
+                REQUIRE(!budget.add(200));
+                REQUIRE(budget.getSize() == 800 + 2 * RequestBundler::ResponseBudget::OVERHEAD);
+                REQUIRE(budget.add(budget.getRemaining()));
+                REQUIRE(budget.getSize() == 1000);
+                REQUIRE(budget.getRemaining() == 0);
+            }
+        }
+
+        WHEN("A single response is larger than the packet")
+        {
+            THEN("It is omitted") { REQUIRE(!budget.add(1000)); }
+        }
+    }
+}
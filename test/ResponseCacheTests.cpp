@@ -0,0 +1,139 @@
+#define CATCH_CONFIG_MAIN
+
+#include <catch2/catch.hpp>
+
+#include "../src/ResponseCache.h"
+
+using namespace quadtree;
+
+static ResponseCache::Segments createSegments(const std::string& name)
+{
+    return ResponseCache::Segments { std::make_shared<const ndn::Data>(ndn::Name(name)) };
+}
+
+TEST_CASE("Test ResponseCache computes every response once")
+{
+    GIVEN("An empty cache")
+    {
+        ResponseCache cache;
+        ResponseCache::Key key(ndn::Name("/world/0"), 42, 1);
+        std::vector<ResponseCache::Segments> responses;
+        auto onResponse = [&responses](const ResponseCache::Segments& segments) { responses.push_back(segments); };
+
+        WHEN("The first requester asks for a response")
+        {
+            THEN("It has to compute the response") { REQUIRE(cache.fetchOrJoin(key, onResponse)); }
+            REQUIRE(cache.getMisses() == 1);
+            REQUIRE(responses.empty());
+        }
+
+        WHEN("Further requesters ask while the response is computed")
+        {
+            REQUIRE(cache.fetchOrJoin(key, onResponse));
+            REQUIRE(!cache.fetchOrJoin(key, onResponse));
+            REQUIRE(cache.join(key, onResponse));
+            REQUIRE(cache.getJoinedRequests() == 2);
+
+            THEN("All requesters are answered when the response is completed")
+            {
+                REQUIRE(responses.empty());
+                auto segments = createSegments("/world/0/response");
+                cache.complete(key, segments);
+                REQUIRE(responses.size() == 3);
+                for (const auto& response : responses) {
+                    REQUIRE(response == segments);
+                }
+            }
+
+            THEN("All requesters are dropped if the computation failed")
+            {
+                cache.complete(key, ResponseCache::Segments());
+                REQUIRE(responses.empty());
+                // The next requester computes the response again
+                REQUIRE(cache.fetchOrJoin(key, onResponse));
+            }
+        }
+
+        WHEN("A response was completed")
+        {
+            auto segments = createSegments("/world/0/response");
+            REQUIRE(cache.fetchOrJoin(key, onResponse));
+            cache.complete(key, segments);
+
+            THEN("Later requesters are answered immediately from the cache")
+            {
+                REQUIRE(!cache.fetchOrJoin(key, onResponse));
+                REQUIRE(cache.join(key, onResponse));
+                REQUIRE(cache.getHits() == 2);
+                REQUIRE(responses.size() == 3);
+                REQUIRE(responses.back() == segments);
+            }
+
+            THEN("Requests for other keys are not answered")
+            {
+                ResponseCache::Key otherHash(ndn::Name("/world/0"), 43, 1);
+                ResponseCache::Key otherSubtree(ndn::Name("/world/1"), 42, 1);
+                REQUIRE(!cache.join(otherHash, onResponse));
+                REQUIRE(cache.fetchOrJoin(otherSubtree, onResponse));
+                REQUIRE(responses.size() == 1);
+            }
+        }
+
+        WHEN("Further segments are requested for an unknown response")
+        {
+            THEN("The requester is not asked to compute them") { REQUIRE(!cache.join(key, onResponse)); }
+            REQUIRE(cache.getMisses() == 0);
+        }
+    }
+}
+
+TEST_CASE("Test ResponseCache invalidation keeps the previous revision")
+{
+    GIVEN("A cache with responses of three revisions")
+    {
+        ResponseCache cache;
+        std::vector<ResponseCache::Segments> responses;
+        auto onResponse = [&responses](const ResponseCache::Segments& segments) { responses.push_back(segments); };
+
+        for (unsigned long revision = 1; revision <= 3; revision++) {
+            cache.invalidate(revision);
+            ResponseCache::Key key(ndn::Name("/world/0"), 42, revision);
+            REQUIRE(cache.fetchOrJoin(key, onResponse));
+            cache.complete(key, createSegments("/world/0/response"));
+        }
+        responses.clear();
+
+        WHEN("The tree is rehashed to the next revision")
+        {
+            cache.invalidate(4);
+
+            THEN("Responses of the current and the previous revision are kept")
+            {
+                REQUIRE(cache.join(ResponseCache::Key(ndn::Name("/world/0"), 42, 3), onResponse));
+                REQUIRE(responses.size() == 1);
+            }
+
+            THEN("Older responses are removed")
+            {
+                REQUIRE(!cache.join(ResponseCache::Key(ndn::Name("/world/0"), 42, 2), onResponse));
+                REQUIRE(!cache.join(ResponseCache::Key(ndn::Name("/world/0"), 42, 1), onResponse));
+                REQUIRE(responses.empty());
+            }
+        }
+
+        WHEN("A response of an outdated revision is completed")
+        {
+            ResponseCache::Key key(ndn::Name("/world/1"), 42, 3);
+            REQUIRE(cache.fetchOrJoin(key, onResponse));
+            REQUIRE(!cache.fetchOrJoin(key, onResponse));
+            cache.invalidate(5);
+            cache.complete(key, createSegments("/world/1/response"));
+
+            THEN("The waiting requesters are answered, but the response is not stored")
+            {
+                REQUIRE(responses.size() == 2);
+                REQUIRE(!cache.join(key, onResponse));
+            }
+        }
+    }
+}
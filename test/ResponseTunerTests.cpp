@@ -0,0 +1,78 @@
+#define CATCH_CONFIG_MAIN
+
+#include <catch2/catch.hpp>
+
+#include "../src/ResponseTuner.h"
+#include "../src/SyncTree.h"
+
+using namespace quadtree;
+
+TEST_CASE("Test ResponseTuner retune")
+{
+    GIVEN("A tuner with a hot and a cold subtree")
+    {
+        const ResponseTuner::Parameters defaults { 2, 100 };
+        ResponseTuner tuner(defaults);
+        SyncTree hot(Rectangle(Point(0, 0), Point(4, 4)));
+        SyncTree cold(Rectangle(Point(4, 0), Point(8, 4)));
+        tuner.addSubtree(&hot, 5);
+        tuner.addSubtree(&cold, 5);
+
+        WHEN("Nothing was observed")
+        {
+            THEN("The default parameters are kept")
+            {
+                REQUIRE(tuner.retune(1) == 0);
+                REQUIRE(tuner.getParameters(&hot).chunkThreshold == defaults.chunkThreshold);
+                REQUIRE(tuner.getParameters(&hot).lowerLevels == defaults.lowerLevels);
+            }
+        }
+
+        WHEN("Unknown subtrees are looked up")
+        {
+            SyncTree unknown(Rectangle(Point(0, 4), Point(4, 8)));
+            THEN("The default parameters are returned")
+            {
+                REQUIRE(tuner.getParameters(&unknown).chunkThreshold == defaults.chunkThreshold);
+            }
+        }
+
+        WHEN("Many chunks of one subtree change in every tick")
+        {
+            for (int tick = 0; tick < 20; tick++) {
+                tuner.addTickChanges(&hot, 500);
+                tuner.addTickChanges(&cold, 2);
+            }
+            REQUIRE(tuner.retune(1) == 1);
+
+            THEN("The changes of the hot subtree are sent as chunks right away")
+            {
+                REQUIRE(tuner.getParameters(&hot).chunkThreshold >= 500);
+            }
+
+            THEN("The cold subtree keeps its parameters")
+            {
+                REQUIRE(tuner.getParameters(&cold).chunkThreshold == defaults.chunkThreshold);
+            }
+
+            THEN("The parameters are stable while the observations do not change")
+            {
+                REQUIRE(tuner.retune(1) == 0);
+            }
+        }
+
+        WHEN("Consumers request a subtree with few changes per tick rarely")
+        {
+            for (int tick = 0; tick < 20; tick++) {
+                tuner.addTickChanges(&hot, 50);
+            }
+
+            THEN("The changes accumulated between two requests are considered")
+            {
+                REQUIRE(tuner.retune(1) == 0);
+                REQUIRE(tuner.retune(10) == 1);
+                REQUIRE(tuner.getParameters(&hot).chunkThreshold >= 500);
+            }
+        }
+    }
+}
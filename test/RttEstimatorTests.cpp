@@ -0,0 +1,107 @@
+#define CATCH_CONFIG_MAIN
+
+#include <catch2/catch.hpp>
+
+#include "../src/RttEstimator.h"
+
+using namespace quadtree;
+
+TEST_CASE("Test RttEstimator follows RFC 6298")
+{
+    GIVEN("An estimator without samples")
+    {
+        RttEstimator estimator(1000, 200, 60000);
+
+        THEN("The initial retransmission timeout is used") { REQUIRE(estimator.getRto() == Approx(1000)); }
+
+        WHEN("The first sample is added")
+        {
+            estimator.addMeasurement(400);
+
+            THEN("SRTT is set to the sample and RTTVAR to half of it")
+            {
+                REQUIRE(estimator.getSmoothedRtt() == Approx(400));
+                REQUIRE(estimator.getRttVariation() == Approx(200));
+                // RTO = SRTT + max(G, K * RTTVAR)
+                REQUIRE(estimator.getRto() == Approx(1200));
+            }
+        }
+
+        WHEN("A second sample is added")
+        {
+            estimator.addMeasurement(400);
+            estimator.addMeasurement(800);
+
+            THEN("RTTVAR is updated with the old SRTT before SRTT is updated")
+            {
+                // RTTVAR = 3/4 * 200 + 1/4 * |400 - 800|, SRTT = 7/8 * 400 + 1/8 * 800
+                REQUIRE(estimator.getRttVariation() == Approx(250));
+                REQUIRE(estimator.getSmoothedRtt() == Approx(450));
+                REQUIRE(estimator.getRto() == Approx(1450));
+            }
+        }
+
+        WHEN("Samples are very small or very large")
+        {
+            THEN("The retransmission timeout is bounded")
+            {
+                estimator.addMeasurement(10);
+                REQUIRE(estimator.getRto() == Approx(200));
+                for (int i = 0; i < 100; i++) {
+                    estimator.addMeasurement(100000);
+                }
+                REQUIRE(estimator.getRto() == Approx(60000));
+            }
+        }
+
+        WHEN("The samples do not vary")
+        {
+            for (int i = 0; i < 200; i++) {
+                estimator.addMeasurement(300);
+            }
+
+            THEN("The clock granularity is the minimum variation term")
+            {
+                REQUIRE(estimator.getRttVariation() < 0.25);
+                REQUIRE(estimator.getRto() == Approx(301).epsilon(0.001));
+            }
+        }
+    }
+}
+
+TEST_CASE("Test RttEstimator backoff")
+{
+    GIVEN("An estimator with a sample")
+    {
+        RttEstimator estimator(1000, 200, 5000);
+        estimator.addMeasurement(400);
+        REQUIRE(estimator.getRto() == Approx(1200));
+
+        WHEN("Timeouts occur")
+        {
+            estimator.backoffRto();
+            REQUIRE(estimator.getRto() == Approx(2400));
+            estimator.backoffRto();
+
+            THEN("The retransmission timeout is doubled up to the maximum")
+            {
+                REQUIRE(estimator.getRto() == Approx(4800));
+                estimator.backoffRto();
+                REQUIRE(estimator.getRto() == Approx(5000));
+            }
+
+            THEN("Backing off does not change the round trip time estimation")
+            {
+                REQUIRE(estimator.getSmoothedRtt() == Approx(400));
+                REQUIRE(estimator.getRttVariation() == Approx(200));
+            }
+
+            THEN("The next sample of a request that was not retransmitted collapses the backoff")
+            {
+                // Karn's algorithm: the retransmitted request is not sampled, the next fresh one is
+                estimator.addMeasurement(400);
+                REQUIRE(estimator.getRto() == Approx(400 + 4 * 150));
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+#define CATCH_CONFIG_MAIN
+
+#include <catch2/catch.hpp>
+
+#include "../src/SegmentWindow.h"
+
+using namespace quadtree;
+
+TEST_CASE("Test SegmentWindow keeps a window of segments in flight")
+{
+    GIVEN("A response with six segments and a window of two Interests")
+    {
+        SegmentWindow window(5, 2, 2);
+
+        THEN("The first two segments after the received first one are requested")
+        {
+            REQUIRE(window.takeNextSegments() == std::vector<uint64_t>({ 1, 2 }));
+            REQUIRE(window.takeNextSegments().empty());
+            REQUIRE(!window.isComplete());
+        }
+
+        WHEN("A segment is received")
+        {
+            window.takeNextSegments();
+            REQUIRE(window.receive(2));
+
+            THEN("The next segment is requested")
+            {
+                REQUIRE(window.takeNextSegments() == std::vector<uint64_t>({ 3 }));
+            }
+
+            THEN("Duplicates and segments which were not requested are ignored")
+            {
+                REQUIRE(!window.receive(2));
+                REQUIRE(!window.receive(4));
+            }
+        }
+
+        WHEN("All segments are received")
+        {
+            for (uint64_t segment = 1; segment <= 5; segment++) {
+                window.takeNextSegments();
+                REQUIRE(window.receive(segment));
+            }
+
+            THEN("The fetch is complete")
+            {
+                REQUIRE(window.takeNextSegments().empty());
+                REQUIRE(window.isComplete());
+            }
+        }
+    }
+
+    GIVEN("A window of zero Interests")
+    {
+        SegmentWindow window(3, 0, 2);
+
+        THEN("One segment is requested at a time")
+        {
+            REQUIRE(window.takeNextSegments() == std::vector<uint64_t>({ 1 }));
+        }
+    }
+}
+
+TEST_CASE("Test SegmentWindow retries")
+{
+    GIVEN("A fetch with two retries per segment")
+    {
+        SegmentWindow window(5, 2, 2);
+        window.takeNextSegments();
+
+        WHEN("A segment times out repeatedly")
+        {
+            THEN("It is requested again twice, then the fetch is aborted")
+            {
+                REQUIRE(window.retry(1));
+                REQUIRE(window.retry(1));
+                REQUIRE(!window.retry(1));
+            }
+
+            THEN("The retries of other segments are counted separately")
+            {
+                REQUIRE(window.retry(1));
+                REQUIRE(window.retry(1));
+                REQUIRE(window.retry(2));
+            }
+        }
+    }
+}
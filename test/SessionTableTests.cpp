@@ -0,0 +1,109 @@
+#define CATCH_CONFIG_MAIN
+
+#include <catch2/catch.hpp>
+
+#include "../src/SessionTable.h"
+
+using namespace quadtree;
+
+TEST_CASE("Test SessionTable acknowledgements")
+{
+    GIVEN("A session with an acknowledged subtree")
+    {
+        SessionTable table(10, 3, std::chrono::milliseconds(60000));
+        REQUIRE(table.acknowledge(1, ndn::Name("/0/1"), 5) == 5);
+
+        WHEN("Lower subtrees are requested")
+        {
+            THEN("The consumer holds the revision of the containing subtree")
+            {
+                REQUIRE(table.acknowledge(1, ndn::Name("/0/1/2"), 0) == 5);
+                REQUIRE(table.acknowledge(1, ndn::Name("/0/1/2/3"), 3) == 5);
+                REQUIRE(table.acknowledge(1, ndn::Name("/0/1/2"), 7) == 7);
+            }
+        }
+
+        WHEN("Other subtrees are requested")
+        {
+            THEN("The consumer holds no revision of them")
+            {
+                REQUIRE(table.acknowledge(1, ndn::Name("/0/2"), 0) == 0);
+                REQUIRE(table.acknowledge(1, ndn::Name("/0"), 0) == 0);
+            }
+        }
+
+        WHEN("An older revision is acknowledged")
+        {
+            THEN("The latest revision is kept") { REQUIRE(table.acknowledge(1, ndn::Name("/0/1"), 4) == 5); }
+        }
+
+        WHEN("Another session requests the subtree")
+        {
+            THEN("The acknowledgement of the first session is not used")
+            {
+                REQUIRE(table.acknowledge(2, ndn::Name("/0/1"), 0) == 0);
+                REQUIRE(table.size() == 2);
+            }
+        }
+
+        WHEN("More subtrees are acknowledged than stored per session")
+        {
+            table.acknowledge(1, ndn::Name("/0/2"), 6);
+            table.acknowledge(1, ndn::Name("/0/3"), 7);
+            table.acknowledge(1, ndn::Name("/1/0"), 8);
+
+            THEN("The oldest acknowledgement is dropped")
+            {
+                REQUIRE(table.acknowledge(1, ndn::Name("/0/1"), 0) == 0);
+                REQUIRE(table.acknowledge(1, ndn::Name("/0/2"), 0) == 6);
+            }
+        }
+    }
+}
+
+TEST_CASE("Test SessionTable expiry")
+{
+    GIVEN("A table of two sessions")
+    {
+        SessionTable table(2, 3, std::chrono::milliseconds(60000));
+        table.acknowledge(1, ndn::Name("/0"), 5);
+        table.acknowledge(2, ndn::Name("/0"), 6);
+
+        WHEN("A third session is added after the first one sent another request")
+        {
+            table.acknowledge(1, ndn::Name("/1"), 0);
+            table.acknowledge(3, ndn::Name("/0"), 7);
+
+            THEN("The least recently used session is dropped")
+            {
+                REQUIRE(table.size() == 2);
+                REQUIRE(table.getExpiredSessions() == 1);
+                REQUIRE(table.acknowledge(1, ndn::Name("/0"), 0) == 5);
+                REQUIRE(table.acknowledge(3, ndn::Name("/0"), 0) == 7);
+            }
+        }
+    }
+
+    GIVEN("A table whose sessions expire immediately")
+    {
+        SessionTable table(10, 3, std::chrono::milliseconds(0));
+        table.acknowledge(1, ndn::Name("/0"), 5);
+
+        WHEN("A new session sends a request")
+        {
+            table.acknowledge(2, ndn::Name("/0"), 0);
+
+            THEN("The expired sessions are dropped")
+            {
+                REQUIRE(table.size() == 1);
+                REQUIRE(table.getExpiredSessions() == 1);
+                REQUIRE(table.acknowledge(1, ndn::Name("/0"), 0) == 0);
+            }
+        }
+
+        WHEN("An existing session sends a request")
+        {
+            THEN("It keeps its acknowledgements") { REQUIRE(table.acknowledge(1, ndn::Name("/0"), 0) == 5); }
+        }
+    }
+}
@@ -6,6 +6,7 @@
 
 #include <catch2/catch.hpp>
 #include <math.h>
+#include <set>
 
 #include "../src/SyncTree.h"
 
@@ -727,6 +728,60 @@ TEST_CASE("Correctly create and apply SyncResponse message")
                 REQUIRE(response.curhash() == originalTree.getHash());
                 REQUIRE(response.treelevel() == 3);
             }
+
+            THEN("A rehash should record the publish revision for the changed subtrees only")
+            {
+                originalTree.change(40, 40);
+                originalTree.reHash(false, 5);
+                REQUIRE(originalTree.getRevision() == 5);
+                REQUIRE(originalTree.getSubtree(Rectangle(Point(32, 32), Point(64, 64)))->getRevision() == 5);
+                REQUIRE(originalTree.getSubtree(Rectangle(Point(0, 0), Point(32, 32)))->getRevision() == 0);
+            }
+
+            THEN("A sync request since the previous revision should return the changes, and the cloned tree should "
+                 "remember the revision of the response after applying it")
+            {
+                std::pair<bool, std::vector<Chunk*>> changes = originalTree.getChanges(clonedTree.getHash());
+                REQUIRE(changes.first);
+
+                SyncResponse response = originalTree.prepareRevisionSyncResponse(changes, 3, 100);
+                REQUIRE(response.chunkdata());
+                REQUIRE(response.chunks_size() == 3);
+                REQUIRE(response.hashknown());
+
+                SyncResponse hashResponse = originalTree.prepareRevisionSyncResponse(changes, 3, 2);
+                REQUIRE(!hashResponse.chunkdata());
+                REQUIRE(hashResponse.hashvalues_size() == 16);
+                REQUIRE(hashResponse.treelevel() == 3);
+
+                // Set by the producer
+                response.set_subtreerevision(7);
+                auto applyResult = clonedTree.applySyncResponse(response);
+                REQUIRE(applyResult.first);
+                REQUIRE(clonedTree.getHash() == originalTree.getHash());
+                REQUIRE(clonedTree.getRemoteRevision() == 7);
+            }
+
+            THEN("A sync request since a revision older than the change journal should be treated as unknown")
+            {
+                const std::pair<bool, std::vector<Chunk*>> unknown(false, std::vector<Chunk*>());
+
+                SyncResponse response = originalTree.prepareRevisionSyncResponse(unknown, 3, 5000);
+                REQUIRE(response.chunkdata());
+                REQUIRE(!response.hashknown());
+                REQUIRE(response.chunks_size() == 3);
+
+                // Same lower level hash values as for an unknown hash value
+                SyncResponse hashResponse = originalTree.prepareRevisionSyncResponse(unknown, 3, 100);
+                SyncResponse unknownHashResponse = originalTree.prepareSyncResponse(42, 3, 100);
+                REQUIRE(!unknownHashResponse.hashknown());
+                REQUIRE(!hashResponse.chunkdata());
+                REQUIRE(!hashResponse.hashknown());
+                REQUIRE(hashResponse.treelevel() == unknownHashResponse.treelevel());
+                REQUIRE(hashResponse.treelevel() == 6);
+                REQUIRE(hashResponse.hashvalues_size() == unknownHashResponse.hashvalues_size());
+                REQUIRE(hashResponse.hashvalues_size() == 1024);
+            }
         }
 
         WHEN("The original tree is changed, rehashed and a SyncResponse from the cloned tree is created")
@@ -800,6 +855,108 @@ TEST_CASE("Correctly create and apply SyncResponse message")
                 REQUIRE(largeSyncResponse.chunkdata());
                 REQUIRE(largeSyncResponse.chunks_size() == 50 * 50);
             }
+            THEN("a large sync response split into segments can be applied segment by segment in any order")
+            {
+                SyncResponse largeSyncResponse = originalTree.prepareSyncResponse(clonedTree.getHash(), 3, 65 * 65);
+                auto segments = SyncTree::splitSyncResponse(largeSyncResponse, 1000);
+                REQUIRE(segments.size() > 1);
+
+                int numChunks = 0;
+                for (const auto& segment : segments) {
+                    REQUIRE(segment.ByteSizeLong() <= 1000);
+                    REQUIRE(segment.curhash() == largeSyncResponse.curhash());
+                    numChunks += segment.chunks_size();
+                }
+                REQUIRE(numChunks == 50 * 50);
+
+                std::pair<bool, std::vector<SyncTree*>> applyResult;
+                for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+                    REQUIRE(!applyResult.first);
+                    applyResult = clonedTree.applySyncResponse(*it);
+                }
+                REQUIRE(applyResult.first);
+                REQUIRE(clonedTree.getHash() == originalTree.getHash());
+            }
+            THEN("a snapshot should contain all chunks in Morton order and bring the cloned tree in sync at once")
+            {
+                REQUIRE(Point::fromMorton(Point(37, 12).toMorton()) == Point(37, 12));
+                REQUIRE(Point(1, 0).toMorton() == 1);
+                REQUIRE(Point(0, 1).toMorton() == 2);
+
+                SyncResponse snapshotResponse = originalTree.prepareSnapshotResponse(3);
+                REQUIRE(!snapshotResponse.chunkdata());
+                REQUIRE(snapshotResponse.chunks_size() == 0);
+                REQUIRE(snapshotResponse.hashvalues_size() == 16);
+                REQUIRE(snapshotResponse.snapshot().mortondeltas_size() == 50 * 50);
+                REQUIRE(snapshotResponse.snapshot().versions_size() == 50 * 50);
+                REQUIRE(snapshotResponse.snapshot().chunkcounts(0) == 16 * 16);
+
+                auto applyResult = clonedTree.applySyncResponse(snapshotResponse);
+                REQUIRE(applyResult.first);
+                REQUIRE(applyResult.second.empty());
+                REQUIRE(clonedTree.getHash() == originalTree.getHash());
+            }
+            THEN("a snapshot split into segments can be applied segment by segment in any order")
+            {
+                SyncResponse snapshotResponse = originalTree.prepareSnapshotResponse(3);
+                auto segments = SyncTree::splitSyncResponse(snapshotResponse, 1000);
+                REQUIRE(segments.size() > 1);
+
+                int numChunks = 0;
+                for (const auto& segment : segments) {
+                    REQUIRE(segment.ByteSizeLong() <= 1000);
+                    numChunks += segment.snapshot().versions_size();
+                }
+                REQUIRE(numChunks == 50 * 50);
+
+                std::pair<bool, std::vector<SyncTree*>> applyResult;
+                for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+                    REQUIRE(!applyResult.first);
+                    applyResult = clonedTree.applySyncResponse(*it);
+                    REQUIRE(applyResult.second.empty());
+                }
+                REQUIRE(applyResult.first);
+                REQUIRE(clonedTree.getHash() == originalTree.getHash());
+            }
+        }
+
+        WHEN("the cloned tree is bulk loaded with the chunks of the original tree in arbitrary order")
+        {
+            std::vector<Chunk> chunks;
+            for (unsigned i = 0; i < 40; i++) {
+                for (unsigned j = 0; j < 20; j++) {
+                    Chunk* chunk = originalTree.change((i * 7) % 64, (j * 13 + i) % 64);
+                    chunks.push_back(*chunk);
+                }
+            }
+            // An outdated version of a chunk is overwritten by the later one
+            chunks.push_back(Chunk(Point(5, 5), 1));
+            originalTree.change(5, 5, 3);
+            originalTree.reHash();
+            std::reverse(chunks.begin(), chunks.end());
+            chunks.push_back(Chunk(Point(5, 5), 3));
+            clonedTree.bulkLoad(chunks);
+
+            THEN("both trees should have identical hash values and inflated chunks, but no recorded changes")
+            {
+                REQUIRE(clonedTree.getHash() == originalTree.getHash());
+                REQUIRE(clonedTree.countInflatedChunks() == originalTree.countInflatedChunks());
+                REQUIRE(clonedTree.getChanges(clonedTree.getHash()).second.empty());
+
+                clonedTree.reHash();
+                REQUIRE(clonedTree.getHash() == originalTree.getHash());
+            }
+
+            THEN("bulk loading a subtree should update the hash values of its parents")
+            {
+                SyncTree* subtree = clonedTree.getSubtree(Rectangle(Point(0, 0), Point(16, 16)));
+                subtree->bulkLoad({ Chunk(Point(1, 2), 9), Chunk(Point(40, 40), 9) });
+                originalTree.change(1, 2, 9);
+                originalTree.reHash();
+                REQUIRE(clonedTree.getHash() == originalTree.getHash());
+                REQUIRE(subtree->getHash()
+                    == originalTree.getSubtree(Rectangle(Point(0, 0), Point(16, 16)))->getHash());
+            }
         }
 
         WHEN("The original tree has more changes than the threshold and changes from subtrees are requested")
@@ -827,6 +984,122 @@ TEST_CASE("Correctly create and apply SyncResponse message")
             auto applyResult = clonedTree.applySyncResponse(syncResponse);
             REQUIRE(applyResult.second.size() == 4);
 
+            THEN("the segments of a split hash value response should report the same out of sync subtrees")
+            {
+                SyncResponse hashResponse = originalTree.prepareSyncResponse(clonedTree.getHash(), 3, 10);
+                REQUIRE(hashResponse.hashvalues_size() == 16);
+                auto segments = SyncTree::splitSyncResponse(hashResponse, 60);
+                REQUIRE(segments.size() > 1);
+
+                SyncTree freshTree(rectangle);
+                std::set<SyncTree*> outOfSync;
+                int nextOffset = 0;
+                for (const auto& segment : segments) {
+                    REQUIRE(segment.hashoffset() == (unsigned)nextOffset);
+                    nextOffset += segment.hashvalues_size();
+                    auto segmentApplyResult = freshTree.applySyncResponse(segment);
+                    outOfSync.insert(segmentApplyResult.second.begin(), segmentApplyResult.second.end());
+                }
+                REQUIRE(nextOffset == 16);
+                REQUIRE(outOfSync.size() == 4);
+            }
+
+            THEN("truncated hash values should be smaller and report the same out of sync subtrees")
+            {
+                REQUIRE(SyncTree::truncateHash(originalTree.getHash(), 16) < 65536);
+                REQUIRE(SyncTree::truncateHash(originalTree.getHash(), 32) < 4294967296);
+                REQUIRE(SyncTree::truncateHash(originalTree.getHash(), 64) == originalTree.getHash());
+
+                SyncResponse hashResponse = originalTree.prepareSyncResponse(clonedTree.getHash(), 3, 10);
+                SyncResponse truncatedResponse(hashResponse);
+                SyncTree::truncateHashValues(truncatedResponse, 16);
+                REQUIRE(truncatedResponse.hashbits() == 16);
+                REQUIRE(truncatedResponse.hashvalues_size() == 16);
+                REQUIRE(truncatedResponse.curhash() == originalTree.getHash());
+                REQUIRE(truncatedResponse.ByteSizeLong() < hashResponse.ByteSizeLong());
+
+                SyncTree freshTree(rectangle);
+                REQUIRE(freshTree.applySyncResponse(truncatedResponse).second.size() == 4);
+                REQUIRE(clonedTree.applySyncResponse(truncatedResponse).second.size() == 4);
+            }
+
+            THEN("a hybrid response should inline the changes of small subtrees up to the chunk threshold")
+            {
+                SyncResponse hybridResponse = originalTree.prepareSyncResponse(clonedTree.getHash(), 2, 10, 3);
+                REQUIRE(!hybridResponse.chunkdata());
+                REQUIRE(hybridResponse.hashvalues_size() == 4);
+                REQUIRE(hybridResponse.chunks_size() == 9);
+
+                SyncTree freshTree(rectangle);
+                auto hybridApplyResult = freshTree.applySyncResponse(hybridResponse);
+                REQUIRE(hybridApplyResult.second.size() == 1);
+
+                SyncResponse hashOnlyResponse = originalTree.prepareSyncResponse(clonedTree.getHash(), 2, 10, 2);
+                REQUIRE(hashOnlyResponse.chunks_size() == 0);
+                REQUIRE(freshTree.applySyncResponse(hashOnlyResponse).second.size() == 1);
+            }
+
+            THEN("a response to the consumer's lower level hash values should contain the changes of the differing "
+                 "subtrees")
+            {
+                REQUIRE(clonedTree.getLowerLevelDigests(1).size() == 4);
+
+                SyncTree freshTree(rectangle);
+                std::map<unsigned, size_t> digests = freshTree.getLowerLevelDigests(1);
+                REQUIRE(digests.empty());
+
+                SyncResponse chunkResponse = originalTree.prepareDigestSyncResponse(1, digests, 12);
+                REQUIRE(chunkResponse.chunkdata());
+                REQUIRE(chunkResponse.chunks_size() == 12);
+
+                SyncResponse descentResponse = originalTree.prepareDigestSyncResponse(1, digests, 5);
+                REQUIRE(!descentResponse.chunkdata());
+                REQUIRE(descentResponse.treelevel() == originalTree.getLevel() + 2);
+                REQUIRE(descentResponse.hashvalues_size() == 16);
+                REQUIRE(descentResponse.chunks_size() == 3);
+
+                auto descentApplyResult = freshTree.applySyncResponse(descentResponse);
+                REQUIRE(!descentApplyResult.first);
+                REQUIRE(descentApplyResult.second.size() == 3);
+
+                for (SyncTree* subtreeFresh : descentApplyResult.second) {
+                    SyncTree* subtreeOriginal(originalTree.getSubtreeFromName(subtreeFresh->subtreeToName()));
+                    auto subtreeResponse
+                        = subtreeOriginal->prepareDigestSyncResponse(1, subtreeFresh->getLowerLevelDigests(1), 5);
+                    REQUIRE(subtreeResponse.chunkdata());
+                    REQUIRE(subtreeFresh->applySyncResponse(subtreeResponse).first);
+                }
+                REQUIRE(freshTree.getHash() == originalTree.getHash());
+            }
+
+            THEN("a budgeted response should fit into the budget and inline the changes of as many subtrees as fit")
+            {
+                SyncResponse largeBudgetResponse = originalTree.prepareBudgetedSyncResponse(clonedTree.getHash(), 2, 10000);
+                REQUIRE(largeBudgetResponse.chunkdata());
+                REQUIRE(largeBudgetResponse.chunks_size() == 12);
+
+                const size_t budget = syncResponse.ByteSizeLong() + 40;
+                SyncResponse mixedResponse = originalTree.prepareBudgetedSyncResponse(clonedTree.getHash(), 2, budget);
+                REQUIRE(mixedResponse.ByteSizeLong() <= budget);
+                REQUIRE(!mixedResponse.chunkdata());
+                REQUIRE(mixedResponse.hashvalues_size() == 4);
+                REQUIRE(mixedResponse.chunks_size() > 0);
+                REQUIRE(mixedResponse.chunks_size() < 12);
+
+                auto mixedApplyResult = clonedTree.applySyncResponse(mixedResponse);
+                REQUIRE(!mixedApplyResult.first);
+                REQUIRE(!mixedApplyResult.second.empty());
+                REQUIRE(mixedApplyResult.second.size() < 4);
+
+                for (SyncTree* subtreeCloned : mixedApplyResult.second) {
+                    SyncTree* subtreeOriginal(originalTree.getSubtreeFromName(subtreeCloned->subtreeToName()));
+                    auto subtreeResponse
+                        = subtreeOriginal->prepareBudgetedSyncResponse(subtreeCloned->getHash(), 2, budget);
+                    REQUIRE(subtreeCloned->applySyncResponse(subtreeResponse).first);
+                }
+                REQUIRE(clonedTree.getHash() == originalTree.getHash());
+            }
+
             THEN("none of the subtree requests should contain hash values and the tree should be synced after applying "
                  "all")
             {